@@ -0,0 +1,229 @@
+#include "attrib.h"
+#include "util.h"
+
+#define ASSERT(x)  // TODO
+
+static const unsigned long long TICKS_PER_SEC = 1000000;
+// sensor data is polled, so a trigger is seen up to one poll cycle late
+static const unsigned WINDOW_SLACK = 100000;
+// score of an otherwise perfect match on a sensor after a missed one, or for a stopped train
+static const unsigned SKIP_PENALTY = 200000;
+static const unsigned STOPPED_PENALTY = 1000000;
+
+void attrib_init(attrib_t *a) {
+  ASSERT(a);
+  memset(a, 0, sizeof *a);
+  memset(a->switches, SWITCH_UNKNOWN, sizeof a->switches);
+  a->last_spurious = SENSOR_NONE;
+}
+
+attrib_train_t *attrib_find(attrib_t *a, unsigned char train) {
+  ASSERT(a);
+  for (size_t i = 0; i < ATTRIB_SLOTS; ++i) {
+    if (a->slots[i].train == train) {
+      return &a->slots[i];
+    }
+  }
+  return 0;
+}
+
+static void clear_predictions(attrib_t *a, size_t slot) {
+  attrib_train_t *t = &a->slots[slot];
+  for (size_t i = 0; i < t->predicted_len; ++i) {
+    a->expect[t->predicted[i]] &= ~(1u << slot);
+  }
+  t->predicted_len = 0;
+}
+
+static void add_prediction(attrib_t *a, attrib_train_t *t, velocity_t *v, unsigned char sensor, unsigned dist,
+                           unsigned char skipped) {
+  if (t->predicted_len == ATTRIB_PREDICT) {
+    ++a->dropped;
+    return;
+  }
+  size_t i = t->predicted_len++;
+  t->predicted[i] = sensor;
+  t->skipped[i] = skipped;
+  unsigned mm_per_sec = velocity_get(v, t->train, t->speed);
+  if (!mm_per_sec || !t->speed) {
+    t->window_begin[i] = 0;
+    t->window_end[i] = ATTRIB_FOREVER;
+  } else {
+    unsigned eta = dist * TICKS_PER_SEC / mm_per_sec;
+    unsigned early = eta - eta / 4;
+    t->window_begin[i] = early > WINDOW_SLACK ? early - WINDOW_SLACK : 0;
+    t->window_end[i] = eta + eta / 2 + WINDOW_SLACK;
+  }
+}
+
+// follows the switches from node and predicts the next sensors, depth sensors deep
+static void predict_from(attrib_t *a, const track_t *track, velocity_t *v, attrib_train_t *t, unsigned char node,
+                         unsigned dist, unsigned char depth, unsigned char skipped) {
+  // bounded in case a loop of the layout has no sensor on it
+  for (size_t steps = 0; steps < track->node_count; ++steps) {
+    unsigned char type = track->node_type[node];
+    unsigned char dir = TRACK_AHEAD;
+    if (type == TRACK_NODE_EXIT) {
+      return;
+    } else if (type == TRACK_NODE_BRANCH) {
+      unsigned char state = a->switches[SWITCH_INDEX[track->node_num[node]]];
+      if (state == SWITCH_UNKNOWN) {
+        predict_from(a, track, v, t, track->edge[node][TRACK_CURVED],
+                     dist + track->edge_dist[node][TRACK_CURVED], depth, skipped);
+      } else {
+        dir = state;
+      }
+    }
+    dist += track->edge_dist[node][dir];
+    node = track->edge[node][dir];
+    if (track->node_type[node] == TRACK_NODE_SENSOR) {
+      add_prediction(a, t, v, node, dist, skipped);
+      if (depth > 1) {
+        predict_from(a, track, v, t, node, dist, depth - 1, skipped + 1);
+      }
+      return;
+    }
+  }
+}
+
+static void predict(attrib_t *a, const track_t *track, velocity_t *v, size_t slot, int include_last) {
+  attrib_train_t *t = &a->slots[slot];
+  clear_predictions(a, slot);
+  if (t->last_sensor == SENSOR_NONE) {
+    return;
+  }
+  if (include_last) {
+    add_prediction(a, t, v, t->last_sensor, 0, 0);
+  }
+  predict_from(a, track, v, t, t->last_sensor, 0, 2, include_last);
+  for (size_t i = 0; i < t->predicted_len; ++i) {
+    a->expect[t->predicted[i]] |= 1u << slot;
+  }
+}
+
+// a slot for a train that has none: a free one, else that of a stopped train, preferably one not
+// located; a stopped train that moves again is located again by its next sensor
+static attrib_train_t *take_slot(attrib_t *a) {
+  attrib_train_t *stopped = 0;
+  for (size_t i = 0; i < ATTRIB_SLOTS; ++i) {
+    attrib_train_t *t = &a->slots[i];
+    if (!t->train) {
+      return t;
+    } else if (!t->speed && (!stopped || stopped->last_sensor != SENSOR_NONE)) {
+      stopped = t;
+    }
+  }
+  if (stopped) {
+    clear_predictions(a, stopped - a->slots);
+  }
+  return stopped;
+}
+
+void attrib_set_speed(attrib_t *a, unsigned char train, unsigned char speed) {
+  ASSERT(a);
+  ASSERT(train);
+  attrib_train_t *t = attrib_find(a, train);
+  if (!t) {
+    t = take_slot(a);
+    if (!t) {
+      ++a->untracked;  // every slot holds a moving train
+      return;
+    }
+    t->train = train;
+    t->last_sensor = SENSOR_NONE;
+    t->predicted_len = 0;
+  }
+  t->speed = speed % 16;
+}
+
+void attrib_reverse(attrib_t *a, const track_t *track, velocity_t *v, unsigned char train) {
+  ASSERT(a);
+  attrib_train_t *t = attrib_find(a, train);
+  if (t && t->last_sensor != SENSOR_NONE) {
+    t->last_sensor ^= 1;
+    predict(a, track, v, t - a->slots, 1);
+  }
+}
+
+void attrib_switch(attrib_t *a, const track_t *track, velocity_t *v, unsigned char id, unsigned char curved) {
+  ASSERT(a);
+  a->switches[SWITCH_INDEX[id]] = curved;
+  for (size_t i = 0; i < ATTRIB_SLOTS; ++i) {
+    if (a->slots[i].train && a->slots[i].last_sensor != SENSOR_NONE) {
+      // predictions that come before the switch do not change, so keep the time they are relative to
+      int include_last = a->slots[i].predicted_len && a->slots[i].predicted[0] == a->slots[i].last_sensor;
+      predict(a, track, v, i, include_last);
+    }
+  }
+}
+
+void attrib_unlocate(attrib_t *a) {
+  ASSERT(a);
+  for (size_t i = 0; i < ATTRIB_SLOTS; ++i) {
+    clear_predictions(a, i);
+    a->slots[i].last_sensor = SENSOR_NONE;
+  }
+}
+
+// how badly the trigger fits the slot's prediction, ATTRIB_FOREVER if it does not at all
+static unsigned score(attrib_train_t *t, unsigned char sensor, unsigned now) {
+  unsigned best = ATTRIB_FOREVER;
+  unsigned elapsed = now - t->last_time;
+  for (size_t i = 0; i < t->predicted_len; ++i) {
+    if (t->predicted[i] != sensor) {
+      continue;
+    }
+    unsigned s = 0;
+    if (elapsed < t->window_begin[i]) {
+      s = t->window_begin[i] - elapsed;
+    } else if (elapsed > t->window_end[i]) {
+      s = elapsed - t->window_end[i];
+    }
+    s += t->skipped[i] * SKIP_PENALTY + (t->speed ? 0 : STOPPED_PENALTY);
+    if (s < best) {
+      best = s;
+    }
+  }
+  return best;
+}
+
+unsigned char attrib_sensor(attrib_t *a, const track_t *track, velocity_t *v, unsigned char sensor, unsigned now) {
+  ASSERT(a);
+  ASSERT(sensor < SENSOR_COUNT);
+  size_t best = ATTRIB_SLOTS;
+  unsigned best_score = ATTRIB_FOREVER;
+  for (unsigned mask = a->expect[sensor]; mask; mask &= mask - 1) {
+    size_t slot = __builtin_ctz(mask);
+    unsigned s = score(&a->slots[slot], sensor, now);
+    if (s < best_score) {
+      best_score = s;
+      best = slot;
+    }
+  }
+
+  if (best == ATTRIB_SLOTS) {
+    // nobody expects it; maybe it is the first sensor of a train we have not located yet
+    for (size_t i = 0; i < ATTRIB_SLOTS; ++i) {
+      attrib_train_t *t = &a->slots[i];
+      if (t->train && t->speed && t->last_sensor == SENSOR_NONE) {
+        if (best != ATTRIB_SLOTS) {
+          best = ATTRIB_SLOTS;  // more than one, cannot tell
+          break;
+        }
+        best = i;
+      }
+    }
+  }
+
+  if (best == ATTRIB_SLOTS) {
+    ++a->spurious;
+    a->last_spurious = sensor;
+    return 0;
+  }
+  attrib_train_t *t = &a->slots[best];
+  t->last_sensor = sensor;
+  t->last_time = now;
+  predict(a, track, v, best, 0);
+  ++a->attributed;
+  return t->train;
+}
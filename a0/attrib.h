@@ -0,0 +1,67 @@
+#pragma once
+
+#include "sensor.h"
+#include "track.h"
+#include "velocity.h"
+
+#define ATTRIB_SLOTS 16  // trains tracked at once; bits of a short
+#define ATTRIB_PREDICT 8  // sensors predicted per train; the most any layout needs, see test_attrib_t
+#define ATTRIB_FOREVER 0xFFFFFFFF
+
+#define SWITCH_UNKNOWN 2
+
+typedef struct {
+  unsigned char train;  // 0 if the slot is free
+  unsigned char speed;
+  unsigned char last_sensor;  // SENSOR_NONE while the train has not been located
+  unsigned last_time;
+  unsigned char predicted_len;
+  unsigned char predicted[ATTRIB_PREDICT];
+  unsigned char skipped[ATTRIB_PREDICT];  // sensors the train passes before it reaches this one
+  // window in which the train is expected at each predicted sensor, relative to last_time
+  unsigned window_begin[ATTRIB_PREDICT], window_end[ATTRIB_PREDICT];
+} attrib_train_t;
+
+/**
+ * Works out which train triggered a sensor.
+ *
+ * Every located train predicts the next sensor(s) it will trigger, following the current switch
+ * settings (both ways for a switch in an unknown state), and the sensor after that in case one
+ * is missed. With a velocity estimate, each prediction also gets a time window. expect[s] has a bit
+ * set for every slot that predicts sensor s, so a trigger only looks at the trains that expect
+ * it: at most ATTRIB_SLOTS * ATTRIB_PREDICT candidates, whatever the number of sensors.
+ *
+ * A trigger that no train expects is given to a moving train that has not been located yet, if
+ * there is exactly one; otherwise it is counted as spurious. A new train takes a free slot, or the
+ * slot of a stopped train; with every slot holding a moving train, it is not tracked.
+ */
+typedef struct {
+  attrib_train_t slots[ATTRIB_SLOTS];
+  unsigned short expect[SENSOR_COUNT];
+  unsigned char switches[SWITCH_COUNT];  // by switch index: 0 straight, 1 curved, SWITCH_UNKNOWN
+  unsigned attributed, spurious;
+  unsigned char last_spurious;
+  unsigned dropped;  // predictions that did not fit in ATTRIB_PREDICT
+  unsigned untracked;  // speed changes of trains that got no slot
+} attrib_t;
+
+void attrib_init(attrib_t *);
+
+// the train (not 0) was given a speed; starts tracking it if it is new, in place of a stopped train
+// if there is no free slot
+void attrib_set_speed(attrib_t *, unsigned char train, unsigned char speed);
+
+// the train turned around: it will trigger the sensor it last passed again, from the other side
+void attrib_reverse(attrib_t *, const track_t *, velocity_t *, unsigned char train);
+
+// a switch was thrown
+void attrib_switch(attrib_t *, const track_t *, velocity_t *, unsigned char id, unsigned char curved);
+
+// forgets where all trains are, e.g. after changing the track
+void attrib_unlocate(attrib_t *);
+
+// returns the train that triggered the sensor, or 0 if it is spurious
+unsigned char attrib_sensor(attrib_t *, const track_t *, velocity_t *, unsigned char sensor, unsigned now);
+
+// the slot tracking the train, or null
+attrib_train_t *attrib_find(attrib_t *, unsigned char train);
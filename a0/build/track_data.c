@@ -0,0 +1,4835 @@
+// generated by tools/trackgen.c, do not edit
+
+#include "track.h"
+
+const unsigned char SWITCH_INDEX[256] = {
+  255, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+  15, 16, 17, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 18, 19, 20, 21, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+};
+
+const unsigned char SWITCH_IDS[SWITCH_COUNT] = {
+  1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+  17, 18, 153, 154, 155, 156,
+};
+
+// tracks/tracka.txt
+static const unsigned short TRACKA_SENSOR_LINK_BEGIN[81] = {
+  0, 1, 2, 3, 4, 8, 10, 11, 12, 13, 14, 16, 18, 19, 20, 23,
+  25, 26, 27, 28, 29, 32, 34, 35, 36, 37, 39, 41, 42, 43, 44, 45,
+  47, 49, 50, 51, 52, 53, 55, 57, 58, 60, 61, 62, 63, 64, 65, 66,
+  68, 69, 70, 71, 73, 74, 75, 76, 78, 79, 80, 81, 82, 82, 83, 83,
+  84, 84, 85, 85, 86, 86, 87, 87, 88, 88, 89, 89, 90, 90, 91, 91,
+  92,
+};
+
+static const track_sensor_link_t TRACKA_SENSOR_LINKS[] = {
+  {2, 560}, {21, 1118}, {4, 1009}, {1, 560}, {6, 769}, {68, 1030}, {70, 1598}, {72, 1609},
+  {3, 1009}, {59, 833}, {8, 269}, {5, 769}, {10, 1120}, {7, 269}, {12, 1423}, {74, 1305},
+  {9, 1120}, {43, 1271}, {14, 916}, {11, 1423}, {16, 1462}, {76, 1876}, {78, 1945}, {13, 916},
+  {62, 714}, {18, 309}, {15, 1462}, {20, 918}, {17, 309}, {0, 1118}, {64, 1749}, {66, 1176},
+  {19, 918}, {57, 1053}, {24, 1192}, {39, 571}, {26, 548}, {23, 1192}, {55, 1368}, {28, 783},
+  {40, 1093}, {25, 548}, {30, 1257}, {27, 783}, {32, 396}, {29, 1257}, {47, 1029}, {34, 1297},
+  {51, 1537}, {31, 396}, {36, 1059}, {33, 1297}, {38, 261}, {35, 1059}, {60, 1152}, {22, 571},
+  {58, 855}, {37, 261}, {42, 563}, {44, 634}, {27, 1093}, {10, 1271}, {41, 563}, {46, 719},
+  {41, 634}, {30, 1029}, {48, 822}, {45, 719}, {50, 1136}, {46, 822}, {33, 1537}, {49, 1136},
+  {52, 1139}, {54, 791}, {50, 1139}, {24, 1368}, {56, 663}, {53, 791}, {20, 1053}, {54, 663},
+  {4, 833}, {39, 855}, {36, 1152}, {14, 714}, {21, 1749}, {21, 1176}, {5, 1030}, {5, 1598},
+  {5, 1609}, {11, 1305}, {15, 1876}, {15, 1945},
+};
+
+static const unsigned char TRACKA_NODE_TYPE[144] = {
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_BRANCH, TRACK_NODE_MERGE, TRACK_NODE_BRANCH, TRACK_NODE_MERGE,
+  TRACK_NODE_BRANCH, TRACK_NODE_MERGE, TRACK_NODE_BRANCH, TRACK_NODE_MERGE,
+  TRACK_NODE_BRANCH, TRACK_NODE_MERGE, TRACK_NODE_BRANCH, TRACK_NODE_MERGE,
+  TRACK_NODE_BRANCH, TRACK_NODE_MERGE, TRACK_NODE_BRANCH, TRACK_NODE_MERGE,
+  TRACK_NODE_BRANCH, TRACK_NODE_MERGE, TRACK_NODE_BRANCH, TRACK_NODE_MERGE,
+  TRACK_NODE_BRANCH, TRACK_NODE_MERGE, TRACK_NODE_BRANCH, TRACK_NODE_MERGE,
+  TRACK_NODE_BRANCH, TRACK_NODE_MERGE, TRACK_NODE_BRANCH, TRACK_NODE_MERGE,
+  TRACK_NODE_BRANCH, TRACK_NODE_MERGE, TRACK_NODE_BRANCH, TRACK_NODE_MERGE,
+  TRACK_NODE_BRANCH, TRACK_NODE_MERGE, TRACK_NODE_BRANCH, TRACK_NODE_MERGE,
+  TRACK_NODE_BRANCH, TRACK_NODE_MERGE, TRACK_NODE_BRANCH, TRACK_NODE_MERGE,
+  TRACK_NODE_BRANCH, TRACK_NODE_MERGE, TRACK_NODE_BRANCH, TRACK_NODE_MERGE,
+  TRACK_NODE_ENTER, TRACK_NODE_EXIT, TRACK_NODE_ENTER, TRACK_NODE_EXIT,
+  TRACK_NODE_ENTER, TRACK_NODE_EXIT, TRACK_NODE_ENTER, TRACK_NODE_EXIT,
+  TRACK_NODE_ENTER, TRACK_NODE_EXIT, TRACK_NODE_ENTER, TRACK_NODE_EXIT,
+  TRACK_NODE_ENTER, TRACK_NODE_EXIT, TRACK_NODE_ENTER, TRACK_NODE_EXIT,
+  TRACK_NODE_ENTER, TRACK_NODE_EXIT, TRACK_NODE_ENTER, TRACK_NODE_EXIT,
+};
+
+static const unsigned char TRACKA_NODE_NUM[144] = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+  32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+  64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+  1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8,
+  9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15, 16, 16,
+  17, 17, 18, 18, 153, 153, 154, 154, 155, 155, 156, 156, 1, 1, 2, 2,
+  3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10,
+};
+
+static const unsigned char TRACKA_EDGE[144][2] = {
+  {2, 255}, {81, 255}, {83, 255}, {1, 255}, {84, 255}, {82, 255}, {8, 255}, {85, 255},
+  {87, 255}, {7, 255}, {88, 255}, {86, 255}, {91, 255}, {89, 255}, {92, 255}, {90, 255},
+  {18, 255}, {93, 255}, {95, 255}, {17, 255}, {80, 255}, {94, 255}, {99, 255}, {97, 255},
+  {26, 255}, {98, 255}, {100, 255}, {25, 255}, {103, 255}, {101, 255}, {32, 255}, {102, 255},
+  {104, 255}, {31, 255}, {107, 255}, {105, 255}, {38, 255}, {106, 255}, {96, 255}, {37, 255},
+  {116, 255}, {101, 255}, {87, 255}, {117, 255}, {119, 255}, {117, 255}, {103, 255}, {118, 255},
+  {121, 255}, {119, 255}, {105, 255}, {120, 255}, {123, 255}, {121, 255}, {99, 255}, {122, 255},
+  {95, 255}, {123, 255}, {83, 255}, {97, 255}, {125, 255}, {107, 255}, {127, 255}, {91, 255},
+  {129, 255}, {109, 255}, {131, 255}, {109, 255}, {133, 255}, {111, 255}, {135, 255}, {113, 255},
+  {137, 255}, {113, 255}, {139, 255}, {89, 255}, {141, 255}, {115, 255}, {143, 255}, {115, 255},
+  {0, 108}, {21, 255}, {3, 59}, {4, 255}, {6, 110}, {5, 255}, {9, 43}, {10, 255},
+  {12, 74}, {11, 255}, {13, 62}, {14, 255}, {16, 114}, {15, 255}, {19, 57}, {20, 255},
+  {22, 58}, {39, 255}, {23, 55}, {24, 255}, {28, 40}, {27, 255}, {29, 47}, {30, 255},
+  {34, 51}, {33, 255}, {35, 60}, {36, 255}, {64, 66}, {81, 255}, {68, 112}, {85, 255},
+  {70, 72}, {111, 255}, {76, 78}, {93, 255}, {42, 44}, {41, 255}, {48, 45}, {46, 255},
+  {49, 52}, {50, 255}, {56, 53}, {54, 255}, {61, 255}, {255, 255}, {63, 255}, {255, 255},
+  {65, 255}, {255, 255}, {67, 255}, {255, 255}, {69, 255}, {255, 255}, {71, 255}, {255, 255},
+  {73, 255}, {255, 255}, {75, 255}, {255, 255}, {77, 255}, {255, 255}, {79, 255}, {255, 255},
+};
+
+static const unsigned short TRACKA_EDGE_DIST[144][2] = {
+  {560, 0}, {529, 0}, {492, 0}, {560, 0}, {271, 0}, {517, 0}, {269, 0}, {498, 0},
+  {379, 0}, {269, 0}, {712, 0}, {741, 0}, {679, 0}, {711, 0}, {776, 0}, {237, 0},
+  {309, 0}, {686, 0}, {465, 0}, {309, 0}, {589, 0}, {453, 0}, {589, 0}, {308, 0},
+  {548, 0}, {603, 0}, {332, 0}, {548, 0}, {520, 0}, {451, 0}, {396, 0}, {737, 0},
+  {772, 0}, {396, 0}, {499, 0}, {525, 0}, {261, 0}, {560, 0}, {263, 0}, {261, 0},
+  {241, 0}, {761, 0}, {530, 0}, {322, 0}, {340, 0}, {393, 0}, {292, 0}, {379, 0},
+  {607, 0}, {443, 0}, {765, 0}, {529, 0}, {359, 0}, {610, 0}, {765, 0}, {432, 0},
+  {600, 0}, {231, 0}, {316, 0}, {592, 0}, {321, 0}, {592, 0}, {736, 0}, {477, 0},
+  {225, 0}, {768, 0}, {575, 0}, {195, 0}, {509, 0}, {525, 0}, {385, 0}, {315, 0},
+  {448, 0}, {326, 0}, {225, 0}, {593, 0}, {687, 0}, {354, 0}, {484, 0}, {423, 0},
+  {529, 392}, {589, 0}, {492, 316}, {517, 0}, {498, 234}, {271, 0}, {379, 530}, {741, 0},
+  {711, 593}, {712, 0}, {679, 477}, {237, 0}, {686, 746}, {776, 0}, {465, 600}, {453, 0},
+  {308, 592}, {263, 0}, {589, 765}, {603, 0}, {451, 761}, {332, 0}, {520, 292}, {737, 0},
+  {525, 765}, {772, 0}, {499, 592}, {560, 0}, {768, 195}, {392, 0}, {525, 778}, {234, 0},
+  {315, 326}, {778, 0}, {354, 423}, {746, 0}, {322, 393}, {241, 0}, {443, 340}, {379, 0},
+  {607, 610}, {529, 0}, {231, 359}, {432, 0}, {321, 0}, {0, 0}, {736, 0}, {0, 0},
+  {225, 0}, {0, 0}, {575, 0}, {0, 0}, {509, 0}, {0, 0}, {385, 0}, {0, 0},
+  {448, 0}, {0, 0}, {225, 0}, {0, 0}, {687, 0}, {0, 0}, {484, 0}, {0, 0},
+};
+
+static const unsigned char TRACKA_NEXT_DIR[144 * 144] = {
+  // A1
+  255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // A2
+  0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // A3
+  0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // A4
+  0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // A5
+  0, 255, 0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // A6
+  0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // A7
+  0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // A8
+  0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // A9
+  0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // A10
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // A11
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // A12
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // A13
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // A14
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // A15
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // A16
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B1
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B2
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B3
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B4
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B5
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B6
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B7
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B8
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B9
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B10
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 255, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B11
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B12
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B13
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B14
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B15
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B16
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C1
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C2
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C3
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C4
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C5
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C6
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C7
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C8
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C9
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C10
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C11
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C12
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C13
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C14
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C15
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C16
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // D1
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 255, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // D2
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // D3
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 255, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // D4
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 255, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // D5
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // D6
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 255, 0, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // D7
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 255, 255, 0, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // D8
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // D9
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // D10
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // D11
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // D12
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // D13
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  // D14
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // D15
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  // D16
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // E1
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  // E2
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // E3
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  // E4
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // E5
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  // E6
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // E7
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+  // E8
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // E9
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 255, 255, 255, 255, 255,
+  // E10
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // E11
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 255, 255, 255,
+  // E12
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // E13
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 255,
+  // E14
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // E15
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0,
+  // E16
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR1
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // MR1
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR2
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+  0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 255, 0, 255,
+  1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 1, 0, 255, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+  0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 1, 255, 1, 255, 1, 255, 0, 255, 0, 1, 1, 0, 0, 1, 1, 0, 255, 1, 255, 0,
+  255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 0, 255, 0, 255, 0,
+  // MR2
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR3
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 1, 255, 1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 1, 255, 1, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 1, 255, 1, 255, 1, 255, 0, 255, 0, 255, 0,
+  // MR3
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR4
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 255, 0, 255,
+  1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 1, 0, 0, 1, 1, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+  0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 255, 1, 255, 1, 255, 0, 255, 0, 1, 0, 0, 0, 1, 1, 0, 255, 0, 255, 0,
+  255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 0, 255, 0, 255, 0,
+  // MR4
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 255, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR5
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 1, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 1, 255, 0, 255, 0,
+  // MR5
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR6
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 1, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 1,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // MR6
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 255, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR7
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 1, 255, 1, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 1, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 1, 255, 1,
+  // MR7
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR8
+  0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 0, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 255, 0,
+  1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 0, 255, 1, 255, 1, 255, 1, 255, 1, 0, 0, 1, 1, 0, 0, 1, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1,
+  // MR8
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR9
+  1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 1, 255, 255, 255, 255, 255,
+  1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 255, 1, 1, 255, 255, 1, 1, 255, 255, 1, 1, 255, 255, 1,
+  255, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 1, 255, 1, 255, 1, 255, 1, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 255, 255,
+  255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1,
+  // MR9
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR10
+  1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 1, 255, 255, 1, 255, 1, 1, 255, 255, 255, 0, 255, 255, 255,
+  1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 255, 1, 1, 255, 255, 1, 1, 255, 255, 1, 1, 255, 255, 1,
+  255, 0, 255, 255, 255, 0, 0, 255, 255, 0, 0, 255, 1, 255, 1, 255, 1, 255, 1, 255, 255, 0, 0, 255, 255, 1, 1, 255, 255, 0, 255, 255,
+  255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1,
+  // MR10
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR11
+  1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 1, 255, 1, 255, 1, 255, 1, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255, 255, 255,
+  1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 1, 255, 1, 255, 1, 255, 1, 255, 255, 0, 0, 255, 255, 1, 1, 255, 255, 1, 1, 255, 255, 1,
+  0, 255, 255, 0, 255, 255, 255, 0, 0, 255, 255, 0, 1, 255, 0, 255, 0, 255, 1, 255, 1, 255, 255, 1, 0, 255, 255, 0, 255, 255, 255, 255,
+  255, 1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 1, 255, 1, 255, 1,
+  // MR11
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 255, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR12
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 1,
+  255, 1, 255, 0, 255, 0, 255, 0, 255, 1, 255, 255, 255, 1, 255, 1, 1, 255, 1, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 255, 255, 255, 1, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 1, 1, 255, 255, 1, 0, 255, 255, 0, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // MR12
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 255, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR13
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 1, 255,
+  1, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 1, 255, 255, 1, 255, 1, 1, 255, 1, 255, 255, 255, 0, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 1, 255, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 1, 1, 255, 255, 1, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // MR13
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR14
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 1, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 1, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // MR14
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR15
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 1, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 0, 255, 1, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  // MR15
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR16
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 0, 255, 1, 255, 1, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 0, 255, 1, 255, 1, 255, 255, 255, 255, 255, 255,
+  // MR16
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR17
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 0, 255, 1, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 0, 255, 1, 255, 255, 255, 255, 255, 255,
+  // MR17
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR18
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 1, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 1,
+  // MR18
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR153
+  0, 255, 0, 255, 1, 255, 1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255,
+  1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 0, 255, 1, 255, 1, 255, 255, 1, 255, 1, 1, 255, 1, 255, 255, 255, 1, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 1, 255, 1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 1, 1, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  1, 255, 255, 1, 1, 255, 255, 1, 1, 255, 255, 1, 0, 255, 1, 255, 1, 255, 0, 255, 255, 255, 255, 1, 1, 255, 255, 1, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 1, 255, 1, 255, 1, 255, 0, 255, 0, 255, 0,
+  // MR153
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR154
+  1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 255, 1, 255, 1, 255, 1, 255, 0, 255, 0,
+  255, 0, 255, 1, 255, 1, 255, 1, 255, 1, 255, 255, 255, 1, 255, 0, 0, 255, 0, 255, 255, 1, 255, 1, 1, 255, 255, 255, 1, 255, 255, 255,
+  1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 255, 1, 1, 255, 255, 1, 1, 255, 255, 1, 1, 255, 255, 1,
+  255, 1, 1, 255, 255, 1, 0, 255, 255, 0, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 255, 1, 255, 255, 255, 0, 1, 255, 255, 1, 255, 255,
+  255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1,
+  // MR154
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 255, 0, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR155
+  1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 0, 255, 1, 255, 1, 255, 1, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 1, 255, 1, 255, 1, 255, 0, 255, 255, 0, 255, 0, 1, 255, 1, 255, 255, 255, 0, 255, 255, 255, 255, 255,
+  1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 1, 255, 1, 255, 1, 255, 1, 255, 255, 0, 0, 255, 255, 1, 1, 255, 255, 1, 1, 255, 255, 1,
+  0, 255, 255, 1, 1, 255, 255, 0, 0, 255, 255, 0, 1, 255, 0, 255, 0, 255, 1, 255, 1, 255, 255, 0, 255, 255, 255, 1, 255, 255, 255, 255,
+  255, 1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 1, 255, 1, 255, 1,
+  // MR155
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 255, 0, 255, 255, 0, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR156
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1,
+  255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 255, 255, 1, 255, 1, 1, 255, 1, 255, 255, 1, 255, 1, 0, 255, 255, 255, 1, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 1, 1, 255, 255, 1, 1, 255, 255, 1, 1, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 1, 1, 255, 255, 1, 255, 255, 255, 1, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // MR156
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 255, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // EN1
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 0, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // EX1
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  // EN2
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // EX2
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  // EN3
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // EX3
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  // EN4
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // EX4
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  // EN5
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // EX5
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  // EN6
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // EX6
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  // EN7
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // EX7
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  // EN8
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // EX8
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  // EN9
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // EX9
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  // EN10
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // EX10
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+};
+
+static const unsigned short TRACKA_DIST[144 * 144] = {
+  // A1
+  0, 65535, 560, 65535, 1569, 65535, 2338, 65535, 2607, 65535, 3727, 65535, 5150, 65535, 6066, 65535,
+  7528, 65535, 7837, 65535, 8755, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  10504, 65535, 9931, 65535, 2599, 65535, 3167, 65535, 3178, 65535, 5032, 65535, 7942, 65535, 8011, 65535,
+  9344, 65535, 65535, 1052, 1840, 65535, 65535, 2986, 4439, 65535, 65535, 5829, 6842, 65535, 65535, 8302,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 9736, 65535, 2074, 65535,
+  2852, 65535, 7588, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 10729, 65535, 10506, 65535, 3108, 65535, 3552, 65535, 3626, 65535, 5257, 65535, 8629, 65535, 8495,
+  // A2
+  13823, 0, 14383, 9313, 11491, 8304, 12260, 7535, 12529, 7266, 7677, 6146, 9100, 4723, 10016, 3807,
+  11478, 2345, 11787, 2036, 12705, 1118, 10374, 10813, 4202, 9621, 4750, 9073, 5533, 14262, 6790, 13005,
+  7186, 12609, 8483, 11312, 9542, 10253, 9803, 9992, 5843, 7980, 6406, 7417, 6477, 14753, 7196, 14034,
+  14856, 9859, 12919, 8723, 9862, 11780, 2834, 10989, 11652, 2171, 10658, 9137, 11405, 65535, 4521, 65535,
+  14454, 65535, 13881, 65535, 12521, 65535, 13089, 65535, 13100, 65535, 8982, 65535, 11892, 65535, 11961, 65535,
+  13294, 529, 8821, 10974, 11762, 8033, 6887, 6936, 8389, 5434, 4044, 9779, 10792, 3031, 1571, 12252,
+  10066, 9729, 10224, 3599, 5082, 8741, 13742, 6053, 7958, 11837, 10813, 8982, 13686, 65535, 11996, 65535,
+  12774, 65535, 11538, 65535, 6084, 7739, 14413, 6817, 9252, 12390, 11421, 2402, 65535, 11726, 65535, 5257,
+  65535, 14679, 65535, 14456, 65535, 13030, 65535, 13474, 65535, 13548, 65535, 9207, 65535, 12579, 65535, 12445,
+  // A3
+  9313, 65535, 0, 65535, 1009, 65535, 1778, 65535, 2047, 65535, 3167, 65535, 4590, 65535, 5506, 65535,
+  6968, 65535, 7277, 65535, 8195, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  9944, 65535, 9371, 65535, 2039, 65535, 2607, 65535, 2618, 65535, 4472, 65535, 7382, 65535, 7451, 65535,
+  8784, 65535, 65535, 492, 1280, 65535, 65535, 2426, 3879, 65535, 65535, 5269, 6282, 65535, 65535, 7742,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 9176, 65535, 1514, 65535,
+  2292, 65535, 7028, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 10169, 65535, 9946, 65535, 2548, 65535, 2992, 65535, 3066, 65535, 4697, 65535, 8069, 65535, 7935,
+  // A4
+  14383, 560, 14943, 0, 12051, 8864, 12820, 8095, 13089, 7826, 8237, 6706, 9660, 5283, 10576, 4367,
+  12038, 2905, 12347, 2596, 13265, 1678, 10934, 11373, 4762, 10181, 5310, 9633, 6093, 14822, 7350, 13565,
+  7746, 13169, 9043, 11872, 10102, 10813, 10363, 10552, 6403, 8540, 6966, 7977, 7037, 15313, 7756, 14594,
+  15416, 10419, 13479, 9283, 10422, 12340, 3394, 11549, 12212, 2731, 11218, 9697, 11965, 65535, 5081, 65535,
+  15014, 65535, 14441, 65535, 13081, 65535, 13649, 65535, 13660, 65535, 9542, 65535, 12452, 65535, 12521, 65535,
+  13854, 1089, 9381, 11534, 12322, 8593, 7447, 7496, 8949, 5994, 4604, 10339, 11352, 3591, 2131, 12812,
+  10626, 10289, 10784, 4159, 5642, 9301, 14302, 6613, 8518, 12397, 11373, 9542, 14246, 65535, 12556, 65535,
+  13334, 65535, 12098, 65535, 6644, 8299, 14973, 7377, 9812, 12950, 11981, 2962, 65535, 12286, 65535, 5817,
+  65535, 15239, 65535, 15016, 65535, 13590, 65535, 14034, 65535, 14108, 65535, 9767, 65535, 13139, 65535, 13005,
+  // A5
+  8304, 65535, 8864, 65535, 0, 65535, 769, 65535, 1038, 65535, 2158, 65535, 3581, 65535, 4497, 65535,
+  5959, 65535, 6268, 65535, 7186, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  8935, 65535, 8362, 65535, 1030, 65535, 1598, 65535, 1609, 65535, 3463, 65535, 6373, 65535, 6442, 65535,
+  7775, 65535, 65535, 9356, 271, 65535, 65535, 1417, 2870, 65535, 65535, 4260, 5273, 65535, 65535, 6733,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 8167, 65535, 505, 65535,
+  1283, 65535, 6019, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 9160, 65535, 8937, 65535, 1539, 65535, 1983, 65535, 2057, 65535, 3688, 65535, 7060, 65535, 6926,
+  // A6
+  11491, 1569, 12051, 1009, 13060, 0, 13829, 9104, 14098, 8835, 9246, 7715, 10669, 6292, 11585, 5376,
+  13047, 3914, 13356, 3605, 10373, 2687, 11943, 8481, 5771, 7289, 6319, 6741, 7102, 5958, 8359, 4701,
+  8755, 4305, 10052, 3008, 11111, 1949, 11372, 1688, 7412, 7083, 7975, 8986, 8046, 6449, 8765, 5730,
+  6552, 11428, 7688, 10292, 11431, 9448, 4403, 8657, 9320, 3740, 12227, 833, 3101, 65535, 6090, 65535,
+  12122, 65535, 11549, 65535, 14090, 65535, 14658, 65535, 14669, 65535, 10551, 65535, 13461, 65535, 13530, 65535,
+  10962, 2098, 517, 12543, 13331, 9602, 8456, 8505, 9958, 7003, 5613, 11348, 12361, 4600, 3140, 9920,
+  11635, 1425, 7892, 5168, 6651, 6409, 5438, 7622, 9527, 3533, 2509, 10551, 11354, 65535, 13565, 65535,
+  14343, 65535, 13107, 65535, 7653, 6842, 6109, 8386, 10821, 7159, 9089, 3971, 65535, 3422, 65535, 6826,
+  65535, 12347, 65535, 12124, 65535, 14599, 65535, 15043, 65535, 15117, 65535, 10776, 65535, 14148, 65535, 14014,
+  // A7
+  7535, 65535, 8095, 65535, 9104, 65535, 0, 65535, 269, 65535, 1389, 65535, 2812, 65535, 3728, 65535,
+  5190, 65535, 5499, 65535, 6417, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  8166, 65535, 7593, 65535, 10134, 65535, 10702, 65535, 10713, 65535, 2694, 65535, 5604, 65535, 5673, 65535,
+  7006, 65535, 65535, 8587, 9375, 65535, 65535, 648, 2101, 65535, 65535, 3491, 4504, 65535, 65535, 5964,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 7398, 65535, 9609, 65535,
+  10387, 65535, 5250, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 8391, 65535, 8168, 65535, 10643, 65535, 11087, 65535, 11161, 65535, 2919, 65535, 6291, 65535, 6157,
+  // A8
+  12260, 2338, 12820, 1778, 13829, 769, 14598, 0, 14867, 9604, 10015, 8484, 11438, 7061, 12354, 6145,
+  13816, 4683, 14125, 4374, 11142, 3456, 12712, 9250, 6540, 8058, 7088, 7510, 7871, 6727, 9128, 5470,
+  9524, 5074, 10821, 3777, 11880, 2718, 12141, 2457, 8181, 7852, 8744, 9755, 8815, 7218, 9534, 6499,
+  7321, 12197, 8457, 11061, 12200, 10217, 5172, 9426, 10089, 4509, 12996, 1602, 3870, 65535, 6859, 65535,
+  12891, 65535, 12318, 65535, 14859, 65535, 15427, 65535, 15438, 65535, 11320, 65535, 14230, 65535, 14299, 65535,
+  11731, 2867, 1286, 13312, 14100, 498, 9225, 9274, 10727, 7772, 6382, 12117, 13130, 5369, 3909, 10689,
+  12404, 2194, 8661, 5937, 7420, 7178, 6207, 8391, 10296, 4302, 3278, 11320, 12123, 65535, 14334, 65535,
+  15112, 65535, 13876, 65535, 8422, 7611, 6878, 9155, 11590, 7928, 9858, 4740, 65535, 4191, 65535, 7595,
+  65535, 13116, 65535, 12893, 65535, 15368, 65535, 15812, 65535, 15886, 65535, 11545, 65535, 14917, 65535, 14783,
+  // A9
+  7266, 65535, 7826, 65535, 8835, 65535, 9604, 65535, 0, 65535, 1120, 65535, 2543, 65535, 3459, 65535,
+  4921, 65535, 5230, 65535, 6148, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  7897, 65535, 7324, 65535, 9865, 65535, 10433, 65535, 10444, 65535, 2425, 65535, 5335, 65535, 5404, 65535,
+  6737, 65535, 65535, 8318, 9106, 65535, 65535, 379, 1832, 65535, 65535, 3222, 4235, 65535, 65535, 5695,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 7129, 65535, 9340, 65535,
+  10118, 65535, 4981, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 8122, 65535, 7899, 65535, 10374, 65535, 10818, 65535, 10892, 65535, 2650, 65535, 6022, 65535, 5888,
+  // A10
+  12529, 2607, 13089, 2047, 14098, 1038, 14867, 269, 15136, 0, 10284, 8753, 11707, 7330, 12623, 6414,
+  14085, 4952, 14394, 4643, 11411, 3725, 12981, 9519, 6809, 8327, 7357, 7779, 8140, 6996, 9397, 5739,
+  9793, 5343, 11090, 4046, 12149, 2987, 12410, 2726, 8450, 8121, 9013, 10024, 9084, 7487, 9803, 6768,
+  7590, 12466, 8726, 11330, 12469, 10486, 5441, 9695, 10358, 4778, 13265, 1871, 4139, 65535, 7128, 65535,
+  13160, 65535, 12587, 65535, 15128, 65535, 15696, 65535, 15707, 65535, 11589, 65535, 14499, 65535, 14568, 65535,
+  12000, 3136, 1555, 13581, 14369, 767, 9494, 9543, 10996, 8041, 6651, 12386, 13399, 5638, 4178, 10958,
+  12673, 2463, 8930, 6206, 7689, 7447, 6476, 8660, 10565, 4571, 3547, 11589, 12392, 65535, 14603, 65535,
+  15381, 65535, 14145, 65535, 8691, 7880, 7147, 9424, 11859, 8197, 10127, 5009, 65535, 4460, 65535, 7864,
+  65535, 13385, 65535, 13162, 65535, 15637, 65535, 16081, 65535, 16155, 65535, 11814, 65535, 15186, 65535, 15052,
+  // A11
+  6146, 65535, 6706, 65535, 7715, 65535, 8484, 65535, 8753, 65535, 0, 65535, 1423, 65535, 2339, 65535,
+  3801, 65535, 4110, 65535, 5028, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  6777, 65535, 6204, 65535, 8745, 65535, 9313, 65535, 9324, 65535, 1305, 65535, 4215, 65535, 4284, 65535,
+  5617, 65535, 65535, 7198, 7986, 65535, 65535, 9132, 712, 65535, 65535, 2102, 3115, 65535, 65535, 4575,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 6009, 65535, 8220, 65535,
+  8998, 65535, 3861, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 7002, 65535, 6779, 65535, 9254, 65535, 9698, 65535, 9772, 65535, 1530, 65535, 4902, 65535, 4768,
+  // A12
+  7677, 3727, 8237, 3167, 9246, 2158, 10015, 1389, 10284, 1120, 11404, 0, 12827, 8450, 13743, 7534,
+  15205, 6072, 15514, 5763, 6559, 4845, 14101, 4667, 7929, 3475, 8477, 2927, 9260, 8116, 10517, 6859,
+  10913, 6463, 12210, 5166, 13269, 4107, 13530, 3846, 9570, 1834, 10133, 1271, 10204, 8607, 10923, 7888,
+  8710, 13586, 6773, 12450, 13589, 5634, 6561, 4843, 5506, 5898, 14385, 2991, 5259, 65535, 8248, 65535,
+  8308, 65535, 7735, 65535, 10276, 65535, 10844, 65535, 10855, 65535, 12709, 65535, 15619, 65535, 15688, 65535,
+  7148, 4256, 2675, 8729, 9517, 1887, 741, 10663, 12116, 9161, 7771, 13506, 14519, 6758, 5298, 6106,
+  13793, 3583, 4078, 7326, 8809, 2595, 7596, 9780, 11685, 5691, 4667, 12709, 7540, 65535, 9751, 65535,
+  10529, 65535, 15265, 65535, 9811, 1593, 8267, 10544, 12979, 6244, 5275, 6129, 65535, 5580, 65535, 8984,
+  65535, 8533, 65535, 8310, 65535, 10785, 65535, 11229, 65535, 11303, 65535, 12934, 65535, 16306, 65535, 16172,
+  // A13
+  4723, 65535, 5283, 65535, 6292, 65535, 7061, 65535, 7330, 65535, 8450, 65535, 0, 65535, 916, 65535,
+  2378, 65535, 2687, 65535, 3605, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  5354, 65535, 4781, 65535, 7322, 65535, 7890, 65535, 7901, 65535, 9755, 65535, 2792, 65535, 2861, 65535,
+  4194, 65535, 65535, 5775, 6563, 65535, 65535, 7709, 9162, 65535, 65535, 679, 1692, 65535, 65535, 3152,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4586, 65535, 6797, 65535,
+  7575, 65535, 2438, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 5579, 65535, 5356, 65535, 7831, 65535, 8275, 65535, 8349, 65535, 9980, 65535, 3479, 65535, 3345,
+  // A14
+  9100, 5150, 9660, 4590, 10669, 3581, 11438, 2812, 11707, 2543, 12827, 1423, 14250, 0, 15166, 8957,
+  16628, 7495, 16937, 7186, 7982, 6268, 15524, 6090, 9352, 4898, 9900, 4350, 10683, 9539, 11940, 8282,
+  12336, 7886, 13633, 6589, 14692, 5530, 14953, 5269, 10993, 3257, 11556, 2694, 11627, 10030, 12346, 9311,
+  10133, 15009, 8196, 13873, 15012, 7057, 7984, 6266, 6929, 7321, 15808, 4414, 6682, 65535, 9671, 65535,
+  9731, 65535, 9158, 65535, 11699, 65535, 12267, 65535, 12278, 65535, 14132, 65535, 17042, 65535, 17111, 65535,
+  8571, 5679, 4098, 10152, 10940, 3310, 2164, 12086, 13539, 711, 9194, 14929, 15942, 8181, 6721, 7529,
+  15216, 5006, 5501, 8749, 10232, 4018, 9019, 11203, 13108, 7114, 6090, 14132, 8963, 65535, 11174, 65535,
+  11952, 65535, 16688, 65535, 11234, 3016, 9690, 11967, 14402, 7667, 6698, 7552, 65535, 7003, 65535, 10407,
+  65535, 9956, 65535, 9733, 65535, 12208, 65535, 12652, 65535, 12726, 65535, 14357, 65535, 17729, 65535, 17595,
+  // A15
+  3807, 65535, 4367, 65535, 5376, 65535, 6145, 65535, 6414, 65535, 7534, 65535, 8957, 65535, 0, 65535,
+  1462, 65535, 1771, 65535, 2689, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  4438, 65535, 3865, 65535, 6406, 65535, 6974, 65535, 6985, 65535, 8839, 65535, 1876, 65535, 1945, 65535,
+  3278, 65535, 65535, 4859, 5647, 65535, 65535, 6793, 8246, 65535, 65535, 9636, 776, 65535, 65535, 2236,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3670, 65535, 5881, 65535,
+  6659, 65535, 1522, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 4663, 65535, 4440, 65535, 6915, 65535, 7359, 65535, 7433, 65535, 9064, 65535, 2563, 65535, 2429,
+  // A16
+  10016, 6066, 10576, 5506, 11585, 4497, 12354, 3728, 12623, 3459, 13743, 2339, 15166, 916, 16082, 0,
+  17544, 8411, 17853, 8102, 8898, 7184, 16440, 7006, 10268, 5814, 10816, 5266, 11599, 10455, 12856, 9198,
+  13252, 8802, 14549, 7505, 15608, 6446, 15869, 6185, 11909, 4173, 12472, 3610, 12543, 10946, 13262, 10227,
+  11049, 15925, 9112, 14789, 15928, 7973, 8900, 7182, 7845, 8237, 16724, 5330, 7598, 65535, 714, 65535,
+  10647, 65535, 10074, 65535, 12615, 65535, 13183, 65535, 13194, 65535, 15048, 65535, 17958, 65535, 18027, 65535,
+  9487, 6595, 5014, 11068, 11856, 4226, 3080, 13002, 14455, 1627, 237, 15845, 16858, 9097, 7637, 8445,
+  16132, 5922, 6417, 9665, 11148, 4934, 9935, 12119, 14024, 8030, 7006, 15048, 9879, 65535, 12090, 65535,
+  12868, 65535, 17604, 65535, 12150, 3932, 10606, 12883, 15318, 8583, 7614, 8468, 65535, 7919, 65535, 1450,
+  65535, 10872, 65535, 10649, 65535, 13124, 65535, 13568, 65535, 13642, 65535, 15273, 65535, 18645, 65535, 18511,
+  // B1
+  2345, 65535, 2905, 65535, 3914, 65535, 4683, 65535, 4952, 65535, 6072, 65535, 7495, 65535, 8411, 65535,
+  0, 65535, 309, 65535, 1227, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  2976, 65535, 2403, 65535, 4944, 65535, 5512, 65535, 5523, 65535, 7377, 65535, 10287, 65535, 10356, 65535,
+  1816, 65535, 65535, 3397, 4185, 65535, 65535, 5331, 6784, 65535, 65535, 8174, 9187, 65535, 65535, 774,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2208, 65535, 4419, 65535,
+  5197, 65535, 9933, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 3201, 65535, 2978, 65535, 5453, 65535, 5897, 65535, 5971, 65535, 7602, 65535, 10974, 65535, 10840,
+  // B2
+  11478, 7528, 12038, 6968, 13047, 5959, 13816, 5190, 14085, 4921, 15205, 3801, 16628, 2378, 17544, 1462,
+  19006, 0, 19315, 9564, 10360, 8646, 17902, 8468, 11730, 7276, 12278, 6728, 13061, 11917, 14318, 10660,
+  14714, 10264, 16011, 8967, 17070, 7908, 17331, 7647, 13371, 5635, 13934, 5072, 14005, 12408, 14724, 11689,
+  12511, 17387, 10574, 16251, 17390, 9435, 10362, 8644, 9307, 9699, 18186, 6792, 9060, 65535, 2176, 65535,
+  12109, 65535, 11536, 65535, 14077, 65535, 14645, 65535, 14656, 65535, 16510, 65535, 19420, 65535, 19489, 65535,
+  10949, 8057, 6476, 12530, 13318, 5688, 4542, 14464, 15917, 3089, 1699, 17307, 18320, 686, 9099, 9907,
+  17594, 7384, 7879, 11127, 12610, 6396, 11397, 13581, 15486, 9492, 8468, 16510, 11341, 65535, 13552, 65535,
+  14330, 65535, 19066, 65535, 13612, 5394, 12068, 14345, 16780, 10045, 9076, 9930, 65535, 9381, 65535, 2912,
+  65535, 12334, 65535, 12111, 65535, 14586, 65535, 15030, 65535, 15104, 65535, 16735, 65535, 20107, 65535, 19973,
+  // B3
+  2036, 65535, 2596, 65535, 3605, 65535, 4374, 65535, 4643, 65535, 5763, 65535, 7186, 65535, 8102, 65535,
+  9564, 65535, 0, 65535, 918, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  2667, 65535, 2094, 65535, 4635, 65535, 5203, 65535, 5214, 65535, 7068, 65535, 9978, 65535, 10047, 65535,
+  1507, 65535, 65535, 3088, 3876, 65535, 65535, 5022, 6475, 65535, 65535, 7865, 8878, 65535, 65535, 465,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1899, 65535, 4110, 65535,
+  4888, 65535, 9624, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 2892, 65535, 2669, 65535, 5144, 65535, 5588, 65535, 5662, 65535, 7293, 65535, 10665, 65535, 10531,
+  // B4
+  11787, 7837, 12347, 7277, 13356, 6268, 14125, 5499, 14394, 5230, 15514, 4110, 16937, 2687, 17853, 1771,
+  19315, 309, 19624, 0, 10669, 8955, 18211, 8777, 12039, 7585, 12587, 7037, 13370, 12226, 14627, 10969,
+  15023, 10573, 16320, 9276, 17379, 8217, 17640, 7956, 13680, 5944, 14243, 5381, 14314, 12717, 15033, 11998,
+  12820, 17696, 10883, 16560, 17699, 9744, 10671, 8953, 9616, 10008, 18495, 7101, 9369, 65535, 2485, 65535,
+  12418, 65535, 11845, 65535, 14386, 65535, 14954, 65535, 14965, 65535, 16819, 65535, 19729, 65535, 19798, 65535,
+  11258, 8366, 6785, 12839, 13627, 5997, 4851, 14773, 16226, 3398, 2008, 17616, 18629, 995, 9408, 10216,
+  17903, 7693, 8188, 11436, 12919, 6705, 11706, 13890, 15795, 9801, 8777, 16819, 11650, 65535, 13861, 65535,
+  14639, 65535, 19375, 65535, 13921, 5703, 12377, 14654, 17089, 10354, 9385, 10239, 65535, 9690, 65535, 3221,
+  65535, 12643, 65535, 12420, 65535, 14895, 65535, 15339, 65535, 15413, 65535, 17044, 65535, 20416, 65535, 20282,
+  // B5
+  1118, 65535, 1678, 65535, 2687, 65535, 3456, 65535, 3725, 65535, 4845, 65535, 6268, 65535, 7184, 65535,
+  8646, 65535, 8955, 65535, 0, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  1749, 65535, 1176, 65535, 3717, 65535, 4285, 65535, 4296, 65535, 6150, 65535, 9060, 65535, 9129, 65535,
+  589, 65535, 65535, 2170, 2958, 65535, 65535, 4104, 5557, 65535, 65535, 6947, 7960, 65535, 65535, 9420,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 981, 65535, 3192, 65535,
+  3970, 65535, 8706, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 1974, 65535, 1751, 65535, 4226, 65535, 4670, 65535, 4744, 65535, 6375, 65535, 9747, 65535, 9613,
+  // B6
+  12705, 8755, 13265, 8195, 10373, 7186, 11142, 6417, 11411, 6148, 6559, 5028, 7982, 3605, 8898, 2689,
+  10360, 1227, 10669, 918, 11587, 0, 9256, 9695, 3084, 8503, 3632, 7955, 4415, 13144, 5672, 11887,
+  6068, 11491, 7365, 10194, 8424, 9135, 8685, 8874, 4725, 6862, 5288, 6299, 5359, 13635, 6078, 12916,
+  13738, 8741, 11801, 7605, 8744, 10662, 1716, 9871, 10534, 1053, 9540, 8019, 10287, 65535, 3403, 65535,
+  13336, 65535, 12763, 65535, 11403, 65535, 11971, 65535, 11982, 65535, 7864, 65535, 10774, 65535, 10843, 65535,
+  12176, 9284, 7703, 9856, 10644, 6915, 5769, 5818, 7271, 4316, 2926, 8661, 9674, 1913, 453, 11134,
+  8948, 8611, 9106, 2481, 3964, 7623, 12624, 4935, 6840, 10719, 9695, 7864, 12568, 65535, 10878, 65535,
+  11656, 65535, 10420, 65535, 4966, 6621, 13295, 5699, 8134, 11272, 10303, 1284, 65535, 10608, 65535, 4139,
+  65535, 13561, 65535, 13338, 65535, 11912, 65535, 12356, 65535, 12430, 65535, 8089, 65535, 11461, 65535, 11327,
+  // B7
+  10813, 65535, 11373, 65535, 8481, 65535, 9250, 65535, 9519, 65535, 4667, 65535, 6090, 65535, 7006, 65535,
+  8468, 65535, 8777, 65535, 9695, 65535, 0, 65535, 1192, 65535, 1740, 65535, 2523, 65535, 3780, 65535,
+  4176, 65535, 5473, 65535, 6532, 65535, 6793, 65535, 2833, 65535, 3396, 65535, 3467, 65535, 4186, 65535,
+  65535, 6849, 65535, 5713, 6852, 65535, 7643, 65535, 65535, 65535, 7648, 65535, 65535, 65535, 65535, 65535,
+  11444, 65535, 10871, 65535, 9511, 65535, 10079, 65535, 10090, 65535, 5972, 65535, 8882, 65535, 8951, 65535,
+  10284, 65535, 65535, 7964, 8752, 65535, 65535, 3926, 5379, 65535, 65535, 6769, 7782, 65535, 65535, 9242,
+  7056, 65535, 65535, 589, 2072, 65535, 65535, 3043, 4948, 65535, 65535, 5972, 10676, 65535, 8986, 65535,
+  9764, 65535, 8528, 65535, 3074, 65535, 65535, 3807, 6242, 65535, 65535, 7211, 65535, 65535, 65535, 65535,
+  65535, 11669, 65535, 11446, 65535, 10020, 65535, 10464, 65535, 10538, 65535, 6197, 65535, 9569, 65535, 9435,
+  // B8
+  10374, 65535, 10934, 65535, 11943, 65535, 12712, 65535, 12981, 65535, 14101, 65535, 15524, 65535, 16440, 65535,
+  17902, 65535, 18211, 65535, 9256, 65535, 65535, 0, 65535, 6172, 65535, 5624, 65535, 4841, 65535, 3584,
+  65535, 3188, 65535, 1891, 65535, 832, 65535, 571, 65535, 5966, 65535, 65535, 65535, 5332, 65535, 4613,
+  5435, 65535, 6571, 65535, 65535, 8331, 65535, 7540, 8203, 65535, 65535, 65535, 1984, 65535, 65535, 65535,
+  11005, 65535, 10432, 65535, 12973, 65535, 13541, 65535, 13552, 65535, 15406, 65535, 18316, 65535, 18385, 65535,
+  9845, 65535, 65535, 11426, 12214, 65535, 65535, 13360, 14813, 65535, 65535, 16203, 17216, 65535, 65535, 8803,
+  65535, 308, 6775, 65535, 65535, 5292, 4321, 65535, 65535, 2416, 1392, 65535, 10237, 65535, 12448, 65535,
+  13226, 65535, 17962, 65535, 65535, 5725, 4992, 65535, 65535, 6042, 7972, 65535, 65535, 2305, 65535, 65535,
+  65535, 11230, 65535, 11007, 65535, 13482, 65535, 13926, 65535, 14000, 65535, 15631, 65535, 19003, 65535, 18869,
+  // B9
+  9621, 65535, 10181, 65535, 7289, 65535, 8058, 65535, 8327, 65535, 3475, 65535, 4898, 65535, 5814, 65535,
+  7276, 65535, 7585, 65535, 8503, 65535, 6172, 65535, 0, 65535, 548, 65535, 1331, 65535, 2588, 65535,
+  2984, 65535, 4281, 65535, 5340, 65535, 5601, 65535, 1641, 65535, 2204, 65535, 2275, 65535, 2994, 65535,
+  65535, 5657, 65535, 4521, 5660, 65535, 6451, 65535, 65535, 65535, 6456, 65535, 65535, 65535, 65535, 65535,
+  10252, 65535, 9679, 65535, 8319, 65535, 8887, 65535, 8898, 65535, 4780, 65535, 7690, 65535, 7759, 65535,
+  9092, 65535, 65535, 6772, 7560, 65535, 65535, 2734, 4187, 65535, 65535, 5577, 6590, 65535, 65535, 8050,
+  5864, 65535, 65535, 6761, 880, 65535, 65535, 1851, 3756, 65535, 65535, 4780, 9484, 65535, 7794, 65535,
+  8572, 65535, 7336, 65535, 1882, 65535, 65535, 2615, 5050, 65535, 65535, 6019, 65535, 65535, 65535, 65535,
+  65535, 10477, 65535, 10254, 65535, 8828, 65535, 9272, 65535, 9346, 65535, 5005, 65535, 8377, 65535, 8243,
+  // B10
+  4202, 65535, 4762, 65535, 5771, 65535, 6540, 65535, 6809, 65535, 7929, 65535, 9352, 65535, 10268, 65535,
+  11730, 65535, 12039, 65535, 3084, 65535, 65535, 1192, 65535, 0, 65535, 6816, 65535, 6033, 65535, 4776,
+  65535, 4380, 65535, 3083, 65535, 2024, 65535, 1763, 65535, 7158, 65535, 65535, 65535, 6524, 65535, 5805,
+  6627, 65535, 3298, 65535, 65535, 2159, 65535, 1368, 2031, 65535, 65535, 65535, 3176, 65535, 65535, 65535,
+  4833, 65535, 4260, 65535, 6801, 65535, 7369, 65535, 7380, 65535, 9234, 65535, 12144, 65535, 12213, 65535,
+  3673, 65535, 65535, 5254, 6042, 65535, 65535, 7188, 8641, 65535, 65535, 10031, 11044, 65535, 65535, 2631,
+  65535, 1500, 603, 65535, 65535, 6484, 5513, 65535, 65535, 3608, 2584, 65535, 4065, 65535, 6276, 65535,
+  7054, 65535, 11790, 65535, 65535, 6917, 6184, 65535, 65535, 2769, 1800, 65535, 65535, 3497, 65535, 65535,
+  65535, 5058, 65535, 4835, 65535, 7310, 65535, 7754, 65535, 7828, 65535, 9459, 65535, 12831, 65535, 12697,
+  // B11
+  9073, 65535, 9633, 65535, 6741, 65535, 7510, 65535, 7779, 65535, 2927, 65535, 4350, 65535, 5266, 65535,
+  6728, 65535, 7037, 65535, 7955, 65535, 5624, 65535, 6816, 65535, 0, 65535, 783, 65535, 2040, 65535,
+  2436, 65535, 3733, 65535, 4792, 65535, 5053, 65535, 1093, 65535, 1656, 65535, 1727, 65535, 2446, 65535,
+  65535, 5109, 65535, 3973, 5112, 65535, 5903, 65535, 65535, 65535, 5908, 65535, 65535, 65535, 65535, 65535,
+  9704, 65535, 9131, 65535, 7771, 65535, 8339, 65535, 8350, 65535, 4232, 65535, 7142, 65535, 7211, 65535,
+  8544, 65535, 65535, 6224, 7012, 65535, 65535, 2186, 3639, 65535, 65535, 5029, 6042, 65535, 65535, 7502,
+  5316, 65535, 65535, 6213, 332, 65535, 65535, 1303, 3208, 65535, 65535, 4232, 8936, 65535, 7246, 65535,
+  8024, 65535, 6788, 65535, 1334, 65535, 65535, 2067, 4502, 65535, 65535, 5471, 65535, 65535, 65535, 65535,
+  65535, 9929, 65535, 9706, 65535, 8280, 65535, 8724, 65535, 8798, 65535, 4457, 65535, 7829, 65535, 7695,
+  // B12
+  4750, 65535, 5310, 65535, 6319, 65535, 7088, 65535, 7357, 65535, 8477, 65535, 9900, 65535, 10816, 65535,
+  12278, 65535, 12587, 65535, 3632, 65535, 65535, 1740, 65535, 548, 65535, 0, 65535, 6581, 65535, 5324,
+  65535, 4928, 65535, 3631, 65535, 2572, 65535, 2311, 65535, 7706, 65535, 65535, 65535, 7072, 65535, 6353,
+  7175, 65535, 3846, 65535, 65535, 2707, 65535, 1916, 2579, 65535, 65535, 65535, 3724, 65535, 65535, 65535,
+  5381, 65535, 4808, 65535, 7349, 65535, 7917, 65535, 7928, 65535, 9782, 65535, 12692, 65535, 12761, 65535,
+  4221, 65535, 65535, 5802, 6590, 65535, 65535, 7736, 9189, 65535, 65535, 10579, 11592, 65535, 65535, 3179,
+  65535, 2048, 1151, 65535, 65535, 7032, 6061, 65535, 65535, 4156, 3132, 65535, 4613, 65535, 6824, 65535,
+  7602, 65535, 12338, 65535, 65535, 7465, 6732, 65535, 65535, 3317, 2348, 65535, 65535, 4045, 65535, 65535,
+  65535, 5606, 65535, 5383, 65535, 7858, 65535, 8302, 65535, 8376, 65535, 10007, 65535, 13379, 65535, 13245,
+  // B13
+  14262, 65535, 14822, 65535, 5958, 65535, 6727, 65535, 6996, 65535, 8116, 65535, 9539, 65535, 10455, 65535,
+  11917, 65535, 12226, 65535, 13144, 65535, 4841, 65535, 6033, 65535, 6581, 65535, 0, 65535, 1257, 65535,
+  1653, 65535, 2950, 65535, 4009, 65535, 4270, 65535, 7674, 65535, 8237, 65535, 8308, 65535, 5148, 65535,
+  65535, 4326, 65535, 3190, 4329, 65535, 5120, 65535, 65535, 65535, 5125, 65535, 65535, 65535, 65535, 65535,
+  14893, 65535, 14320, 65535, 6988, 65535, 7556, 65535, 7567, 65535, 9421, 65535, 12331, 65535, 12400, 65535,
+  13733, 65535, 65535, 5441, 6229, 65535, 65535, 7375, 8828, 65535, 65535, 10218, 11231, 65535, 65535, 12691,
+  4533, 65535, 65535, 5430, 6913, 65535, 65535, 520, 2425, 65535, 65535, 3449, 14125, 65535, 6463, 65535,
+  7241, 65535, 11977, 65535, 7915, 65535, 65535, 4769, 3719, 65535, 65535, 4688, 65535, 65535, 65535, 65535,
+  65535, 15118, 65535, 14895, 65535, 7497, 65535, 7941, 65535, 8015, 65535, 9646, 65535, 13018, 65535, 12884,
+  // B14
+  5533, 65535, 6093, 65535, 7102, 65535, 7871, 65535, 8140, 65535, 9260, 65535, 10683, 65535, 11599, 65535,
+  13061, 65535, 13370, 65535, 4415, 65535, 65535, 2523, 65535, 1331, 65535, 783, 65535, 0, 65535, 6107,
+  65535, 5711, 65535, 4414, 65535, 3355, 65535, 3094, 65535, 8489, 65535, 65535, 65535, 7855, 65535, 7136,
+  7958, 65535, 4629, 65535, 65535, 3490, 65535, 2699, 3362, 65535, 65535, 65535, 4507, 65535, 65535, 65535,
+  6164, 65535, 5591, 65535, 8132, 65535, 8700, 65535, 8711, 65535, 10565, 65535, 13475, 65535, 13544, 65535,
+  5004, 65535, 65535, 6585, 7373, 65535, 65535, 8519, 9972, 65535, 65535, 11362, 12375, 65535, 65535, 3962,
+  65535, 2831, 1934, 65535, 65535, 451, 6844, 65535, 65535, 4939, 3915, 65535, 5396, 65535, 7607, 65535,
+  8385, 65535, 13121, 65535, 65535, 8248, 7515, 65535, 65535, 4100, 3131, 65535, 65535, 4828, 65535, 65535,
+  65535, 6389, 65535, 6166, 65535, 8641, 65535, 9085, 65535, 9159, 65535, 10790, 65535, 14162, 65535, 14028,
+  // B15
+  13005, 65535, 13565, 65535, 4701, 65535, 5470, 65535, 5739, 65535, 6859, 65535, 8282, 65535, 9198, 65535,
+  10660, 65535, 10969, 65535, 11887, 65535, 3584, 65535, 4776, 65535, 5324, 65535, 6107, 65535, 0, 65535,
+  396, 65535, 1693, 65535, 2752, 65535, 3013, 65535, 6417, 65535, 6980, 65535, 7051, 65535, 3891, 65535,
+  65535, 3069, 65535, 1933, 3072, 65535, 3863, 65535, 65535, 65535, 3868, 65535, 65535, 65535, 65535, 65535,
+  13636, 65535, 13063, 65535, 5731, 65535, 6299, 65535, 6310, 65535, 8164, 65535, 11074, 65535, 11143, 65535,
+  12476, 65535, 65535, 4184, 4972, 65535, 65535, 6118, 7571, 65535, 65535, 8961, 9974, 65535, 65535, 11434,
+  3276, 65535, 65535, 4173, 5656, 65535, 65535, 4183, 1168, 65535, 65535, 2192, 12868, 65535, 5206, 65535,
+  5984, 65535, 10720, 65535, 6658, 65535, 65535, 3512, 2462, 65535, 65535, 3431, 65535, 65535, 65535, 65535,
+  65535, 13861, 65535, 13638, 65535, 6240, 65535, 6684, 65535, 6758, 65535, 8389, 65535, 11761, 65535, 11627,
+  // B16
+  6790, 65535, 7350, 65535, 8359, 65535, 9128, 65535, 9397, 65535, 10517, 65535, 11940, 65535, 12856, 65535,
+  14318, 65535, 14627, 65535, 5672, 65535, 65535, 3780, 65535, 2588, 65535, 2040, 65535, 1257, 65535, 0,
+  65535, 4524, 65535, 5671, 65535, 4612, 65535, 4351, 65535, 2382, 65535, 65535, 65535, 1748, 65535, 1029,
+  1851, 65535, 2987, 65535, 65535, 4747, 65535, 3956, 4619, 65535, 65535, 65535, 5764, 65535, 65535, 65535,
+  7421, 65535, 6848, 65535, 9389, 65535, 9957, 65535, 9968, 65535, 11822, 65535, 14732, 65535, 14801, 65535,
+  6261, 65535, 65535, 7842, 8630, 65535, 65535, 9776, 11229, 65535, 65535, 12619, 13632, 65535, 65535, 5219,
+  65535, 4088, 3191, 65535, 65535, 1708, 737, 65535, 65535, 3752, 5172, 65535, 6653, 65535, 8864, 65535,
+  9642, 65535, 14378, 65535, 65535, 2141, 1408, 65535, 65535, 2458, 4388, 65535, 65535, 6085, 65535, 65535,
+  65535, 7646, 65535, 7423, 65535, 9898, 65535, 10342, 65535, 10416, 65535, 12047, 65535, 15419, 65535, 15285,
+  // C1
+  12609, 65535, 13169, 65535, 4305, 65535, 5074, 65535, 5343, 65535, 6463, 65535, 7886, 65535, 8802, 65535,
+  10264, 65535, 10573, 65535, 11491, 65535, 3188, 65535, 4380, 65535, 4928, 65535, 5711, 65535, 4524, 65535,
+  0, 65535, 1297, 65535, 2356, 65535, 2617, 65535, 6021, 65535, 6584, 65535, 6655, 65535, 3495, 65535,
+  65535, 2673, 65535, 1537, 2676, 65535, 3467, 65535, 65535, 65535, 3472, 65535, 65535, 65535, 65535, 65535,
+  13240, 65535, 12667, 65535, 5335, 65535, 5903, 65535, 5914, 65535, 7768, 65535, 10678, 65535, 10747, 65535,
+  12080, 65535, 65535, 3788, 4576, 65535, 65535, 5722, 7175, 65535, 65535, 8565, 9578, 65535, 65535, 11038,
+  2880, 65535, 65535, 3777, 5260, 65535, 65535, 3787, 772, 65535, 65535, 1796, 12472, 65535, 4810, 65535,
+  5588, 65535, 10324, 65535, 6262, 65535, 65535, 3116, 2066, 65535, 65535, 3035, 65535, 65535, 65535, 65535,
+  65535, 13465, 65535, 13242, 65535, 5844, 65535, 6288, 65535, 6362, 65535, 7993, 65535, 11365, 65535, 11231,
+  // C2
+  7186, 65535, 7746, 65535, 8755, 65535, 9524, 65535, 9793, 65535, 10913, 65535, 12336, 65535, 13252, 65535,
+  14714, 65535, 15023, 65535, 6068, 65535, 65535, 4176, 65535, 2984, 65535, 2436, 65535, 1653, 65535, 396,
+  65535, 0, 65535, 6067, 65535, 5008, 65535, 4747, 65535, 2778, 65535, 65535, 65535, 2144, 65535, 1425,
+  2247, 65535, 3383, 65535, 65535, 5143, 65535, 4352, 5015, 65535, 65535, 65535, 6160, 65535, 65535, 65535,
+  7817, 65535, 7244, 65535, 9785, 65535, 10353, 65535, 10364, 65535, 12218, 65535, 15128, 65535, 15197, 65535,
+  6657, 65535, 65535, 8238, 9026, 65535, 65535, 10172, 11625, 65535, 65535, 13015, 14028, 65535, 65535, 5615,
+  65535, 4484, 3587, 65535, 65535, 2104, 1133, 65535, 65535, 4148, 5568, 65535, 7049, 65535, 9260, 65535,
+  10038, 65535, 14774, 65535, 65535, 2537, 1804, 65535, 65535, 2854, 4784, 65535, 65535, 6481, 65535, 65535,
+  65535, 8042, 65535, 7819, 65535, 10294, 65535, 10738, 65535, 10812, 65535, 12443, 65535, 15815, 65535, 15681,
+  // C3
+  11312, 65535, 11872, 65535, 3008, 65535, 3777, 65535, 4046, 65535, 5166, 65535, 6589, 65535, 7505, 65535,
+  8967, 65535, 9276, 65535, 10194, 65535, 1891, 65535, 3083, 65535, 3631, 65535, 4414, 65535, 5671, 65535,
+  6067, 65535, 0, 65535, 1059, 65535, 1320, 65535, 4724, 65535, 5287, 65535, 5358, 65535, 6077, 65535,
+  65535, 8740, 65535, 7604, 8743, 65535, 9534, 65535, 65535, 65535, 2175, 65535, 65535, 65535, 65535, 65535,
+  11943, 65535, 11370, 65535, 4038, 65535, 4606, 65535, 4617, 65535, 6471, 65535, 9381, 65535, 9450, 65535,
+  10783, 65535, 65535, 2491, 3279, 65535, 65535, 4425, 5878, 65535, 65535, 7268, 8281, 65535, 65535, 9741,
+  1583, 65535, 65535, 2480, 3963, 65535, 65535, 4934, 6839, 65535, 65535, 499, 11175, 65535, 3513, 65535,
+  4291, 65535, 9027, 65535, 4965, 65535, 65535, 5698, 8133, 65535, 65535, 9102, 65535, 65535, 65535, 65535,
+  65535, 12168, 65535, 11945, 65535, 4547, 65535, 4991, 65535, 5065, 65535, 6696, 65535, 10068, 65535, 9934,
+  // C4
+  8483, 65535, 9043, 65535, 10052, 65535, 10821, 65535, 11090, 65535, 12210, 65535, 13633, 65535, 14549, 65535,
+  16011, 65535, 16320, 65535, 7365, 65535, 65535, 5473, 65535, 4281, 65535, 3733, 65535, 2950, 65535, 1693,
+  65535, 1297, 65535, 0, 65535, 6305, 65535, 6044, 65535, 4075, 65535, 65535, 65535, 3441, 65535, 2722,
+  3544, 65535, 4680, 65535, 65535, 6440, 65535, 5649, 6312, 65535, 65535, 65535, 7457, 65535, 65535, 65535,
+  9114, 65535, 8541, 65535, 11082, 65535, 11650, 65535, 11661, 65535, 13515, 65535, 16425, 65535, 16494, 65535,
+  7954, 65535, 65535, 9535, 10323, 65535, 65535, 11469, 12922, 65535, 65535, 14312, 15325, 65535, 65535, 6912,
+  65535, 5781, 4884, 65535, 65535, 3401, 2430, 65535, 65535, 525, 6865, 65535, 8346, 65535, 10557, 65535,
+  11335, 65535, 16071, 65535, 65535, 3834, 3101, 65535, 65535, 4151, 6081, 65535, 65535, 7778, 65535, 65535,
+  65535, 9339, 65535, 9116, 65535, 11591, 65535, 12035, 65535, 12109, 65535, 13740, 65535, 17112, 65535, 16978,
+  // C5
+  10253, 65535, 10813, 65535, 1949, 65535, 2718, 65535, 2987, 65535, 4107, 65535, 5530, 65535, 6446, 65535,
+  7908, 65535, 8217, 65535, 9135, 65535, 832, 65535, 2024, 65535, 2572, 65535, 3355, 65535, 4612, 65535,
+  5008, 65535, 6305, 65535, 0, 65535, 261, 65535, 3665, 65535, 4228, 65535, 4299, 65535, 5018, 65535,
+  65535, 7681, 65535, 6545, 7684, 65535, 8475, 65535, 65535, 65535, 1116, 65535, 65535, 65535, 65535, 65535,
+  10884, 65535, 10311, 65535, 2979, 65535, 3547, 65535, 3558, 65535, 5412, 65535, 8322, 65535, 8391, 65535,
+  9724, 65535, 65535, 1432, 2220, 65535, 65535, 3366, 4819, 65535, 65535, 6209, 7222, 65535, 65535, 8682,
+  524, 65535, 65535, 1421, 2904, 65535, 65535, 3875, 5780, 65535, 65535, 6804, 10116, 65535, 2454, 65535,
+  3232, 65535, 7968, 65535, 3906, 65535, 65535, 4639, 7074, 65535, 65535, 8043, 65535, 65535, 65535, 65535,
+  65535, 11109, 65535, 10886, 65535, 3488, 65535, 3932, 65535, 4006, 65535, 5637, 65535, 9009, 65535, 8875,
+  // C6
+  9542, 65535, 10102, 65535, 11111, 65535, 11880, 65535, 12149, 65535, 13269, 65535, 14692, 65535, 15608, 65535,
+  17070, 65535, 17379, 65535, 8424, 65535, 65535, 6532, 65535, 5340, 65535, 4792, 65535, 4009, 65535, 2752,
+  65535, 2356, 65535, 1059, 65535, 0, 65535, 7103, 65535, 5134, 65535, 65535, 65535, 4500, 65535, 3781,
+  4603, 65535, 5739, 65535, 65535, 7499, 65535, 6708, 7371, 65535, 65535, 65535, 1152, 65535, 65535, 65535,
+  10173, 65535, 9600, 65535, 12141, 65535, 12709, 65535, 12720, 65535, 14574, 65535, 17484, 65535, 17553, 65535,
+  9013, 65535, 65535, 10594, 11382, 65535, 65535, 12528, 13981, 65535, 65535, 15371, 16384, 65535, 65535, 7971,
+  65535, 6840, 5943, 65535, 65535, 4460, 3489, 65535, 65535, 1584, 560, 65535, 9405, 65535, 11616, 65535,
+  12394, 65535, 17130, 65535, 65535, 4893, 4160, 65535, 65535, 5210, 7140, 65535, 65535, 1473, 65535, 65535,
+  65535, 10398, 65535, 10175, 65535, 12650, 65535, 13094, 65535, 13168, 65535, 14799, 65535, 18171, 65535, 18037,
+  // C7
+  9992, 65535, 10552, 65535, 1688, 65535, 2457, 65535, 2726, 65535, 3846, 65535, 5269, 65535, 6185, 65535,
+  7647, 65535, 7956, 65535, 8874, 65535, 571, 65535, 1763, 65535, 2311, 65535, 3094, 65535, 4351, 65535,
+  4747, 65535, 6044, 65535, 7103, 65535, 0, 65535, 3404, 65535, 3967, 65535, 4038, 65535, 4757, 65535,
+  65535, 7420, 65535, 6284, 7423, 65535, 8214, 65535, 65535, 65535, 855, 65535, 65535, 65535, 65535, 65535,
+  10623, 65535, 10050, 65535, 2718, 65535, 3286, 65535, 3297, 65535, 5151, 65535, 8061, 65535, 8130, 65535,
+  9463, 65535, 65535, 1171, 1959, 65535, 65535, 3105, 4558, 65535, 65535, 5948, 6961, 65535, 65535, 8421,
+  263, 65535, 65535, 1160, 2643, 65535, 65535, 3614, 5519, 65535, 65535, 6543, 9855, 65535, 2193, 65535,
+  2971, 65535, 7707, 65535, 3645, 65535, 65535, 4378, 6813, 65535, 65535, 7782, 65535, 65535, 65535, 65535,
+  65535, 10848, 65535, 10625, 65535, 3227, 65535, 3671, 65535, 3745, 65535, 5376, 65535, 8748, 65535, 8614,
+  // C8
+  9803, 65535, 10363, 65535, 11372, 65535, 12141, 65535, 12410, 65535, 13530, 65535, 14953, 65535, 15869, 65535,
+  17331, 65535, 17640, 65535, 8685, 65535, 65535, 6793, 65535, 5601, 65535, 5053, 65535, 4270, 65535, 3013,
+  65535, 2617, 65535, 1320, 65535, 261, 65535, 0, 65535, 5395, 65535, 65535, 65535, 4761, 65535, 4042,
+  4864, 65535, 6000, 65535, 65535, 7760, 65535, 6969, 7632, 65535, 65535, 65535, 1413, 65535, 65535, 65535,
+  10434, 65535, 9861, 65535, 12402, 65535, 12970, 65535, 12981, 65535, 14835, 65535, 17745, 65535, 17814, 65535,
+  9274, 65535, 65535, 10855, 11643, 65535, 65535, 12789, 14242, 65535, 65535, 15632, 16645, 65535, 65535, 8232,
+  65535, 7101, 6204, 65535, 65535, 4721, 3750, 65535, 65535, 1845, 821, 65535, 9666, 65535, 11877, 65535,
+  12655, 65535, 17391, 65535, 65535, 5154, 4421, 65535, 65535, 5471, 7401, 65535, 65535, 1734, 65535, 65535,
+  65535, 10659, 65535, 10436, 65535, 12911, 65535, 13355, 65535, 13429, 65535, 15060, 65535, 18432, 65535, 18298,
+  // C9
+  7980, 65535, 8540, 65535, 7083, 65535, 7852, 65535, 8121, 65535, 1834, 65535, 3257, 65535, 4173, 65535,
+  5635, 65535, 5944, 65535, 6862, 65535, 5966, 65535, 7158, 65535, 7706, 65535, 8489, 65535, 2382, 65535,
+  2778, 65535, 4075, 65535, 5134, 65535, 5395, 65535, 0, 65535, 563, 65535, 634, 65535, 1353, 65535,
+  65535, 5451, 65535, 4315, 5454, 65535, 6245, 65535, 65535, 65535, 6250, 65535, 65535, 65535, 65535, 65535,
+  8611, 65535, 8038, 65535, 8113, 65535, 8681, 65535, 8692, 65535, 3139, 65535, 6049, 65535, 6118, 65535,
+  7451, 65535, 65535, 6566, 7354, 65535, 65535, 1093, 2546, 65535, 65535, 3936, 4949, 65535, 65535, 6409,
+  5658, 65535, 65535, 6555, 8038, 65535, 65535, 1645, 3550, 65535, 65535, 4574, 7843, 65535, 7588, 65535,
+  8366, 65535, 5695, 65535, 241, 65535, 65535, 974, 4844, 65535, 65535, 5813, 65535, 65535, 65535, 65535,
+  65535, 8836, 65535, 8613, 65535, 8622, 65535, 9066, 65535, 9140, 65535, 3364, 65535, 6736, 65535, 6602,
+  // C10
+  5843, 65535, 6403, 65535, 7412, 65535, 8181, 65535, 8450, 65535, 9570, 65535, 10993, 65535, 11909, 65535,
+  13371, 65535, 13680, 65535, 4725, 65535, 65535, 2833, 65535, 1641, 65535, 1093, 65535, 7674, 65535, 6417,
+  65535, 6021, 65535, 4724, 65535, 3665, 65535, 3404, 65535, 0, 65535, 65535, 65535, 8165, 65535, 7446,
+  8268, 65535, 4939, 65535, 65535, 3800, 65535, 3009, 3672, 65535, 65535, 65535, 4817, 65535, 65535, 65535,
+  6474, 65535, 5901, 65535, 8442, 65535, 9010, 65535, 9021, 65535, 10875, 65535, 13785, 65535, 13854, 65535,
+  5314, 65535, 65535, 6895, 7683, 65535, 65535, 8829, 10282, 65535, 65535, 11672, 12685, 65535, 65535, 4272,
+  65535, 3141, 2244, 65535, 65535, 761, 7154, 65535, 65535, 5249, 4225, 65535, 5706, 65535, 7917, 65535,
+  8695, 65535, 13431, 65535, 65535, 8558, 7825, 65535, 65535, 4410, 3441, 65535, 65535, 5138, 65535, 65535,
+  65535, 6699, 65535, 6476, 65535, 8951, 65535, 9395, 65535, 9469, 65535, 11100, 65535, 14472, 65535, 14338,
+  // C11
+  7417, 65535, 7977, 65535, 8986, 65535, 9755, 65535, 10024, 65535, 1271, 65535, 2694, 65535, 3610, 65535,
+  5072, 65535, 5381, 65535, 6299, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  8048, 65535, 7475, 65535, 10016, 65535, 10584, 65535, 10595, 65535, 2576, 65535, 5486, 65535, 5555, 65535,
+  6888, 65535, 65535, 8469, 9257, 65535, 65535, 530, 1983, 65535, 65535, 3373, 4386, 65535, 65535, 5846,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 7280, 65535, 9491, 65535,
+  10269, 65535, 5132, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 8273, 65535, 8050, 65535, 10525, 65535, 10969, 65535, 11043, 65535, 2801, 65535, 6173, 65535, 6039,
+  // C12
+  6406, 65535, 6966, 65535, 7975, 65535, 8744, 65535, 9013, 65535, 10133, 65535, 11556, 65535, 12472, 65535,
+  13934, 65535, 14243, 65535, 5288, 65535, 65535, 3396, 65535, 2204, 65535, 1656, 65535, 8237, 65535, 6980,
+  65535, 6584, 65535, 5287, 65535, 4228, 65535, 3967, 65535, 563, 65535, 0, 65535, 8728, 65535, 8009,
+  8831, 65535, 5502, 65535, 65535, 4363, 65535, 3572, 4235, 65535, 65535, 65535, 5380, 65535, 65535, 65535,
+  7037, 65535, 6464, 65535, 9005, 65535, 9573, 65535, 9584, 65535, 11438, 65535, 14348, 65535, 14417, 65535,
+  5877, 65535, 65535, 7458, 8246, 65535, 65535, 9392, 10845, 65535, 65535, 12235, 13248, 65535, 65535, 4835,
+  65535, 3704, 2807, 65535, 65535, 1324, 7717, 65535, 65535, 5812, 4788, 65535, 6269, 65535, 8480, 65535,
+  9258, 65535, 13994, 65535, 65535, 322, 8388, 65535, 65535, 4973, 4004, 65535, 65535, 5701, 65535, 65535,
+  65535, 7262, 65535, 7039, 65535, 9514, 65535, 9958, 65535, 10032, 65535, 11663, 65535, 15035, 65535, 14901,
+  // C13
+  14753, 65535, 15313, 65535, 6449, 65535, 7218, 65535, 7487, 65535, 8607, 65535, 10030, 65535, 10946, 65535,
+  12408, 65535, 12717, 65535, 13635, 65535, 5332, 65535, 6524, 65535, 7072, 65535, 7855, 65535, 1748, 65535,
+  2144, 65535, 3441, 65535, 4500, 65535, 4761, 65535, 8165, 65535, 8728, 65535, 0, 65535, 719, 65535,
+  65535, 4817, 65535, 3681, 4820, 65535, 5611, 65535, 65535, 65535, 5616, 65535, 65535, 65535, 65535, 65535,
+  15384, 65535, 14811, 65535, 7479, 65535, 8047, 65535, 8058, 65535, 9912, 65535, 12822, 65535, 12891, 65535,
+  14224, 65535, 65535, 5932, 6720, 65535, 65535, 7866, 9319, 65535, 65535, 10709, 11722, 65535, 65535, 13182,
+  5024, 65535, 65535, 5921, 7404, 65535, 65535, 1011, 2916, 65535, 65535, 3940, 14616, 65535, 6954, 65535,
+  7732, 65535, 12468, 65535, 8406, 65535, 65535, 340, 4210, 65535, 65535, 5179, 65535, 65535, 65535, 65535,
+  65535, 15609, 65535, 15386, 65535, 7988, 65535, 8432, 65535, 8506, 65535, 10137, 65535, 13509, 65535, 13375,
+  // C14
+  6477, 65535, 7037, 65535, 8046, 65535, 8815, 65535, 9084, 65535, 10204, 65535, 11627, 65535, 12543, 65535,
+  14005, 65535, 14314, 65535, 5359, 65535, 65535, 3467, 65535, 2275, 65535, 1727, 65535, 8308, 65535, 7051,
+  65535, 6655, 65535, 5358, 65535, 4299, 65535, 4038, 65535, 634, 65535, 65535, 65535, 0, 65535, 8080,
+  8902, 65535, 5573, 65535, 65535, 4434, 65535, 3643, 4306, 65535, 65535, 65535, 5451, 65535, 65535, 65535,
+  7108, 65535, 6535, 65535, 9076, 65535, 9644, 65535, 9655, 65535, 11509, 65535, 14419, 65535, 14488, 65535,
+  5948, 65535, 65535, 7529, 8317, 65535, 65535, 9463, 10916, 65535, 65535, 12306, 13319, 65535, 65535, 4906,
+  65535, 3775, 2878, 65535, 65535, 1395, 7788, 65535, 65535, 5883, 4859, 65535, 6340, 65535, 8551, 65535,
+  9329, 65535, 14065, 65535, 65535, 393, 8459, 65535, 65535, 5044, 4075, 65535, 65535, 5772, 65535, 65535,
+  65535, 7333, 65535, 7110, 65535, 9585, 65535, 10029, 65535, 10103, 65535, 11734, 65535, 15106, 65535, 14972,
+  // C15
+  14034, 65535, 14594, 65535, 5730, 65535, 6499, 65535, 6768, 65535, 7888, 65535, 9311, 65535, 10227, 65535,
+  11689, 65535, 11998, 65535, 12916, 65535, 4613, 65535, 5805, 65535, 6353, 65535, 7136, 65535, 1029, 65535,
+  1425, 65535, 2722, 65535, 3781, 65535, 4042, 65535, 7446, 65535, 8009, 65535, 8080, 65535, 0, 65535,
+  65535, 4098, 65535, 2962, 4101, 65535, 4892, 65535, 65535, 65535, 4897, 65535, 65535, 65535, 65535, 65535,
+  14665, 65535, 14092, 65535, 6760, 65535, 7328, 65535, 7339, 65535, 9193, 65535, 12103, 65535, 12172, 65535,
+  13505, 65535, 65535, 5213, 6001, 65535, 65535, 7147, 8600, 65535, 65535, 9990, 11003, 65535, 65535, 12463,
+  4305, 65535, 65535, 5202, 6685, 65535, 65535, 292, 2197, 65535, 65535, 3221, 13897, 65535, 6235, 65535,
+  7013, 65535, 11749, 65535, 7687, 65535, 65535, 4541, 3491, 65535, 65535, 4460, 65535, 65535, 65535, 65535,
+  65535, 14890, 65535, 14667, 65535, 7269, 65535, 7713, 65535, 7787, 65535, 9418, 65535, 12790, 65535, 12656,
+  // C16
+  7196, 65535, 7756, 65535, 8765, 65535, 9534, 65535, 9803, 65535, 10923, 65535, 12346, 65535, 13262, 65535,
+  14724, 65535, 15033, 65535, 6078, 65535, 65535, 4186, 65535, 2994, 65535, 2446, 65535, 5148, 65535, 3891,
+  65535, 3495, 65535, 6077, 65535, 5018, 65535, 4757, 65535, 1353, 65535, 65535, 65535, 719, 65535, 0,
+  822, 65535, 1958, 65535, 65535, 5153, 65535, 4362, 5025, 65535, 65535, 65535, 6170, 65535, 65535, 65535,
+  7827, 65535, 7254, 65535, 9795, 65535, 10363, 65535, 10374, 65535, 12228, 65535, 15138, 65535, 15207, 65535,
+  6667, 65535, 65535, 8248, 9036, 65535, 65535, 10182, 11635, 65535, 65535, 13025, 14038, 65535, 65535, 5625,
+  65535, 4494, 3597, 65535, 65535, 2114, 4628, 65535, 65535, 2723, 5578, 65535, 7059, 65535, 9270, 65535,
+  10048, 65535, 14784, 65535, 65535, 1112, 379, 65535, 65535, 1429, 4794, 65535, 65535, 6491, 65535, 65535,
+  65535, 8052, 65535, 7829, 65535, 10304, 65535, 10748, 65535, 10822, 65535, 12453, 65535, 15825, 65535, 15691,
+  // D1
+  9859, 65535, 10419, 65535, 11428, 65535, 12197, 65535, 12466, 65535, 13586, 65535, 15009, 65535, 15925, 65535,
+  17387, 65535, 17696, 65535, 8741, 65535, 65535, 6849, 65535, 5657, 65535, 5109, 65535, 4326, 65535, 3069,
+  65535, 2673, 65535, 8740, 65535, 7681, 65535, 7420, 65535, 5451, 65535, 65535, 65535, 4817, 65535, 4098,
+  0, 65535, 1136, 65535, 65535, 7816, 65535, 7025, 7688, 65535, 65535, 65535, 8833, 65535, 65535, 65535,
+  10490, 65535, 9917, 65535, 12458, 65535, 13026, 65535, 13037, 65535, 14891, 65535, 17801, 65535, 17870, 65535,
+  9330, 65535, 65535, 10911, 11699, 65535, 65535, 12845, 14298, 65535, 65535, 15688, 16701, 65535, 65535, 8288,
+  65535, 7157, 6260, 65535, 65535, 4777, 3806, 65535, 65535, 1901, 8241, 65535, 9722, 65535, 11933, 65535,
+  12711, 65535, 17447, 65535, 65535, 5210, 4477, 65535, 65535, 607, 7457, 65535, 65535, 9154, 65535, 65535,
+  65535, 10715, 65535, 10492, 65535, 12967, 65535, 13411, 65535, 13485, 65535, 15116, 65535, 18488, 65535, 18354,
+  // D2
+  14856, 65535, 15416, 65535, 6552, 65535, 7321, 65535, 7590, 65535, 8710, 65535, 10133, 65535, 11049, 65535,
+  12511, 65535, 12820, 65535, 13738, 65535, 5435, 65535, 6627, 65535, 7175, 65535, 7958, 65535, 1851, 65535,
+  2247, 65535, 3544, 65535, 4603, 65535, 4864, 65535, 8268, 65535, 8831, 65535, 8902, 65535, 822, 65535,
+  65535, 0, 65535, 3784, 4923, 65535, 5714, 65535, 65535, 65535, 5719, 65535, 65535, 65535, 65535, 65535,
+  15487, 65535, 14914, 65535, 7582, 65535, 8150, 65535, 8161, 65535, 10015, 65535, 12925, 65535, 12994, 65535,
+  14327, 65535, 65535, 6035, 6823, 65535, 65535, 7969, 9422, 65535, 65535, 10812, 11825, 65535, 65535, 13285,
+  5127, 65535, 65535, 6024, 7507, 65535, 65535, 1114, 3019, 65535, 65535, 4043, 14719, 65535, 7057, 65535,
+  7835, 65535, 12571, 65535, 8509, 65535, 65535, 443, 4313, 65535, 65535, 5282, 65535, 65535, 65535, 65535,
+  65535, 15712, 65535, 15489, 65535, 8091, 65535, 8535, 65535, 8609, 65535, 10240, 65535, 13612, 65535, 13478,
+  // D3
+  8723, 65535, 9283, 65535, 10292, 65535, 11061, 65535, 11330, 65535, 12450, 65535, 13873, 65535, 14789, 65535,
+  16251, 65535, 16560, 65535, 7605, 65535, 65535, 5713, 65535, 4521, 65535, 3973, 65535, 3190, 65535, 1933,
+  65535, 1537, 65535, 7604, 65535, 6545, 65535, 6284, 65535, 4315, 65535, 65535, 65535, 3681, 65535, 2962,
+  3784, 65535, 0, 65535, 65535, 6680, 65535, 5889, 6552, 65535, 65535, 65535, 7697, 65535, 65535, 65535,
+  9354, 65535, 8781, 65535, 11322, 65535, 11890, 65535, 11901, 65535, 13755, 65535, 16665, 65535, 16734, 65535,
+  8194, 65535, 65535, 9775, 10563, 65535, 65535, 11709, 13162, 65535, 65535, 14552, 15565, 65535, 65535, 7152,
+  65535, 6021, 5124, 65535, 65535, 3641, 2670, 65535, 65535, 765, 7105, 65535, 8586, 65535, 10797, 65535,
+  11575, 65535, 16311, 65535, 65535, 4074, 3341, 65535, 65535, 4391, 6321, 65535, 65535, 8018, 65535, 65535,
+  65535, 9579, 65535, 9356, 65535, 11831, 65535, 12275, 65535, 12349, 65535, 13980, 65535, 17352, 65535, 17218,
+  // D4
+  12919, 65535, 13479, 65535, 7688, 65535, 8457, 65535, 8726, 65535, 6773, 65535, 8196, 65535, 9112, 65535,
+  10574, 65535, 10883, 65535, 11801, 65535, 6571, 65535, 3298, 65535, 3846, 65535, 4629, 65535, 2987, 65535,
+  3383, 65535, 4680, 65535, 5739, 65535, 6000, 65535, 4939, 65535, 5502, 65535, 5573, 65535, 1958, 65535,
+  65535, 1136, 65535, 0, 1139, 65535, 1930, 65535, 65535, 65535, 6855, 65535, 65535, 65535, 65535, 65535,
+  13550, 65535, 12977, 65535, 8718, 65535, 9286, 65535, 9297, 65535, 8078, 65535, 10988, 65535, 11057, 65535,
+  12390, 65535, 65535, 7171, 7959, 65535, 65535, 6032, 7485, 65535, 65535, 8875, 9888, 65535, 65535, 11348,
+  6263, 65535, 65535, 2695, 4178, 65535, 65535, 2250, 4155, 65535, 65535, 5179, 12782, 65535, 8193, 65535,
+  8971, 65535, 10634, 65535, 5180, 65535, 65535, 1579, 529, 65535, 65535, 1498, 65535, 65535, 65535, 65535,
+  65535, 13775, 65535, 13552, 65535, 9227, 65535, 9671, 65535, 9745, 65535, 8303, 65535, 11675, 65535, 11541,
+  // D5
+  11780, 65535, 12340, 65535, 9448, 65535, 10217, 65535, 10486, 65535, 5634, 65535, 7057, 65535, 7973, 65535,
+  9435, 65535, 9744, 65535, 10662, 65535, 8331, 65535, 2159, 65535, 2707, 65535, 3490, 65535, 4747, 65535,
+  5143, 65535, 6440, 65535, 7499, 65535, 7760, 65535, 3800, 65535, 4363, 65535, 4434, 65535, 5153, 65535,
+  65535, 7816, 65535, 6680, 0, 65535, 791, 65535, 65535, 65535, 8615, 65535, 65535, 65535, 65535, 65535,
+  12411, 65535, 11838, 65535, 10478, 65535, 11046, 65535, 11057, 65535, 6939, 65535, 9849, 65535, 9918, 65535,
+  11251, 65535, 65535, 8931, 9719, 65535, 65535, 4893, 6346, 65535, 65535, 7736, 8749, 65535, 65535, 10209,
+  8023, 65535, 65535, 1556, 3039, 65535, 65535, 4010, 5915, 65535, 65535, 6939, 11643, 65535, 9953, 65535,
+  10731, 65535, 9495, 65535, 4041, 65535, 65535, 4774, 7209, 65535, 65535, 359, 65535, 65535, 65535, 65535,
+  65535, 12636, 65535, 12413, 65535, 10987, 65535, 11431, 65535, 11505, 65535, 7164, 65535, 10536, 65535, 10402,
+  // D6
+  9862, 65535, 10422, 65535, 11431, 65535, 12200, 65535, 12469, 65535, 13589, 65535, 15012, 65535, 15928, 65535,
+  17390, 65535, 17699, 65535, 8744, 65535, 65535, 6852, 65535, 5660, 65535, 5112, 65535, 4329, 65535, 3072,
+  65535, 2676, 65535, 8743, 65535, 7684, 65535, 7423, 65535, 5454, 65535, 65535, 65535, 4820, 65535, 4101,
+  4923, 65535, 1139, 65535, 65535, 0, 65535, 7028, 7691, 65535, 65535, 65535, 8836, 65535, 65535, 65535,
+  10493, 65535, 9920, 65535, 12461, 65535, 13029, 65535, 13040, 65535, 14894, 65535, 17804, 65535, 17873, 65535,
+  9333, 65535, 65535, 10914, 11702, 65535, 65535, 12848, 14301, 65535, 65535, 15691, 16704, 65535, 65535, 8291,
+  65535, 7160, 6263, 65535, 65535, 4780, 3809, 65535, 65535, 1904, 8244, 65535, 9725, 65535, 11936, 65535,
+  12714, 65535, 17450, 65535, 65535, 5213, 4480, 65535, 65535, 610, 7460, 65535, 65535, 9157, 65535, 65535,
+  65535, 10718, 65535, 10495, 65535, 12970, 65535, 13414, 65535, 13488, 65535, 15119, 65535, 18491, 65535, 18357,
+  // D7
+  10989, 65535, 11549, 65535, 8657, 65535, 9426, 65535, 9695, 65535, 4843, 65535, 6266, 65535, 7182, 65535,
+  8644, 65535, 8953, 65535, 9871, 65535, 7540, 65535, 1368, 65535, 1916, 65535, 2699, 65535, 3956, 65535,
+  4352, 65535, 5649, 65535, 6708, 65535, 6969, 65535, 3009, 65535, 3572, 65535, 3643, 65535, 4362, 65535,
+  65535, 7025, 65535, 5889, 7028, 65535, 0, 65535, 65535, 65535, 7824, 65535, 65535, 65535, 65535, 65535,
+  11620, 65535, 11047, 65535, 9687, 65535, 10255, 65535, 10266, 65535, 6148, 65535, 9058, 65535, 9127, 65535,
+  10460, 65535, 65535, 8140, 8928, 65535, 65535, 4102, 5555, 65535, 65535, 6945, 7958, 65535, 65535, 9418,
+  7232, 65535, 65535, 765, 2248, 65535, 65535, 3219, 5124, 65535, 65535, 6148, 10852, 65535, 9162, 65535,
+  9940, 65535, 8704, 65535, 3250, 65535, 65535, 3983, 6418, 65535, 65535, 7387, 65535, 65535, 65535, 65535,
+  65535, 11845, 65535, 11622, 65535, 10196, 65535, 10640, 65535, 10714, 65535, 6373, 65535, 9745, 65535, 9611,
+  // D8
+  2834, 65535, 3394, 65535, 4403, 65535, 5172, 65535, 5441, 65535, 6561, 65535, 7984, 65535, 8900, 65535,
+  10362, 65535, 10671, 65535, 1716, 65535, 65535, 7643, 65535, 6451, 65535, 5903, 65535, 5120, 65535, 3863,
+  65535, 3467, 65535, 9534, 65535, 8475, 65535, 8214, 65535, 6245, 65535, 65535, 65535, 5611, 65535, 4892,
+  5714, 65535, 1930, 65535, 65535, 791, 65535, 0, 663, 65535, 65535, 65535, 9627, 65535, 65535, 65535,
+  3465, 65535, 2892, 65535, 5433, 65535, 6001, 65535, 6012, 65535, 7866, 65535, 10776, 65535, 10845, 65535,
+  2305, 65535, 65535, 3886, 4674, 65535, 65535, 5820, 7273, 65535, 65535, 8663, 9676, 65535, 65535, 1263,
+  65535, 7951, 7054, 65535, 65535, 5571, 4600, 65535, 65535, 2695, 9035, 65535, 2697, 65535, 4908, 65535,
+  5686, 65535, 10422, 65535, 65535, 6004, 5271, 65535, 65535, 1401, 432, 65535, 65535, 9948, 65535, 65535,
+  65535, 3690, 65535, 3467, 65535, 5942, 65535, 6386, 65535, 6460, 65535, 8091, 65535, 11463, 65535, 11329,
+  // D9
+  2171, 65535, 2731, 65535, 3740, 65535, 4509, 65535, 4778, 65535, 5898, 65535, 7321, 65535, 8237, 65535,
+  9699, 65535, 10008, 65535, 1053, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  2802, 65535, 2229, 65535, 4770, 65535, 5338, 65535, 5349, 65535, 7203, 65535, 10113, 65535, 10182, 65535,
+  1642, 65535, 65535, 3223, 4011, 65535, 65535, 5157, 6610, 65535, 65535, 8000, 9013, 65535, 65535, 600,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2034, 65535, 4245, 65535,
+  5023, 65535, 9759, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 3027, 65535, 2804, 65535, 5279, 65535, 5723, 65535, 5797, 65535, 7428, 65535, 10800, 65535, 10666,
+  // D10
+  11652, 65535, 12212, 65535, 9320, 65535, 10089, 65535, 10358, 65535, 5506, 65535, 6929, 65535, 7845, 65535,
+  9307, 65535, 9616, 65535, 10534, 65535, 8203, 65535, 2031, 65535, 2579, 65535, 3362, 65535, 4619, 65535,
+  5015, 65535, 6312, 65535, 7371, 65535, 7632, 65535, 3672, 65535, 4235, 65535, 4306, 65535, 5025, 65535,
+  65535, 7688, 65535, 6552, 7691, 65535, 663, 65535, 65535, 0, 8487, 65535, 65535, 65535, 65535, 65535,
+  12283, 65535, 11710, 65535, 10350, 65535, 10918, 65535, 10929, 65535, 6811, 65535, 9721, 65535, 9790, 65535,
+  11123, 65535, 65535, 8803, 9591, 65535, 65535, 4765, 6218, 65535, 65535, 7608, 8621, 65535, 65535, 10081,
+  7895, 65535, 65535, 1428, 2911, 65535, 65535, 3882, 5787, 65535, 65535, 6811, 11515, 65535, 9825, 65535,
+  10603, 65535, 9367, 65535, 3913, 65535, 65535, 4646, 7081, 65535, 65535, 231, 65535, 65535, 65535, 65535,
+  65535, 12508, 65535, 12285, 65535, 10859, 65535, 11303, 65535, 11377, 65535, 7036, 65535, 10408, 65535, 10274,
+  // D11
+  9137, 65535, 9697, 65535, 833, 65535, 1602, 65535, 1871, 65535, 2991, 65535, 4414, 65535, 5330, 65535,
+  6792, 65535, 7101, 65535, 8019, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 65535, 65535, 65535, 65535, 65535,
+  9768, 65535, 9195, 65535, 1863, 65535, 2431, 65535, 2442, 65535, 4296, 65535, 7206, 65535, 7275, 65535,
+  8608, 65535, 65535, 316, 1104, 65535, 65535, 2250, 3703, 65535, 65535, 5093, 6106, 65535, 65535, 7566,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 9000, 65535, 1338, 65535,
+  2116, 65535, 6852, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 9993, 65535, 9770, 65535, 2372, 65535, 2816, 65535, 2890, 65535, 4521, 65535, 7893, 65535, 7759,
+  // D12
+  10658, 65535, 11218, 65535, 12227, 65535, 12996, 65535, 13265, 65535, 14385, 65535, 15808, 65535, 16724, 65535,
+  18186, 65535, 18495, 65535, 9540, 65535, 65535, 7648, 65535, 6456, 65535, 5908, 65535, 5125, 65535, 3868,
+  65535, 3472, 65535, 2175, 65535, 1116, 65535, 855, 65535, 6250, 65535, 65535, 65535, 5616, 65535, 4897,
+  5719, 65535, 6855, 65535, 65535, 8615, 65535, 7824, 8487, 65535, 65535, 0, 2268, 65535, 65535, 65535,
+  11289, 65535, 10716, 65535, 13257, 65535, 13825, 65535, 13836, 65535, 15690, 65535, 18600, 65535, 18669, 65535,
+  10129, 65535, 65535, 11710, 12498, 65535, 65535, 13644, 15097, 65535, 65535, 16487, 17500, 65535, 65535, 9087,
+  65535, 592, 7059, 65535, 65535, 5576, 4605, 65535, 65535, 2700, 1676, 65535, 10521, 65535, 12732, 65535,
+  13510, 65535, 18246, 65535, 65535, 6009, 5276, 65535, 65535, 6326, 8256, 65535, 65535, 2589, 65535, 65535,
+  65535, 11514, 65535, 11291, 65535, 13766, 65535, 14210, 65535, 14284, 65535, 15915, 65535, 19287, 65535, 19153,
+  // D13
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 321, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  // D14
+  11405, 65535, 11965, 65535, 3101, 65535, 3870, 65535, 4139, 65535, 5259, 65535, 6682, 65535, 7598, 65535,
+  9060, 65535, 9369, 65535, 10287, 65535, 1984, 65535, 3176, 65535, 3724, 65535, 4507, 65535, 5764, 65535,
+  6160, 65535, 7457, 65535, 1152, 65535, 1413, 65535, 4817, 65535, 5380, 65535, 5451, 65535, 6170, 65535,
+  65535, 8833, 65535, 7697, 8836, 65535, 9627, 65535, 65535, 65535, 2268, 65535, 65535, 0, 65535, 65535,
+  12036, 65535, 11463, 65535, 4131, 65535, 4699, 65535, 4710, 65535, 6564, 65535, 9474, 65535, 9543, 65535,
+  10876, 65535, 65535, 2584, 3372, 65535, 65535, 4518, 5971, 65535, 65535, 7361, 8374, 65535, 65535, 9834,
+  1676, 65535, 65535, 2573, 4056, 65535, 65535, 5027, 6932, 65535, 65535, 592, 11268, 65535, 3606, 65535,
+  4384, 65535, 9120, 65535, 5058, 65535, 65535, 5791, 8226, 65535, 65535, 9195, 65535, 65535, 65535, 65535,
+  65535, 12261, 65535, 12038, 65535, 4640, 65535, 5084, 65535, 5158, 65535, 6789, 65535, 10161, 65535, 10027,
+  // D15
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 736,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  // D16
+  4521, 65535, 5081, 65535, 6090, 65535, 6859, 65535, 7128, 65535, 8248, 65535, 9671, 65535, 714, 65535,
+  2176, 65535, 2485, 65535, 3403, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0,
+  5152, 65535, 4579, 65535, 7120, 65535, 7688, 65535, 7699, 65535, 9553, 65535, 2590, 65535, 2659, 65535,
+  3992, 65535, 65535, 5573, 6361, 65535, 65535, 7507, 8960, 65535, 65535, 477, 1490, 65535, 65535, 2950,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4384, 65535, 6595, 65535,
+  7373, 65535, 2236, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 5377, 65535, 5154, 65535, 7629, 65535, 8073, 65535, 8147, 65535, 9778, 65535, 3277, 65535, 3143,
+  // E1
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  0, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 225, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  // E2
+  14454, 10504, 15014, 9944, 12122, 8935, 12891, 8166, 13160, 7897, 8308, 6777, 9731, 5354, 10647, 4438,
+  12109, 2976, 12418, 2667, 13336, 1749, 11005, 11444, 4833, 10252, 5381, 9704, 6164, 14893, 7421, 13636,
+  7817, 13240, 9114, 11943, 10173, 10884, 10434, 10623, 6474, 8611, 7037, 8048, 7108, 15384, 7827, 14665,
+  15487, 10490, 13550, 9354, 10493, 12411, 3465, 11620, 12283, 2802, 11289, 9768, 12036, 65535, 5152, 65535,
+  15085, 0, 14512, 65535, 13152, 65535, 13720, 65535, 13731, 65535, 9613, 65535, 12523, 65535, 12592, 65535,
+  13925, 1160, 9452, 11605, 12393, 8664, 7518, 7567, 9020, 6065, 4675, 10410, 11423, 3662, 2202, 12883,
+  10697, 10360, 10855, 4230, 5713, 9372, 14373, 6684, 8589, 12468, 11444, 9613, 14317, 768, 12627, 65535,
+  13405, 65535, 12169, 65535, 6715, 8370, 15044, 7448, 9883, 13021, 12052, 3033, 65535, 12357, 65535, 5888,
+  65535, 15310, 65535, 15087, 65535, 13661, 65535, 14105, 65535, 14179, 65535, 9838, 65535, 13210, 65535, 13076,
+  // E3
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 0, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 575, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  // E4
+  13881, 9931, 14441, 9371, 11549, 8362, 12318, 7593, 12587, 7324, 7735, 6204, 9158, 4781, 10074, 3865,
+  11536, 2403, 11845, 2094, 12763, 1176, 10432, 10871, 4260, 9679, 4808, 9131, 5591, 14320, 6848, 13063,
+  7244, 12667, 8541, 11370, 9600, 10311, 9861, 10050, 5901, 8038, 6464, 7475, 6535, 14811, 7254, 14092,
+  14914, 9917, 12977, 8781, 9920, 11838, 2892, 11047, 11710, 2229, 10716, 9195, 11463, 65535, 4579, 65535,
+  14512, 65535, 13939, 0, 12579, 65535, 13147, 65535, 13158, 65535, 9040, 65535, 11950, 65535, 12019, 65535,
+  13352, 587, 8879, 11032, 11820, 8091, 6945, 6994, 8447, 5492, 4102, 9837, 10850, 3089, 1629, 12310,
+  10124, 9787, 10282, 3657, 5140, 8799, 13800, 6111, 8016, 11895, 10871, 9040, 13744, 195, 12054, 65535,
+  12832, 65535, 11596, 65535, 6142, 7797, 14471, 6875, 9310, 12448, 11479, 2460, 65535, 11784, 65535, 5315,
+  65535, 14737, 65535, 14514, 65535, 13088, 65535, 13532, 65535, 13606, 65535, 9265, 65535, 12637, 65535, 12503,
+  // E5
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 0, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 509, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  // E6
+  12521, 2599, 13081, 2039, 14090, 1030, 14859, 10134, 15128, 9865, 10276, 8745, 11699, 7322, 12615, 6406,
+  14077, 4944, 14386, 4635, 11403, 3717, 12973, 9511, 6801, 8319, 7349, 7771, 8132, 6988, 9389, 5731,
+  9785, 5335, 11082, 4038, 12141, 2979, 12402, 2718, 8442, 8113, 9005, 10016, 9076, 7479, 9795, 6760,
+  7582, 12458, 8718, 11322, 12461, 10478, 5433, 9687, 10350, 4770, 13257, 1863, 4131, 65535, 7120, 65535,
+  13152, 65535, 12579, 65535, 15120, 0, 15688, 65535, 15699, 65535, 11581, 65535, 14491, 65535, 14560, 65535,
+  11992, 3128, 1547, 13573, 14361, 759, 9486, 9535, 10988, 8033, 6643, 12378, 13391, 5630, 4170, 10950,
+  12665, 2455, 8922, 6198, 7681, 7439, 6468, 8652, 10557, 4563, 3539, 11581, 12384, 65535, 14595, 525,
+  15373, 65535, 14137, 65535, 8683, 7872, 7139, 9416, 11851, 8189, 10119, 5001, 65535, 4452, 65535, 7856,
+  65535, 13377, 65535, 13154, 65535, 15629, 65535, 16073, 65535, 16147, 65535, 11806, 65535, 15178, 65535, 15044,
+  // E7
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 0, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 385, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  // E8
+  13089, 3167, 13649, 2607, 14658, 1598, 15427, 10702, 15696, 10433, 10844, 9313, 12267, 7890, 13183, 6974,
+  14645, 5512, 14954, 5203, 11971, 4285, 13541, 10079, 7369, 8887, 7917, 8339, 8700, 7556, 9957, 6299,
+  10353, 5903, 11650, 4606, 12709, 3547, 12970, 3286, 9010, 8681, 9573, 10584, 9644, 8047, 10363, 7328,
+  8150, 13026, 9286, 11890, 13029, 11046, 6001, 10255, 10918, 5338, 13825, 2431, 4699, 65535, 7688, 65535,
+  13720, 65535, 13147, 65535, 15688, 65535, 16256, 0, 16267, 65535, 12149, 65535, 15059, 65535, 15128, 65535,
+  12560, 3696, 2115, 14141, 14929, 1327, 10054, 10103, 11556, 8601, 7211, 12946, 13959, 6198, 4738, 11518,
+  13233, 3023, 9490, 6766, 8249, 8007, 7036, 9220, 11125, 5131, 4107, 12149, 12952, 65535, 15163, 1093,
+  15941, 315, 14705, 65535, 9251, 8440, 7707, 9984, 12419, 8757, 10687, 5569, 65535, 5020, 65535, 8424,
+  65535, 13945, 65535, 13722, 65535, 16197, 65535, 16641, 65535, 16715, 65535, 12374, 65535, 15746, 65535, 15612,
+  // E9
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 448, 65535, 65535, 65535, 65535, 65535, 65535,
+  // E10
+  13100, 3178, 13660, 2618, 14669, 1609, 15438, 10713, 15707, 10444, 10855, 9324, 12278, 7901, 13194, 6985,
+  14656, 5523, 14965, 5214, 11982, 4296, 13552, 10090, 7380, 8898, 7928, 8350, 8711, 7567, 9968, 6310,
+  10364, 5914, 11661, 4617, 12720, 3558, 12981, 3297, 9021, 8692, 9584, 10595, 9655, 8058, 10374, 7339,
+  8161, 13037, 9297, 11901, 13040, 11057, 6012, 10266, 10929, 5349, 13836, 2442, 4710, 65535, 7699, 65535,
+  13731, 65535, 13158, 65535, 15699, 65535, 16267, 65535, 16278, 0, 12160, 65535, 15070, 65535, 15139, 65535,
+  12571, 3707, 2126, 14152, 14940, 1338, 10065, 10114, 11567, 8612, 7222, 12957, 13970, 6209, 4749, 11529,
+  13244, 3034, 9501, 6777, 8260, 8018, 7047, 9231, 11136, 5142, 4118, 12160, 12963, 65535, 15174, 1104,
+  15952, 326, 14716, 65535, 9262, 8451, 7718, 9995, 12430, 8768, 10698, 5580, 65535, 5031, 65535, 8435,
+  65535, 13956, 65535, 13733, 65535, 16208, 65535, 16652, 65535, 16726, 65535, 12385, 65535, 15757, 65535, 15623,
+  // E11
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 225, 65535, 65535, 65535, 65535,
+  // E12
+  8982, 5032, 9542, 4472, 10551, 3463, 11320, 2694, 11589, 2425, 12709, 1305, 14132, 9755, 15048, 8839,
+  16510, 7377, 16819, 7068, 7864, 6150, 15406, 5972, 9234, 4780, 9782, 4232, 10565, 9421, 11822, 8164,
+  12218, 7768, 13515, 6471, 14574, 5412, 14835, 5151, 10875, 3139, 11438, 2576, 11509, 9912, 12228, 9193,
+  10015, 14891, 8078, 13755, 14894, 6939, 7866, 6148, 6811, 7203, 15690, 4296, 6564, 65535, 9553, 65535,
+  9613, 65535, 9040, 65535, 11581, 65535, 12149, 65535, 12160, 65535, 14014, 0, 16924, 65535, 16993, 65535,
+  8453, 5561, 3980, 10034, 10822, 3192, 2046, 11968, 13421, 593, 9076, 14811, 15824, 8063, 6603, 7411,
+  15098, 4888, 5383, 8631, 10114, 3900, 8901, 11085, 12990, 6996, 5972, 14014, 8845, 65535, 11056, 65535,
+  11834, 65535, 16570, 65535, 11116, 2898, 9572, 11849, 14284, 7549, 6580, 7434, 65535, 6885, 65535, 10289,
+  65535, 9838, 65535, 9615, 65535, 12090, 65535, 12534, 65535, 12608, 65535, 14239, 65535, 17611, 65535, 17477,
+  // E13
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 687, 65535, 65535,
+  // E14
+  11892, 7942, 12452, 7382, 13461, 6373, 14230, 5604, 14499, 5335, 15619, 4215, 17042, 2792, 17958, 1876,
+  19420, 10287, 19729, 9978, 10774, 9060, 18316, 8882, 12144, 7690, 12692, 7142, 13475, 12331, 14732, 11074,
+  15128, 10678, 16425, 9381, 17484, 8322, 17745, 8061, 13785, 6049, 14348, 5486, 14419, 12822, 15138, 12103,
+  12925, 17801, 10988, 16665, 17804, 9849, 10776, 9058, 9721, 10113, 18600, 7206, 9474, 65535, 2590, 65535,
+  12523, 65535, 11950, 65535, 14491, 65535, 15059, 65535, 15070, 65535, 16924, 65535, 19834, 0, 19903, 65535,
+  11363, 8471, 6890, 12944, 13732, 6102, 4956, 14878, 16331, 3503, 2113, 17721, 18734, 1100, 9513, 10321,
+  18008, 7798, 8293, 11541, 13024, 6810, 11811, 13995, 15900, 9906, 8882, 16924, 11755, 65535, 13966, 65535,
+  14744, 65535, 19480, 354, 14026, 5808, 12482, 14759, 17194, 10459, 9490, 10344, 65535, 9795, 65535, 3326,
+  65535, 12748, 65535, 12525, 65535, 15000, 65535, 15444, 65535, 15518, 65535, 17149, 65535, 20521, 65535, 20387,
+  // E15
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 484,
+  // E16
+  11961, 8011, 12521, 7451, 13530, 6442, 14299, 5673, 14568, 5404, 15688, 4284, 17111, 2861, 18027, 1945,
+  19489, 10356, 19798, 10047, 10843, 9129, 18385, 8951, 12213, 7759, 12761, 7211, 13544, 12400, 14801, 11143,
+  15197, 10747, 16494, 9450, 17553, 8391, 17814, 8130, 13854, 6118, 14417, 5555, 14488, 12891, 15207, 12172,
+  12994, 17870, 11057, 16734, 17873, 9918, 10845, 9127, 9790, 10182, 18669, 7275, 9543, 65535, 2659, 65535,
+  12592, 65535, 12019, 65535, 14560, 65535, 15128, 65535, 15139, 65535, 16993, 65535, 19903, 65535, 19972, 0,
+  11432, 8540, 6959, 13013, 13801, 6171, 5025, 14947, 16400, 3572, 2182, 17790, 18803, 1169, 9582, 10390,
+  18077, 7867, 8362, 11610, 13093, 6879, 11880, 14064, 15969, 9975, 8951, 16993, 11824, 65535, 14035, 65535,
+  14813, 65535, 19549, 423, 14095, 5877, 12551, 14828, 17263, 10528, 9559, 10413, 65535, 9864, 65535, 3395,
+  65535, 12817, 65535, 12594, 65535, 15069, 65535, 15513, 65535, 15587, 65535, 17218, 65535, 20590, 65535, 20456,
+  // BR1
+  529, 65535, 1089, 65535, 2098, 65535, 2867, 65535, 3136, 65535, 4256, 65535, 5679, 65535, 6595, 65535,
+  8057, 65535, 8366, 65535, 9284, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  1160, 65535, 587, 65535, 3128, 65535, 3696, 65535, 3707, 65535, 5561, 65535, 8471, 65535, 8540, 65535,
+  0, 65535, 65535, 1581, 2369, 65535, 65535, 3515, 4968, 65535, 65535, 6358, 7371, 65535, 65535, 8831,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 392, 65535, 2603, 65535,
+  3381, 65535, 8117, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 1385, 65535, 1162, 65535, 3637, 65535, 4081, 65535, 4155, 65535, 5786, 65535, 9158, 65535, 9024,
+  // MR1
+  13294, 9344, 13854, 8784, 10962, 7775, 11731, 7006, 12000, 6737, 7148, 5617, 8571, 4194, 9487, 3278,
+  10949, 1816, 11258, 1507, 12176, 589, 9845, 10284, 3673, 9092, 4221, 8544, 5004, 13733, 6261, 12476,
+  6657, 12080, 7954, 10783, 9013, 9724, 9274, 9463, 5314, 7451, 5877, 6888, 5948, 14224, 6667, 13505,
+  14327, 9330, 12390, 8194, 9333, 11251, 2305, 10460, 11123, 1642, 10129, 8608, 10876, 65535, 3992, 65535,
+  13925, 65535, 13352, 65535, 11992, 65535, 12560, 65535, 12571, 65535, 8453, 65535, 11363, 65535, 11432, 65535,
+  12765, 0, 8292, 10445, 11233, 7504, 6358, 6407, 7860, 4905, 3515, 9250, 10263, 2502, 1042, 11723,
+  9537, 9200, 9695, 3070, 4553, 8212, 13213, 5524, 7429, 11308, 10284, 8453, 13157, 65535, 11467, 65535,
+  12245, 65535, 11009, 65535, 5555, 7210, 13884, 6288, 8723, 11861, 10892, 1873, 65535, 11197, 65535, 4728,
+  65535, 14150, 65535, 13927, 65535, 12501, 65535, 12945, 65535, 13019, 65535, 8678, 65535, 12050, 65535, 11916,
+  // BR2
+  10974, 1052, 11534, 492, 12543, 9356, 13312, 8587, 13581, 8318, 8729, 7198, 10152, 5775, 11068, 4859,
+  12530, 3397, 12839, 3088, 9856, 2170, 11426, 7964, 5254, 6772, 5802, 6224, 6585, 5441, 7842, 4184,
+  8238, 3788, 9535, 2491, 10594, 1432, 10855, 1171, 6895, 6566, 7458, 8469, 7529, 5932, 8248, 5213,
+  6035, 10911, 7171, 9775, 10914, 8931, 3886, 8140, 8803, 3223, 11710, 316, 2584, 65535, 5573, 65535,
+  11605, 65535, 11032, 65535, 13573, 65535, 14141, 65535, 14152, 65535, 10034, 65535, 12944, 65535, 13013, 65535,
+  10445, 1581, 0, 12026, 12814, 9085, 7939, 7988, 9441, 6486, 5096, 10831, 11844, 4083, 2623, 9403,
+  11118, 908, 7375, 4651, 6134, 5892, 4921, 7105, 9010, 3016, 1992, 10034, 10837, 65535, 13048, 65535,
+  13826, 65535, 12590, 65535, 7136, 6325, 5592, 7869, 10304, 6642, 8572, 3454, 65535, 2905, 65535, 6309,
+  65535, 11830, 65535, 11607, 65535, 14082, 65535, 14526, 65535, 14600, 65535, 10259, 65535, 13631, 65535, 13497,
+  // MR2
+  8821, 65535, 9381, 65535, 517, 65535, 1286, 65535, 1555, 65535, 2675, 65535, 4098, 65535, 5014, 65535,
+  6476, 65535, 6785, 65535, 7703, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  9452, 65535, 8879, 65535, 1547, 65535, 2115, 65535, 2126, 65535, 3980, 65535, 6890, 65535, 6959, 65535,
+  8292, 65535, 65535, 0, 788, 65535, 65535, 1934, 3387, 65535, 65535, 4777, 5790, 65535, 65535, 7250,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 8684, 65535, 1022, 65535,
+  1800, 65535, 6536, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 9677, 65535, 9454, 65535, 2056, 65535, 2500, 65535, 2574, 65535, 4205, 65535, 7577, 65535, 7443,
+  // BR3
+  8033, 65535, 8593, 65535, 9602, 65535, 498, 65535, 767, 65535, 1887, 65535, 3310, 65535, 4226, 65535,
+  5688, 65535, 5997, 65535, 6915, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  8664, 65535, 8091, 65535, 759, 65535, 1327, 65535, 1338, 65535, 3192, 65535, 6102, 65535, 6171, 65535,
+  7504, 65535, 65535, 9085, 0, 65535, 65535, 1146, 2599, 65535, 65535, 3989, 5002, 65535, 65535, 6462,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 7896, 65535, 234, 65535,
+  1012, 65535, 5748, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 8889, 65535, 8666, 65535, 1268, 65535, 1712, 65535, 1786, 65535, 3417, 65535, 6789, 65535, 6655,
+  // MR3
+  11762, 1840, 12322, 1280, 13331, 271, 14100, 9375, 14369, 9106, 9517, 7986, 10940, 6563, 11856, 5647,
+  13318, 4185, 13627, 3876, 10644, 2958, 12214, 8752, 6042, 7560, 6590, 7012, 7373, 6229, 8630, 4972,
+  9026, 4576, 10323, 3279, 11382, 2220, 11643, 1959, 7683, 7354, 8246, 9257, 8317, 6720, 9036, 6001,
+  6823, 11699, 7959, 10563, 11702, 9719, 4674, 8928, 9591, 4011, 12498, 1104, 3372, 65535, 6361, 65535,
+  12393, 65535, 11820, 65535, 14361, 65535, 14929, 65535, 14940, 65535, 10822, 65535, 13732, 65535, 13801, 65535,
+  11233, 2369, 788, 12814, 13602, 0, 8727, 8776, 10229, 7274, 5884, 11619, 12632, 4871, 3411, 10191,
+  11906, 1696, 8163, 5439, 6922, 6680, 5709, 7893, 9798, 3804, 2780, 10822, 11625, 65535, 13836, 65535,
+  14614, 65535, 13378, 65535, 7924, 7113, 6380, 8657, 11092, 7430, 9360, 4242, 65535, 3693, 65535, 7097,
+  65535, 12618, 65535, 12395, 65535, 14870, 65535, 15314, 65535, 15388, 65535, 11047, 65535, 14419, 65535, 14285,
+  // BR4
+  6936, 2986, 7496, 2426, 8505, 1417, 9274, 648, 9543, 379, 10663, 9132, 12086, 7709, 13002, 6793,
+  14464, 5331, 14773, 5022, 5818, 4104, 13360, 3926, 7188, 2734, 7736, 2186, 8519, 7375, 9776, 6118,
+  10172, 5722, 11469, 4425, 12528, 3366, 12789, 3105, 8829, 1093, 9392, 530, 9463, 7866, 10182, 7147,
+  7969, 12845, 6032, 11709, 12848, 4893, 5820, 4102, 4765, 5157, 13644, 2250, 4518, 65535, 7507, 65535,
+  7567, 65535, 6994, 65535, 9535, 65535, 10103, 65535, 10114, 65535, 11968, 65535, 14878, 65535, 14947, 65535,
+  6407, 3515, 1934, 7988, 8776, 1146, 0, 9922, 11375, 8420, 7030, 12765, 13778, 6017, 4557, 5365,
+  13052, 2842, 3337, 6585, 8068, 1854, 6855, 9039, 10944, 4950, 3926, 11968, 6799, 65535, 9010, 65535,
+  9788, 65535, 14524, 65535, 9070, 852, 7526, 9803, 12238, 5503, 4534, 5388, 65535, 4839, 65535, 8243,
+  65535, 7792, 65535, 7569, 65535, 10044, 65535, 10488, 65535, 10562, 65535, 12193, 65535, 15565, 65535, 15431,
+  // MR4
+  6887, 65535, 7447, 65535, 8456, 65535, 9225, 65535, 9494, 65535, 741, 65535, 2164, 65535, 3080, 65535,
+  4542, 65535, 4851, 65535, 5769, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  7518, 65535, 6945, 65535, 9486, 65535, 10054, 65535, 10065, 65535, 2046, 65535, 4956, 65535, 5025, 65535,
+  6358, 65535, 65535, 7939, 8727, 65535, 65535, 0, 1453, 65535, 65535, 2843, 3856, 65535, 65535, 5316,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 6750, 65535, 8961, 65535,
+  9739, 65535, 4602, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 7743, 65535, 7520, 65535, 9995, 65535, 10439, 65535, 10513, 65535, 2271, 65535, 5643, 65535, 5509,
+  // BR5
+  5434, 65535, 5994, 65535, 7003, 65535, 7772, 65535, 8041, 65535, 9161, 65535, 711, 65535, 1627, 65535,
+  3089, 65535, 3398, 65535, 4316, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  6065, 65535, 5492, 65535, 8033, 65535, 8601, 65535, 8612, 65535, 593, 65535, 3503, 65535, 3572, 65535,
+  4905, 65535, 65535, 6486, 7274, 65535, 65535, 8420, 0, 65535, 65535, 1390, 2403, 65535, 65535, 3863,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5297, 65535, 7508, 65535,
+  8286, 65535, 3149, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 6290, 65535, 6067, 65535, 8542, 65535, 8986, 65535, 9060, 65535, 818, 65535, 4190, 65535, 4056,
+  // MR5
+  8389, 4439, 8949, 3879, 9958, 2870, 10727, 2101, 10996, 1832, 12116, 712, 13539, 9162, 14455, 8246,
+  15917, 6784, 16226, 6475, 7271, 5557, 14813, 5379, 8641, 4187, 9189, 3639, 9972, 8828, 11229, 7571,
+  11625, 7175, 12922, 5878, 13981, 4819, 14242, 4558, 10282, 2546, 10845, 1983, 10916, 9319, 11635, 8600,
+  9422, 14298, 7485, 13162, 14301, 6346, 7273, 5555, 6218, 6610, 15097, 3703, 5971, 65535, 8960, 65535,
+  9020, 65535, 8447, 65535, 10988, 65535, 11556, 65535, 11567, 65535, 13421, 65535, 16331, 65535, 16400, 65535,
+  7860, 4968, 3387, 9441, 10229, 2599, 1453, 11375, 12828, 0, 8483, 14218, 15231, 7470, 6010, 6818,
+  14505, 4295, 4790, 8038, 9521, 3307, 8308, 10492, 12397, 6403, 5379, 13421, 8252, 65535, 10463, 65535,
+  11241, 65535, 15977, 65535, 10523, 2305, 8979, 11256, 13691, 6956, 5987, 6841, 65535, 6292, 65535, 9696,
+  65535, 9245, 65535, 9022, 65535, 11497, 65535, 11941, 65535, 12015, 65535, 13646, 65535, 17018, 65535, 16884,
+  // BR6
+  9779, 5829, 10339, 5269, 11348, 4260, 12117, 3491, 12386, 3222, 13506, 2102, 14929, 679, 15845, 9636,
+  17307, 8174, 17616, 7865, 8661, 6947, 16203, 6769, 10031, 5577, 10579, 5029, 11362, 10218, 12619, 8961,
+  13015, 8565, 14312, 7268, 15371, 6209, 15632, 5948, 11672, 3936, 12235, 3373, 12306, 10709, 13025, 9990,
+  10812, 15688, 8875, 14552, 15691, 7736, 8663, 6945, 7608, 8000, 16487, 5093, 7361, 65535, 477, 65535,
+  10410, 65535, 9837, 65535, 12378, 65535, 12946, 65535, 12957, 65535, 14811, 65535, 17721, 65535, 17790, 65535,
+  9250, 6358, 4777, 10831, 11619, 3989, 2843, 12765, 14218, 1390, 0, 15608, 16621, 8860, 7400, 8208,
+  15895, 5685, 6180, 9428, 10911, 4697, 9698, 11882, 13787, 7793, 6769, 14811, 9642, 65535, 11853, 65535,
+  12631, 65535, 17367, 65535, 11913, 3695, 10369, 12646, 15081, 8346, 7377, 8231, 65535, 7682, 65535, 1213,
+  65535, 10635, 65535, 10412, 65535, 12887, 65535, 13331, 65535, 13405, 65535, 15036, 65535, 18408, 65535, 18274,
+  // MR6
+  4044, 65535, 4604, 65535, 5613, 65535, 6382, 65535, 6651, 65535, 7771, 65535, 9194, 65535, 237, 65535,
+  1699, 65535, 2008, 65535, 2926, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  4675, 65535, 4102, 65535, 6643, 65535, 7211, 65535, 7222, 65535, 9076, 65535, 2113, 65535, 2182, 65535,
+  3515, 65535, 65535, 5096, 5884, 65535, 65535, 7030, 8483, 65535, 65535, 0, 1013, 65535, 65535, 2473,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3907, 65535, 6118, 65535,
+  6896, 65535, 1759, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 4900, 65535, 4677, 65535, 7152, 65535, 7596, 65535, 7670, 65535, 9301, 65535, 2800, 65535, 2666,
+  // BR7
+  3031, 65535, 3591, 65535, 4600, 65535, 5369, 65535, 5638, 65535, 6758, 65535, 8181, 65535, 9097, 65535,
+  686, 65535, 995, 65535, 1913, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  3662, 65535, 3089, 65535, 5630, 65535, 6198, 65535, 6209, 65535, 8063, 65535, 1100, 65535, 1169, 65535,
+  2502, 65535, 65535, 4083, 4871, 65535, 65535, 6017, 7470, 65535, 65535, 8860, 0, 65535, 65535, 1460,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2894, 65535, 5105, 65535,
+  5883, 65535, 746, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 3887, 65535, 3664, 65535, 6139, 65535, 6583, 65535, 6657, 65535, 8288, 65535, 1787, 65535, 1653,
+  // MR7
+  10792, 6842, 11352, 6282, 12361, 5273, 13130, 4504, 13399, 4235, 14519, 3115, 15942, 1692, 16858, 776,
+  18320, 9187, 18629, 8878, 9674, 7960, 17216, 7782, 11044, 6590, 11592, 6042, 12375, 11231, 13632, 9974,
+  14028, 9578, 15325, 8281, 16384, 7222, 16645, 6961, 12685, 4949, 13248, 4386, 13319, 11722, 14038, 11003,
+  11825, 16701, 9888, 15565, 16704, 8749, 9676, 7958, 8621, 9013, 17500, 6106, 8374, 65535, 1490, 65535,
+  11423, 65535, 10850, 65535, 13391, 65535, 13959, 65535, 13970, 65535, 15824, 65535, 18734, 65535, 18803, 65535,
+  10263, 7371, 5790, 11844, 12632, 5002, 3856, 13778, 15231, 2403, 1013, 16621, 17634, 0, 8413, 9221,
+  16908, 6698, 7193, 10441, 11924, 5710, 10711, 12895, 14800, 8806, 7782, 15824, 10655, 65535, 12866, 65535,
+  13644, 65535, 18380, 65535, 12926, 4708, 11382, 13659, 16094, 9359, 8390, 9244, 65535, 8695, 65535, 2226,
+  65535, 11648, 65535, 11425, 65535, 13900, 65535, 14344, 65535, 14418, 65535, 16049, 65535, 19421, 65535, 19287,
+  // BR8
+  12252, 8302, 12812, 7742, 9920, 6733, 10689, 5964, 10958, 5695, 6106, 4575, 7529, 3152, 8445, 2236,
+  9907, 774, 10216, 465, 11134, 9420, 8803, 9242, 2631, 8050, 3179, 7502, 3962, 12691, 5219, 11434,
+  5615, 11038, 6912, 9741, 7971, 8682, 8232, 8421, 4272, 6409, 4835, 5846, 4906, 13182, 5625, 12463,
+  13285, 8288, 11348, 7152, 8291, 10209, 1263, 9418, 10081, 600, 9087, 7566, 9834, 65535, 2950, 65535,
+  12883, 65535, 12310, 65535, 10950, 65535, 11518, 65535, 11529, 65535, 7411, 65535, 10321, 65535, 10390, 65535,
+  11723, 8831, 7250, 9403, 10191, 6462, 5316, 5365, 6818, 3863, 2473, 8208, 9221, 1460, 0, 10681,
+  8495, 8158, 8653, 2028, 3511, 7170, 12171, 4482, 6387, 10266, 9242, 7411, 12115, 65535, 10425, 65535,
+  11203, 65535, 9967, 65535, 4513, 6168, 12842, 5246, 7681, 10819, 9850, 831, 65535, 10155, 65535, 3686,
+  65535, 13108, 65535, 12885, 65535, 11459, 65535, 11903, 65535, 11977, 65535, 7636, 65535, 11008, 65535, 10874,
+  // MR8
+  1571, 65535, 2131, 65535, 3140, 65535, 3909, 65535, 4178, 65535, 5298, 65535, 6721, 65535, 7637, 65535,
+  9099, 65535, 9408, 65535, 453, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  2202, 65535, 1629, 65535, 4170, 65535, 4738, 65535, 4749, 65535, 6603, 65535, 9513, 65535, 9582, 65535,
+  1042, 65535, 65535, 2623, 3411, 65535, 65535, 4557, 6010, 65535, 65535, 7400, 8413, 65535, 65535, 0,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1434, 65535, 3645, 65535,
+  4423, 65535, 9159, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 2427, 65535, 2204, 65535, 4679, 65535, 5123, 65535, 5197, 65535, 6828, 65535, 10200, 65535, 10066,
+  // BR9
+  9729, 65535, 10289, 65535, 1425, 65535, 2194, 65535, 2463, 65535, 3583, 65535, 5006, 65535, 5922, 65535,
+  7384, 65535, 7693, 65535, 8611, 65535, 308, 65535, 1500, 65535, 2048, 65535, 2831, 65535, 4088, 65535,
+  4484, 65535, 5781, 65535, 6840, 65535, 7101, 65535, 3141, 65535, 3704, 65535, 3775, 65535, 4494, 65535,
+  65535, 7157, 65535, 6021, 7160, 65535, 7951, 65535, 65535, 65535, 592, 65535, 65535, 65535, 65535, 65535,
+  10360, 65535, 9787, 65535, 2455, 65535, 3023, 65535, 3034, 65535, 4888, 65535, 7798, 65535, 7867, 65535,
+  9200, 65535, 65535, 908, 1696, 65535, 65535, 2842, 4295, 65535, 65535, 5685, 6698, 65535, 65535, 8158,
+  0, 65535, 65535, 897, 2380, 65535, 65535, 3351, 5256, 65535, 65535, 6280, 9592, 65535, 1930, 65535,
+  2708, 65535, 7444, 65535, 3382, 65535, 65535, 4115, 6550, 65535, 65535, 7519, 65535, 65535, 65535, 65535,
+  65535, 10585, 65535, 10362, 65535, 2964, 65535, 3408, 65535, 3482, 65535, 5113, 65535, 8485, 65535, 8351,
+  // MR9
+  10066, 65535, 10626, 65535, 11635, 65535, 12404, 65535, 12673, 65535, 13793, 65535, 15216, 65535, 16132, 65535,
+  17594, 65535, 17903, 65535, 8948, 65535, 65535, 7056, 65535, 5864, 65535, 5316, 65535, 4533, 65535, 3276,
+  65535, 2880, 65535, 1583, 65535, 524, 65535, 263, 65535, 5658, 65535, 65535, 65535, 5024, 65535, 4305,
+  5127, 65535, 6263, 65535, 65535, 8023, 65535, 7232, 7895, 65535, 65535, 65535, 1676, 65535, 65535, 65535,
+  10697, 65535, 10124, 65535, 12665, 65535, 13233, 65535, 13244, 65535, 15098, 65535, 18008, 65535, 18077, 65535,
+  9537, 65535, 65535, 11118, 11906, 65535, 65535, 13052, 14505, 65535, 65535, 15895, 16908, 65535, 65535, 8495,
+  65535, 0, 6467, 65535, 65535, 4984, 4013, 65535, 65535, 2108, 1084, 65535, 9929, 65535, 12140, 65535,
+  12918, 65535, 17654, 65535, 65535, 5417, 4684, 65535, 65535, 5734, 7664, 65535, 65535, 1997, 65535, 65535,
+  65535, 10922, 65535, 10699, 65535, 13174, 65535, 13618, 65535, 13692, 65535, 15323, 65535, 18695, 65535, 18561,
+  // BR10
+  3599, 65535, 4159, 65535, 5168, 65535, 5937, 65535, 6206, 65535, 7326, 65535, 8749, 65535, 9665, 65535,
+  11127, 65535, 11436, 65535, 2481, 65535, 65535, 589, 65535, 6761, 65535, 6213, 65535, 5430, 65535, 4173,
+  65535, 3777, 65535, 2480, 65535, 1421, 65535, 1160, 65535, 6555, 65535, 65535, 65535, 5921, 65535, 5202,
+  6024, 65535, 2695, 65535, 65535, 1556, 65535, 765, 1428, 65535, 65535, 65535, 2573, 65535, 65535, 65535,
+  4230, 65535, 3657, 65535, 6198, 65535, 6766, 65535, 6777, 65535, 8631, 65535, 11541, 65535, 11610, 65535,
+  3070, 65535, 65535, 4651, 5439, 65535, 65535, 6585, 8038, 65535, 65535, 9428, 10441, 65535, 65535, 2028,
+  65535, 897, 0, 65535, 65535, 5881, 4910, 65535, 65535, 3005, 1981, 65535, 3462, 65535, 5673, 65535,
+  6451, 65535, 11187, 65535, 65535, 6314, 5581, 65535, 65535, 2166, 1197, 65535, 65535, 2894, 65535, 65535,
+  65535, 4455, 65535, 4232, 65535, 6707, 65535, 7151, 65535, 7225, 65535, 8856, 65535, 12228, 65535, 12094,
+  // MR10
+  10224, 65535, 10784, 65535, 7892, 65535, 8661, 65535, 8930, 65535, 4078, 65535, 5501, 65535, 6417, 65535,
+  7879, 65535, 8188, 65535, 9106, 65535, 6775, 65535, 603, 65535, 1151, 65535, 1934, 65535, 3191, 65535,
+  3587, 65535, 4884, 65535, 5943, 65535, 6204, 65535, 2244, 65535, 2807, 65535, 2878, 65535, 3597, 65535,
+  65535, 6260, 65535, 5124, 6263, 65535, 7054, 65535, 65535, 65535, 7059, 65535, 65535, 65535, 65535, 65535,
+  10855, 65535, 10282, 65535, 8922, 65535, 9490, 65535, 9501, 65535, 5383, 65535, 8293, 65535, 8362, 65535,
+  9695, 65535, 65535, 7375, 8163, 65535, 65535, 3337, 4790, 65535, 65535, 6180, 7193, 65535, 65535, 8653,
+  6467, 65535, 65535, 0, 1483, 65535, 65535, 2454, 4359, 65535, 65535, 5383, 10087, 65535, 8397, 65535,
+  9175, 65535, 7939, 65535, 2485, 65535, 65535, 3218, 5653, 65535, 65535, 6622, 65535, 65535, 65535, 65535,
+  65535, 11080, 65535, 10857, 65535, 9431, 65535, 9875, 65535, 9949, 65535, 5608, 65535, 8980, 65535, 8846,
+  // BR11
+  8741, 65535, 9301, 65535, 6409, 65535, 7178, 65535, 7447, 65535, 2595, 65535, 4018, 65535, 4934, 65535,
+  6396, 65535, 6705, 65535, 7623, 65535, 5292, 65535, 6484, 65535, 7032, 65535, 451, 65535, 1708, 65535,
+  2104, 65535, 3401, 65535, 4460, 65535, 4721, 65535, 761, 65535, 1324, 65535, 1395, 65535, 2114, 65535,
+  65535, 4777, 65535, 3641, 4780, 65535, 5571, 65535, 65535, 65535, 5576, 65535, 65535, 65535, 65535, 65535,
+  9372, 65535, 8799, 65535, 7439, 65535, 8007, 65535, 8018, 65535, 3900, 65535, 6810, 65535, 6879, 65535,
+  8212, 65535, 65535, 5892, 6680, 65535, 65535, 1854, 3307, 65535, 65535, 4697, 5710, 65535, 65535, 7170,
+  4984, 65535, 65535, 5881, 0, 65535, 65535, 971, 2876, 65535, 65535, 3900, 8604, 65535, 6914, 65535,
+  7692, 65535, 6456, 65535, 1002, 65535, 65535, 1735, 4170, 65535, 65535, 5139, 65535, 65535, 65535, 65535,
+  65535, 9597, 65535, 9374, 65535, 7948, 65535, 8392, 65535, 8466, 65535, 4125, 65535, 7497, 65535, 7363,
+  // MR11
+  5082, 65535, 5642, 65535, 6651, 65535, 7420, 65535, 7689, 65535, 8809, 65535, 10232, 65535, 11148, 65535,
+  12610, 65535, 12919, 65535, 3964, 65535, 65535, 2072, 65535, 880, 65535, 332, 65535, 6913, 65535, 5656,
+  65535, 5260, 65535, 3963, 65535, 2904, 65535, 2643, 65535, 8038, 65535, 65535, 65535, 7404, 65535, 6685,
+  7507, 65535, 4178, 65535, 65535, 3039, 65535, 2248, 2911, 65535, 65535, 65535, 4056, 65535, 65535, 65535,
+  5713, 65535, 5140, 65535, 7681, 65535, 8249, 65535, 8260, 65535, 10114, 65535, 13024, 65535, 13093, 65535,
+  4553, 65535, 65535, 6134, 6922, 65535, 65535, 8068, 9521, 65535, 65535, 10911, 11924, 65535, 65535, 3511,
+  65535, 2380, 1483, 65535, 65535, 0, 6393, 65535, 65535, 4488, 3464, 65535, 4945, 65535, 7156, 65535,
+  7934, 65535, 12670, 65535, 65535, 7797, 7064, 65535, 65535, 3649, 2680, 65535, 65535, 4377, 65535, 65535,
+  65535, 5938, 65535, 5715, 65535, 8190, 65535, 8634, 65535, 8708, 65535, 10339, 65535, 13711, 65535, 13577,
+  // BR12
+  6053, 65535, 6613, 65535, 7622, 65535, 8391, 65535, 8660, 65535, 9780, 65535, 11203, 65535, 12119, 65535,
+  13581, 65535, 13890, 65535, 4935, 65535, 65535, 3043, 65535, 1851, 65535, 1303, 65535, 520, 65535, 4183,
+  65535, 3787, 65535, 4934, 65535, 3875, 65535, 3614, 65535, 1645, 65535, 65535, 65535, 1011, 65535, 292,
+  1114, 65535, 2250, 65535, 65535, 4010, 65535, 3219, 3882, 65535, 65535, 65535, 5027, 65535, 65535, 65535,
+  6684, 65535, 6111, 65535, 8652, 65535, 9220, 65535, 9231, 65535, 11085, 65535, 13995, 65535, 14064, 65535,
+  5524, 65535, 65535, 7105, 7893, 65535, 65535, 9039, 10492, 65535, 65535, 11882, 12895, 65535, 65535, 4482,
+  65535, 3351, 2454, 65535, 65535, 971, 0, 65535, 65535, 3015, 4435, 65535, 5916, 65535, 8127, 65535,
+  8905, 65535, 13641, 65535, 65535, 1404, 671, 65535, 65535, 1721, 3651, 65535, 65535, 5348, 65535, 65535,
+  65535, 6909, 65535, 6686, 65535, 9161, 65535, 9605, 65535, 9679, 65535, 11310, 65535, 14682, 65535, 14548,
+  // MR12
+  13742, 65535, 14302, 65535, 5438, 65535, 6207, 65535, 6476, 65535, 7596, 65535, 9019, 65535, 9935, 65535,
+  11397, 65535, 11706, 65535, 12624, 65535, 4321, 65535, 5513, 65535, 6061, 65535, 6844, 65535, 737, 65535,
+  1133, 65535, 2430, 65535, 3489, 65535, 3750, 65535, 7154, 65535, 7717, 65535, 7788, 65535, 4628, 65535,
+  65535, 3806, 65535, 2670, 3809, 65535, 4600, 65535, 65535, 65535, 4605, 65535, 65535, 65535, 65535, 65535,
+  14373, 65535, 13800, 65535, 6468, 65535, 7036, 65535, 7047, 65535, 8901, 65535, 11811, 65535, 11880, 65535,
+  13213, 65535, 65535, 4921, 5709, 65535, 65535, 6855, 8308, 65535, 65535, 9698, 10711, 65535, 65535, 12171,
+  4013, 65535, 65535, 4910, 6393, 65535, 65535, 0, 1905, 65535, 65535, 2929, 13605, 65535, 5943, 65535,
+  6721, 65535, 11457, 65535, 7395, 65535, 65535, 4249, 3199, 65535, 65535, 4168, 65535, 65535, 65535, 65535,
+  65535, 14598, 65535, 14375, 65535, 6977, 65535, 7421, 65535, 7495, 65535, 9126, 65535, 12498, 65535, 12364,
+  // BR13
+  11837, 65535, 12397, 65535, 3533, 65535, 4302, 65535, 4571, 65535, 5691, 65535, 7114, 65535, 8030, 65535,
+  9492, 65535, 9801, 65535, 10719, 65535, 2416, 65535, 3608, 65535, 4156, 65535, 4939, 65535, 3752, 65535,
+  4148, 65535, 525, 65535, 1584, 65535, 1845, 65535, 5249, 65535, 5812, 65535, 5883, 65535, 2723, 65535,
+  65535, 1901, 65535, 765, 1904, 65535, 2695, 65535, 65535, 65535, 2700, 65535, 65535, 65535, 65535, 65535,
+  12468, 65535, 11895, 65535, 4563, 65535, 5131, 65535, 5142, 65535, 6996, 65535, 9906, 65535, 9975, 65535,
+  11308, 65535, 65535, 3016, 3804, 65535, 65535, 4950, 6403, 65535, 65535, 7793, 8806, 65535, 65535, 10266,
+  2108, 65535, 65535, 3005, 4488, 65535, 65535, 3015, 0, 65535, 65535, 1024, 11700, 65535, 4038, 65535,
+  4816, 65535, 9552, 65535, 5490, 65535, 65535, 2344, 1294, 65535, 65535, 2263, 65535, 65535, 65535, 65535,
+  65535, 12693, 65535, 12470, 65535, 5072, 65535, 5516, 65535, 5590, 65535, 7221, 65535, 10593, 65535, 10459,
+  // MR13
+  7958, 65535, 8518, 65535, 9527, 65535, 10296, 65535, 10565, 65535, 11685, 65535, 13108, 65535, 14024, 65535,
+  15486, 65535, 15795, 65535, 6840, 65535, 65535, 4948, 65535, 3756, 65535, 3208, 65535, 2425, 65535, 1168,
+  65535, 772, 65535, 6839, 65535, 5780, 65535, 5519, 65535, 3550, 65535, 65535, 65535, 2916, 65535, 2197,
+  3019, 65535, 4155, 65535, 65535, 5915, 65535, 5124, 5787, 65535, 65535, 65535, 6932, 65535, 65535, 65535,
+  8589, 65535, 8016, 65535, 10557, 65535, 11125, 65535, 11136, 65535, 12990, 65535, 15900, 65535, 15969, 65535,
+  7429, 65535, 65535, 9010, 9798, 65535, 65535, 10944, 12397, 65535, 65535, 13787, 14800, 65535, 65535, 6387,
+  65535, 5256, 4359, 65535, 65535, 2876, 1905, 65535, 65535, 0, 6340, 65535, 7821, 65535, 10032, 65535,
+  10810, 65535, 15546, 65535, 65535, 3309, 2576, 65535, 65535, 3626, 5556, 65535, 65535, 7253, 65535, 65535,
+  65535, 8814, 65535, 8591, 65535, 11066, 65535, 11510, 65535, 11584, 65535, 13215, 65535, 16587, 65535, 16453,
+  // BR14
+  8982, 65535, 9542, 65535, 10551, 65535, 11320, 65535, 11589, 65535, 12709, 65535, 14132, 65535, 15048, 65535,
+  16510, 65535, 16819, 65535, 7864, 65535, 65535, 5972, 65535, 4780, 65535, 4232, 65535, 3449, 65535, 2192,
+  65535, 1796, 65535, 499, 65535, 6804, 65535, 6543, 65535, 4574, 65535, 65535, 65535, 3940, 65535, 3221,
+  4043, 65535, 5179, 65535, 65535, 6939, 65535, 6148, 6811, 65535, 65535, 65535, 592, 65535, 65535, 65535,
+  9613, 65535, 9040, 65535, 11581, 65535, 12149, 65535, 12160, 65535, 14014, 65535, 16924, 65535, 16993, 65535,
+  8453, 65535, 65535, 10034, 10822, 65535, 65535, 11968, 13421, 65535, 65535, 14811, 15824, 65535, 65535, 7411,
+  65535, 6280, 5383, 65535, 65535, 3900, 2929, 65535, 65535, 1024, 0, 65535, 8845, 65535, 11056, 65535,
+  11834, 65535, 16570, 65535, 65535, 4333, 3600, 65535, 65535, 4650, 6580, 65535, 65535, 913, 65535, 65535,
+  65535, 9838, 65535, 9615, 65535, 12090, 65535, 12534, 65535, 12608, 65535, 14239, 65535, 17611, 65535, 17477,
+  // MR14
+  10813, 65535, 11373, 65535, 2509, 65535, 3278, 65535, 3547, 65535, 4667, 65535, 6090, 65535, 7006, 65535,
+  8468, 65535, 8777, 65535, 9695, 65535, 1392, 65535, 2584, 65535, 3132, 65535, 3915, 65535, 5172, 65535,
+  5568, 65535, 6865, 65535, 560, 65535, 821, 65535, 4225, 65535, 4788, 65535, 4859, 65535, 5578, 65535,
+  65535, 8241, 65535, 7105, 8244, 65535, 9035, 65535, 65535, 65535, 1676, 65535, 65535, 65535, 65535, 65535,
+  11444, 65535, 10871, 65535, 3539, 65535, 4107, 65535, 4118, 65535, 5972, 65535, 8882, 65535, 8951, 65535,
+  10284, 65535, 65535, 1992, 2780, 65535, 65535, 3926, 5379, 65535, 65535, 6769, 7782, 65535, 65535, 9242,
+  1084, 65535, 65535, 1981, 3464, 65535, 65535, 4435, 6340, 65535, 65535, 0, 10676, 65535, 3014, 65535,
+  3792, 65535, 8528, 65535, 4466, 65535, 65535, 5199, 7634, 65535, 65535, 8603, 65535, 65535, 65535, 65535,
+  65535, 11669, 65535, 11446, 65535, 4048, 65535, 4492, 65535, 4566, 65535, 6197, 65535, 9569, 65535, 9435,
+  // BR15
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  768, 65535, 195, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 993, 65535, 770, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  // MR15
+  13686, 9736, 14246, 9176, 11354, 8167, 12123, 7398, 12392, 7129, 7540, 6009, 8963, 4586, 9879, 3670,
+  11341, 2208, 11650, 1899, 12568, 981, 10237, 10676, 4065, 9484, 4613, 8936, 5396, 14125, 6653, 12868,
+  7049, 12472, 8346, 11175, 9405, 10116, 9666, 9855, 5706, 7843, 6269, 7280, 6340, 14616, 7059, 13897,
+  14719, 9722, 12782, 8586, 9725, 11643, 2697, 10852, 11515, 2034, 10521, 9000, 11268, 65535, 4384, 65535,
+  14317, 65535, 13744, 65535, 12384, 65535, 12952, 65535, 12963, 65535, 8845, 65535, 11755, 65535, 11824, 65535,
+  13157, 392, 8684, 10837, 11625, 7896, 6750, 6799, 8252, 5297, 3907, 9642, 10655, 2894, 1434, 12115,
+  9929, 9592, 10087, 3462, 4945, 8604, 13605, 5916, 7821, 11700, 10676, 8845, 13549, 0, 11859, 65535,
+  12637, 65535, 11401, 65535, 5947, 7602, 14276, 6680, 9115, 12253, 11284, 2265, 65535, 11589, 65535, 5120,
+  65535, 14542, 65535, 14319, 65535, 12893, 65535, 13337, 65535, 13411, 65535, 9070, 65535, 12442, 65535, 12308,
+  // BR16
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 525, 65535, 1093, 65535, 1104, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 65535,
+  778, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 1034, 65535, 1478, 65535, 1552, 65535, 65535, 65535, 65535, 65535, 65535,
+  // MR16
+  11996, 2074, 12556, 1514, 13565, 505, 14334, 9609, 14603, 9340, 9751, 8220, 11174, 6797, 12090, 5881,
+  13552, 4419, 13861, 4110, 10878, 3192, 12448, 8986, 6276, 7794, 6824, 7246, 7607, 6463, 8864, 5206,
+  9260, 4810, 10557, 3513, 11616, 2454, 11877, 2193, 7917, 7588, 8480, 9491, 8551, 6954, 9270, 6235,
+  7057, 11933, 8193, 10797, 11936, 9953, 4908, 9162, 9825, 4245, 12732, 1338, 3606, 65535, 6595, 65535,
+  12627, 65535, 12054, 65535, 14595, 65535, 15163, 65535, 15174, 65535, 11056, 65535, 13966, 65535, 14035, 65535,
+  11467, 2603, 1022, 13048, 13836, 234, 8961, 9010, 10463, 7508, 6118, 11853, 12866, 5105, 3645, 10425,
+  12140, 1930, 8397, 5673, 7156, 6914, 5943, 8127, 10032, 4038, 3014, 11056, 11859, 65535, 14070, 0,
+  14848, 65535, 13612, 65535, 8158, 7347, 6614, 8891, 11326, 7664, 9594, 4476, 65535, 3927, 65535, 7331,
+  65535, 12852, 65535, 12629, 65535, 15104, 65535, 15548, 65535, 15622, 65535, 11281, 65535, 14653, 65535, 14519,
+  // BR17
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 315, 65535, 326, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  0, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 700, 65535, 774, 65535, 65535, 65535, 65535, 65535, 65535,
+  // MR17
+  12774, 2852, 13334, 2292, 14343, 1283, 15112, 10387, 15381, 10118, 10529, 8998, 11952, 7575, 12868, 6659,
+  14330, 5197, 14639, 4888, 11656, 3970, 13226, 9764, 7054, 8572, 7602, 8024, 8385, 7241, 9642, 5984,
+  10038, 5588, 11335, 4291, 12394, 3232, 12655, 2971, 8695, 8366, 9258, 10269, 9329, 7732, 10048, 7013,
+  7835, 12711, 8971, 11575, 12714, 10731, 5686, 9940, 10603, 5023, 13510, 2116, 4384, 65535, 7373, 65535,
+  13405, 65535, 12832, 65535, 15373, 65535, 15941, 65535, 15952, 65535, 11834, 65535, 14744, 65535, 14813, 65535,
+  12245, 3381, 1800, 13826, 14614, 1012, 9739, 9788, 11241, 8286, 6896, 12631, 13644, 5883, 4423, 11203,
+  12918, 2708, 9175, 6451, 7934, 7692, 6721, 8905, 10810, 4816, 3792, 11834, 12637, 65535, 14848, 778,
+  15626, 0, 14390, 65535, 8936, 8125, 7392, 9669, 12104, 8442, 10372, 5254, 65535, 4705, 65535, 8109,
+  65535, 13630, 65535, 13407, 65535, 15882, 65535, 16326, 65535, 16400, 65535, 12059, 65535, 15431, 65535, 15297,
+  // BR18
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 354, 65535, 423, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 0, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1041, 65535, 907,
+  // MR18
+  11538, 7588, 12098, 7028, 13107, 6019, 13876, 5250, 14145, 4981, 15265, 3861, 16688, 2438, 17604, 1522,
+  19066, 9933, 19375, 9624, 10420, 8706, 17962, 8528, 11790, 7336, 12338, 6788, 13121, 11977, 14378, 10720,
+  14774, 10324, 16071, 9027, 17130, 7968, 17391, 7707, 13431, 5695, 13994, 5132, 14065, 12468, 14784, 11749,
+  12571, 17447, 10634, 16311, 17450, 9495, 10422, 8704, 9367, 9759, 18246, 6852, 9120, 65535, 2236, 65535,
+  12169, 65535, 11596, 65535, 14137, 65535, 14705, 65535, 14716, 65535, 16570, 65535, 19480, 65535, 19549, 65535,
+  11009, 8117, 6536, 12590, 13378, 5748, 4602, 14524, 15977, 3149, 1759, 17367, 18380, 746, 9159, 9967,
+  17654, 7444, 7939, 11187, 12670, 6456, 11457, 13641, 15546, 9552, 8528, 16570, 11401, 65535, 13612, 65535,
+  14390, 65535, 19126, 0, 13672, 5454, 12128, 14405, 16840, 10105, 9136, 9990, 65535, 9441, 65535, 2972,
+  65535, 12394, 65535, 12171, 65535, 14646, 65535, 15090, 65535, 15164, 65535, 16795, 65535, 20167, 65535, 20033,
+  // BR153
+  7739, 65535, 8299, 65535, 6842, 65535, 7611, 65535, 7880, 65535, 1593, 65535, 3016, 65535, 3932, 65535,
+  5394, 65535, 5703, 65535, 6621, 65535, 5725, 65535, 6917, 65535, 7465, 65535, 8248, 65535, 2141, 65535,
+  2537, 65535, 3834, 65535, 4893, 65535, 5154, 65535, 8558, 65535, 322, 65535, 393, 65535, 1112, 65535,
+  65535, 5210, 65535, 4074, 5213, 65535, 6004, 65535, 65535, 65535, 6009, 65535, 65535, 65535, 65535, 65535,
+  8370, 65535, 7797, 65535, 7872, 65535, 8440, 65535, 8451, 65535, 2898, 65535, 5808, 65535, 5877, 65535,
+  7210, 65535, 65535, 6325, 7113, 65535, 65535, 852, 2305, 65535, 65535, 3695, 4708, 65535, 65535, 6168,
+  5417, 65535, 65535, 6314, 7797, 65535, 65535, 1404, 3309, 65535, 65535, 4333, 7602, 65535, 7347, 65535,
+  8125, 65535, 5454, 65535, 0, 65535, 65535, 733, 4603, 65535, 65535, 5572, 65535, 65535, 65535, 65535,
+  65535, 8595, 65535, 8372, 65535, 8381, 65535, 8825, 65535, 8899, 65535, 3123, 65535, 6495, 65535, 6361,
+  // MR153
+  6084, 65535, 6644, 65535, 7653, 65535, 8422, 65535, 8691, 65535, 9811, 65535, 11234, 65535, 12150, 65535,
+  13612, 65535, 13921, 65535, 4966, 65535, 65535, 3074, 65535, 1882, 65535, 1334, 65535, 7915, 65535, 6658,
+  65535, 6262, 65535, 4965, 65535, 3906, 65535, 3645, 65535, 241, 65535, 65535, 65535, 8406, 65535, 7687,
+  8509, 65535, 5180, 65535, 65535, 4041, 65535, 3250, 3913, 65535, 65535, 65535, 5058, 65535, 65535, 65535,
+  6715, 65535, 6142, 65535, 8683, 65535, 9251, 65535, 9262, 65535, 11116, 65535, 14026, 65535, 14095, 65535,
+  5555, 65535, 65535, 7136, 7924, 65535, 65535, 9070, 10523, 65535, 65535, 11913, 12926, 65535, 65535, 4513,
+  65535, 3382, 2485, 65535, 65535, 1002, 7395, 65535, 65535, 5490, 4466, 65535, 5947, 65535, 8158, 65535,
+  8936, 65535, 13672, 65535, 65535, 0, 8066, 65535, 65535, 4651, 3682, 65535, 65535, 5379, 65535, 65535,
+  65535, 6940, 65535, 6717, 65535, 9192, 65535, 9636, 65535, 9710, 65535, 11341, 65535, 14713, 65535, 14579,
+  // BR154
+  6817, 65535, 7377, 65535, 8386, 65535, 9155, 65535, 9424, 65535, 10544, 65535, 11967, 65535, 12883, 65535,
+  14345, 65535, 14654, 65535, 5699, 65535, 65535, 3807, 65535, 2615, 65535, 2067, 65535, 4769, 65535, 3512,
+  65535, 3116, 65535, 5698, 65535, 4639, 65535, 4378, 65535, 974, 65535, 65535, 65535, 340, 65535, 4541,
+  443, 65535, 1579, 65535, 65535, 4774, 65535, 3983, 4646, 65535, 65535, 65535, 5791, 65535, 65535, 65535,
+  7448, 65535, 6875, 65535, 9416, 65535, 9984, 65535, 9995, 65535, 11849, 65535, 14759, 65535, 14828, 65535,
+  6288, 65535, 65535, 7869, 8657, 65535, 65535, 9803, 11256, 65535, 65535, 12646, 13659, 65535, 65535, 5246,
+  65535, 4115, 3218, 65535, 65535, 1735, 4249, 65535, 65535, 2344, 5199, 65535, 6680, 65535, 8891, 65535,
+  9669, 65535, 14405, 65535, 65535, 733, 0, 65535, 65535, 1050, 4415, 65535, 65535, 6112, 65535, 65535,
+  65535, 7673, 65535, 7450, 65535, 9925, 65535, 10369, 65535, 10443, 65535, 12074, 65535, 15446, 65535, 15312,
+  // MR154
+  14413, 65535, 14973, 65535, 6109, 65535, 6878, 65535, 7147, 65535, 8267, 65535, 9690, 65535, 10606, 65535,
+  12068, 65535, 12377, 65535, 13295, 65535, 4992, 65535, 6184, 65535, 6732, 65535, 7515, 65535, 1408, 65535,
+  1804, 65535, 3101, 65535, 4160, 65535, 4421, 65535, 7825, 65535, 8388, 65535, 8459, 65535, 379, 65535,
+  65535, 4477, 65535, 3341, 4480, 65535, 5271, 65535, 65535, 65535, 5276, 65535, 65535, 65535, 65535, 65535,
+  15044, 65535, 14471, 65535, 7139, 65535, 7707, 65535, 7718, 65535, 9572, 65535, 12482, 65535, 12551, 65535,
+  13884, 65535, 65535, 5592, 6380, 65535, 65535, 7526, 8979, 65535, 65535, 10369, 11382, 65535, 65535, 12842,
+  4684, 65535, 65535, 5581, 7064, 65535, 65535, 671, 2576, 65535, 65535, 3600, 14276, 65535, 6614, 65535,
+  7392, 65535, 12128, 65535, 8066, 65535, 65535, 0, 3870, 65535, 65535, 4839, 65535, 65535, 65535, 65535,
+  65535, 15269, 65535, 15046, 65535, 7648, 65535, 8092, 65535, 8166, 65535, 9797, 65535, 13169, 65535, 13035,
+  // BR155
+  12390, 65535, 12950, 65535, 7159, 65535, 7928, 65535, 8197, 65535, 6244, 65535, 7667, 65535, 8583, 65535,
+  10045, 65535, 10354, 65535, 11272, 65535, 6042, 65535, 2769, 65535, 3317, 65535, 4100, 65535, 2458, 65535,
+  2854, 65535, 4151, 65535, 5210, 65535, 5471, 65535, 4410, 65535, 4973, 65535, 5044, 65535, 1429, 65535,
+  65535, 607, 65535, 4391, 610, 65535, 1401, 65535, 65535, 65535, 6326, 65535, 65535, 65535, 65535, 65535,
+  13021, 65535, 12448, 65535, 8189, 65535, 8757, 65535, 8768, 65535, 7549, 65535, 10459, 65535, 10528, 65535,
+  11861, 65535, 65535, 6642, 7430, 65535, 65535, 5503, 6956, 65535, 65535, 8346, 9359, 65535, 65535, 10819,
+  5734, 65535, 65535, 2166, 3649, 65535, 65535, 1721, 3626, 65535, 65535, 4650, 12253, 65535, 7664, 65535,
+  8442, 65535, 10105, 65535, 4651, 65535, 65535, 1050, 0, 65535, 65535, 969, 65535, 65535, 65535, 65535,
+  65535, 13246, 65535, 13023, 65535, 8698, 65535, 9142, 65535, 9216, 65535, 7774, 65535, 11146, 65535, 11012,
+  // MR155
+  9252, 65535, 9812, 65535, 10821, 65535, 11590, 65535, 11859, 65535, 12979, 65535, 14402, 65535, 15318, 65535,
+  16780, 65535, 17089, 65535, 8134, 65535, 65535, 6242, 65535, 5050, 65535, 4502, 65535, 3719, 65535, 2462,
+  65535, 2066, 65535, 8133, 65535, 7074, 65535, 6813, 65535, 4844, 65535, 65535, 65535, 4210, 65535, 3491,
+  4313, 65535, 529, 65535, 65535, 7209, 65535, 6418, 7081, 65535, 65535, 65535, 8226, 65535, 65535, 65535,
+  9883, 65535, 9310, 65535, 11851, 65535, 12419, 65535, 12430, 65535, 14284, 65535, 17194, 65535, 17263, 65535,
+  8723, 65535, 65535, 10304, 11092, 65535, 65535, 12238, 13691, 65535, 65535, 15081, 16094, 65535, 65535, 7681,
+  65535, 6550, 5653, 65535, 65535, 4170, 3199, 65535, 65535, 1294, 7634, 65535, 9115, 65535, 11326, 65535,
+  12104, 65535, 16840, 65535, 65535, 4603, 3870, 65535, 65535, 0, 6850, 65535, 65535, 8547, 65535, 65535,
+  65535, 10108, 65535, 9885, 65535, 12360, 65535, 12804, 65535, 12878, 65535, 14509, 65535, 17881, 65535, 17747,
+  // BR156
+  2402, 65535, 2962, 65535, 3971, 65535, 4740, 65535, 5009, 65535, 6129, 65535, 7552, 65535, 8468, 65535,
+  9930, 65535, 10239, 65535, 1284, 65535, 65535, 7211, 65535, 6019, 65535, 5471, 65535, 4688, 65535, 3431,
+  65535, 3035, 65535, 9102, 65535, 8043, 65535, 7782, 65535, 5813, 65535, 65535, 65535, 5179, 65535, 4460,
+  5282, 65535, 1498, 65535, 65535, 359, 65535, 7387, 231, 65535, 65535, 65535, 9195, 65535, 65535, 65535,
+  3033, 65535, 2460, 65535, 5001, 65535, 5569, 65535, 5580, 65535, 7434, 65535, 10344, 65535, 10413, 65535,
+  1873, 65535, 65535, 3454, 4242, 65535, 65535, 5388, 6841, 65535, 65535, 8231, 9244, 65535, 65535, 831,
+  65535, 7519, 6622, 65535, 65535, 5139, 4168, 65535, 65535, 2263, 8603, 65535, 2265, 65535, 4476, 65535,
+  5254, 65535, 9990, 65535, 65535, 5572, 4839, 65535, 65535, 969, 0, 65535, 65535, 9516, 65535, 65535,
+  65535, 3258, 65535, 3035, 65535, 5510, 65535, 5954, 65535, 6028, 65535, 7659, 65535, 11031, 65535, 10897,
+  // MR156
+  11421, 65535, 11981, 65535, 9089, 65535, 9858, 65535, 10127, 65535, 5275, 65535, 6698, 65535, 7614, 65535,
+  9076, 65535, 9385, 65535, 10303, 65535, 7972, 65535, 1800, 65535, 2348, 65535, 3131, 65535, 4388, 65535,
+  4784, 65535, 6081, 65535, 7140, 65535, 7401, 65535, 3441, 65535, 4004, 65535, 4075, 65535, 4794, 65535,
+  65535, 7457, 65535, 6321, 7460, 65535, 432, 65535, 65535, 65535, 8256, 65535, 65535, 65535, 65535, 65535,
+  12052, 65535, 11479, 65535, 10119, 65535, 10687, 65535, 10698, 65535, 6580, 65535, 9490, 65535, 9559, 65535,
+  10892, 65535, 65535, 8572, 9360, 65535, 65535, 4534, 5987, 65535, 65535, 7377, 8390, 65535, 65535, 9850,
+  7664, 65535, 65535, 1197, 2680, 65535, 65535, 3651, 5556, 65535, 65535, 6580, 11284, 65535, 9594, 65535,
+  10372, 65535, 9136, 65535, 3682, 65535, 65535, 4415, 6850, 65535, 65535, 0, 65535, 65535, 65535, 65535,
+  65535, 12277, 65535, 12054, 65535, 10628, 65535, 11072, 65535, 11146, 65535, 6805, 65535, 10177, 65535, 10043,
+  // EN1
+  11726, 65535, 12286, 65535, 3422, 65535, 4191, 65535, 4460, 65535, 5580, 65535, 7003, 65535, 7919, 65535,
+  9381, 65535, 9690, 65535, 10608, 65535, 2305, 65535, 3497, 65535, 4045, 65535, 4828, 65535, 6085, 65535,
+  6481, 65535, 7778, 65535, 1473, 65535, 1734, 65535, 5138, 65535, 5701, 65535, 5772, 65535, 6491, 65535,
+  65535, 9154, 65535, 8018, 9157, 65535, 9948, 65535, 65535, 65535, 2589, 65535, 65535, 321, 65535, 65535,
+  12357, 65535, 11784, 65535, 4452, 65535, 5020, 65535, 5031, 65535, 6885, 65535, 9795, 65535, 9864, 65535,
+  11197, 65535, 65535, 2905, 3693, 65535, 65535, 4839, 6292, 65535, 65535, 7682, 8695, 65535, 65535, 10155,
+  1997, 65535, 65535, 2894, 4377, 65535, 65535, 5348, 7253, 65535, 65535, 913, 11589, 65535, 3927, 65535,
+  4705, 65535, 9441, 65535, 5379, 65535, 65535, 6112, 8547, 65535, 65535, 9516, 0, 65535, 65535, 65535,
+  65535, 12582, 65535, 12359, 65535, 4961, 65535, 5405, 65535, 5479, 65535, 7110, 65535, 10482, 65535, 10348,
+  // EX1
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  // EN2
+  5257, 65535, 5817, 65535, 6826, 65535, 7595, 65535, 7864, 65535, 8984, 65535, 10407, 65535, 1450, 65535,
+  2912, 65535, 3221, 65535, 4139, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 736,
+  5888, 65535, 5315, 65535, 7856, 65535, 8424, 65535, 8435, 65535, 10289, 65535, 3326, 65535, 3395, 65535,
+  4728, 65535, 65535, 6309, 7097, 65535, 65535, 8243, 9696, 65535, 65535, 1213, 2226, 65535, 65535, 3686,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5120, 65535, 7331, 65535,
+  8109, 65535, 2972, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 65535,
+  65535, 6113, 65535, 5890, 65535, 8365, 65535, 8809, 65535, 8883, 65535, 10514, 65535, 4013, 65535, 3879,
+  // EX2
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  // EN3
+  14679, 10729, 15239, 10169, 12347, 9160, 13116, 8391, 13385, 8122, 8533, 7002, 9956, 5579, 10872, 4663,
+  12334, 3201, 12643, 2892, 13561, 1974, 11230, 11669, 5058, 10477, 5606, 9929, 6389, 15118, 7646, 13861,
+  8042, 13465, 9339, 12168, 10398, 11109, 10659, 10848, 6699, 8836, 7262, 8273, 7333, 15609, 8052, 14890,
+  15712, 10715, 13775, 9579, 10718, 12636, 3690, 11845, 12508, 3027, 11514, 9993, 12261, 65535, 5377, 65535,
+  15310, 225, 14737, 65535, 13377, 65535, 13945, 65535, 13956, 65535, 9838, 65535, 12748, 65535, 12817, 65535,
+  14150, 1385, 9677, 11830, 12618, 8889, 7743, 7792, 9245, 6290, 4900, 10635, 11648, 3887, 2427, 13108,
+  10922, 10585, 11080, 4455, 5938, 9597, 14598, 6909, 8814, 12693, 11669, 9838, 14542, 993, 12852, 65535,
+  13630, 65535, 12394, 65535, 6940, 8595, 15269, 7673, 10108, 13246, 12277, 3258, 65535, 12582, 65535, 6113,
+  0, 15535, 65535, 15312, 65535, 13886, 65535, 14330, 65535, 14404, 65535, 10063, 65535, 13435, 65535, 13301,
+  // EX3
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 0, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  // EN4
+  14456, 10506, 15016, 9946, 12124, 8937, 12893, 8168, 13162, 7899, 8310, 6779, 9733, 5356, 10649, 4440,
+  12111, 2978, 12420, 2669, 13338, 1751, 11007, 11446, 4835, 10254, 5383, 9706, 6166, 14895, 7423, 13638,
+  7819, 13242, 9116, 11945, 10175, 10886, 10436, 10625, 6476, 8613, 7039, 8050, 7110, 15386, 7829, 14667,
+  15489, 10492, 13552, 9356, 10495, 12413, 3467, 11622, 12285, 2804, 11291, 9770, 12038, 65535, 5154, 65535,
+  15087, 65535, 14514, 575, 13154, 65535, 13722, 65535, 13733, 65535, 9615, 65535, 12525, 65535, 12594, 65535,
+  13927, 1162, 9454, 11607, 12395, 8666, 7520, 7569, 9022, 6067, 4677, 10412, 11425, 3664, 2204, 12885,
+  10699, 10362, 10857, 4232, 5715, 9374, 14375, 6686, 8591, 12470, 11446, 9615, 14319, 770, 12629, 65535,
+  13407, 65535, 12171, 65535, 6717, 8372, 15046, 7450, 9885, 13023, 12054, 3035, 65535, 12359, 65535, 5890,
+  65535, 15312, 0, 15089, 65535, 13663, 65535, 14107, 65535, 14181, 65535, 9840, 65535, 13212, 65535, 13078,
+  // EX4
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 0, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  // EN5
+  13030, 3108, 13590, 2548, 14599, 1539, 15368, 10643, 15637, 10374, 10785, 9254, 12208, 7831, 13124, 6915,
+  14586, 5453, 14895, 5144, 11912, 4226, 13482, 10020, 7310, 8828, 7858, 8280, 8641, 7497, 9898, 6240,
+  10294, 5844, 11591, 4547, 12650, 3488, 12911, 3227, 8951, 8622, 9514, 10525, 9585, 7988, 10304, 7269,
+  8091, 12967, 9227, 11831, 12970, 10987, 5942, 10196, 10859, 5279, 13766, 2372, 4640, 65535, 7629, 65535,
+  13661, 65535, 13088, 65535, 15629, 509, 16197, 65535, 16208, 65535, 12090, 65535, 15000, 65535, 15069, 65535,
+  12501, 3637, 2056, 14082, 14870, 1268, 9995, 10044, 11497, 8542, 7152, 12887, 13900, 6139, 4679, 11459,
+  13174, 2964, 9431, 6707, 8190, 7948, 6977, 9161, 11066, 5072, 4048, 12090, 12893, 65535, 15104, 1034,
+  15882, 65535, 14646, 65535, 9192, 8381, 7648, 9925, 12360, 8698, 10628, 5510, 65535, 4961, 65535, 8365,
+  65535, 13886, 65535, 13663, 0, 16138, 65535, 16582, 65535, 16656, 65535, 12315, 65535, 15687, 65535, 15553,
+  // EX5
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 0, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  // EN6
+  13474, 3552, 14034, 2992, 15043, 1983, 15812, 11087, 16081, 10818, 11229, 9698, 12652, 8275, 13568, 7359,
+  15030, 5897, 15339, 5588, 12356, 4670, 13926, 10464, 7754, 9272, 8302, 8724, 9085, 7941, 10342, 6684,
+  10738, 6288, 12035, 4991, 13094, 3932, 13355, 3671, 9395, 9066, 9958, 10969, 10029, 8432, 10748, 7713,
+  8535, 13411, 9671, 12275, 13414, 11431, 6386, 10640, 11303, 5723, 14210, 2816, 5084, 65535, 8073, 65535,
+  14105, 65535, 13532, 65535, 16073, 65535, 16641, 385, 16652, 65535, 12534, 65535, 15444, 65535, 15513, 65535,
+  12945, 4081, 2500, 14526, 15314, 1712, 10439, 10488, 11941, 8986, 7596, 13331, 14344, 6583, 5123, 11903,
+  13618, 3408, 9875, 7151, 8634, 8392, 7421, 9605, 11510, 5516, 4492, 12534, 13337, 65535, 15548, 1478,
+  16326, 700, 15090, 65535, 9636, 8825, 8092, 10369, 12804, 9142, 11072, 5954, 65535, 5405, 65535, 8809,
+  65535, 14330, 65535, 14107, 65535, 16582, 0, 17026, 65535, 17100, 65535, 12759, 65535, 16131, 65535, 15997,
+  // EX6
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  // EN7
+  13548, 3626, 14108, 3066, 15117, 2057, 15886, 11161, 16155, 10892, 11303, 9772, 12726, 8349, 13642, 7433,
+  15104, 5971, 15413, 5662, 12430, 4744, 14000, 10538, 7828, 9346, 8376, 8798, 9159, 8015, 10416, 6758,
+  10812, 6362, 12109, 5065, 13168, 4006, 13429, 3745, 9469, 9140, 10032, 11043, 10103, 8506, 10822, 7787,
+  8609, 13485, 9745, 12349, 13488, 11505, 6460, 10714, 11377, 5797, 14284, 2890, 5158, 65535, 8147, 65535,
+  14179, 65535, 13606, 65535, 16147, 65535, 16715, 65535, 16726, 448, 12608, 65535, 15518, 65535, 15587, 65535,
+  13019, 4155, 2574, 14600, 15388, 1786, 10513, 10562, 12015, 9060, 7670, 13405, 14418, 6657, 5197, 11977,
+  13692, 3482, 9949, 7225, 8708, 8466, 7495, 9679, 11584, 5590, 4566, 12608, 13411, 65535, 15622, 1552,
+  16400, 774, 15164, 65535, 9710, 8899, 8166, 10443, 12878, 9216, 11146, 6028, 65535, 5479, 65535, 8883,
+  65535, 14404, 65535, 14181, 65535, 16656, 65535, 17100, 0, 17174, 65535, 12833, 65535, 16205, 65535, 16071,
+  // EX7
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 65535, 65535, 65535, 65535, 65535, 65535,
+  // EN8
+  9207, 5257, 9767, 4697, 10776, 3688, 11545, 2919, 11814, 2650, 12934, 1530, 14357, 9980, 15273, 9064,
+  16735, 7602, 17044, 7293, 8089, 6375, 15631, 6197, 9459, 5005, 10007, 4457, 10790, 9646, 12047, 8389,
+  12443, 7993, 13740, 6696, 14799, 5637, 15060, 5376, 11100, 3364, 11663, 2801, 11734, 10137, 12453, 9418,
+  10240, 15116, 8303, 13980, 15119, 7164, 8091, 6373, 7036, 7428, 15915, 4521, 6789, 65535, 9778, 65535,
+  9838, 65535, 9265, 65535, 11806, 65535, 12374, 65535, 12385, 65535, 14239, 225, 17149, 65535, 17218, 65535,
+  8678, 5786, 4205, 10259, 11047, 3417, 2271, 12193, 13646, 818, 9301, 15036, 16049, 8288, 6828, 7636,
+  15323, 5113, 5608, 8856, 10339, 4125, 9126, 11310, 13215, 7221, 6197, 14239, 9070, 65535, 11281, 65535,
+  12059, 65535, 16795, 65535, 11341, 3123, 9797, 12074, 14509, 7774, 6805, 7659, 65535, 7110, 65535, 10514,
+  65535, 10063, 65535, 9840, 65535, 12315, 65535, 12759, 65535, 12833, 0, 14464, 65535, 17836, 65535, 17702,
+  // EX8
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 65535, 65535, 65535, 65535,
+  // EN9
+  12579, 8629, 13139, 8069, 14148, 7060, 14917, 6291, 15186, 6022, 16306, 4902, 17729, 3479, 18645, 2563,
+  20107, 10974, 20416, 10665, 11461, 9747, 19003, 9569, 12831, 8377, 13379, 7829, 14162, 13018, 15419, 11761,
+  15815, 11365, 17112, 10068, 18171, 9009, 18432, 8748, 14472, 6736, 15035, 6173, 15106, 13509, 15825, 12790,
+  13612, 18488, 11675, 17352, 18491, 10536, 11463, 9745, 10408, 10800, 19287, 7893, 10161, 65535, 3277, 65535,
+  13210, 65535, 12637, 65535, 15178, 65535, 15746, 65535, 15757, 65535, 17611, 65535, 20521, 687, 20590, 65535,
+  12050, 9158, 7577, 13631, 14419, 6789, 5643, 15565, 17018, 4190, 2800, 18408, 19421, 1787, 10200, 11008,
+  18695, 8485, 8980, 12228, 13711, 7497, 12498, 14682, 16587, 10593, 9569, 17611, 12442, 65535, 14653, 65535,
+  15431, 65535, 20167, 1041, 14713, 6495, 13169, 15446, 17881, 11146, 10177, 11031, 65535, 10482, 65535, 4013,
+  65535, 13435, 65535, 13212, 65535, 15687, 65535, 16131, 65535, 16205, 65535, 17836, 0, 21208, 65535, 21074,
+  // EX9
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 65535, 65535,
+  // EN10
+  12445, 8495, 13005, 7935, 14014, 6926, 14783, 6157, 15052, 5888, 16172, 4768, 17595, 3345, 18511, 2429,
+  19973, 10840, 20282, 10531, 11327, 9613, 18869, 9435, 12697, 8243, 13245, 7695, 14028, 12884, 15285, 11627,
+  15681, 11231, 16978, 9934, 18037, 8875, 18298, 8614, 14338, 6602, 14901, 6039, 14972, 13375, 15691, 12656,
+  13478, 18354, 11541, 17218, 18357, 10402, 11329, 9611, 10274, 10666, 19153, 7759, 10027, 65535, 3143, 65535,
+  13076, 65535, 12503, 65535, 15044, 65535, 15612, 65535, 15623, 65535, 17477, 65535, 20387, 65535, 20456, 484,
+  11916, 9024, 7443, 13497, 14285, 6655, 5509, 15431, 16884, 4056, 2666, 18274, 19287, 1653, 10066, 10874,
+  18561, 8351, 8846, 12094, 13577, 7363, 12364, 14548, 16453, 10459, 9435, 17477, 12308, 65535, 14519, 65535,
+  15297, 65535, 20033, 907, 14579, 6361, 13035, 15312, 17747, 11012, 10043, 10897, 65535, 10348, 65535, 3879,
+  65535, 13301, 65535, 13078, 65535, 15553, 65535, 15997, 65535, 16071, 65535, 17702, 65535, 21074, 0, 20940,
+  // EX10
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0,
+};
+
+// tracks/trackb.txt
+static const unsigned short TRACKB_SENSOR_LINK_BEGIN[81] = {
+  0, 1, 2, 3, 4, 8, 10, 11, 12, 13, 14, 16, 18, 19, 20, 21,
+  22, 25, 27, 28, 29, 30, 31, 34, 36, 37, 38, 39, 41, 43, 44, 45,
+  46, 47, 49, 51, 52, 53, 54, 55, 57, 59, 60, 62, 63, 64, 65, 66,
+  67, 68, 70, 71, 72, 73, 75, 76, 77, 78, 80, 81, 82, 83, 84, 85,
+  86, 86, 87, 87, 88, 88, 89, 89, 90, 90, 91, 91, 92, 92, 93, 93,
+  94,
+};
+
+static const track_sensor_link_t TRACKB_SENSOR_LINKS[] = {
+  {2, 589}, {23, 1161}, {4, 1401}, {1, 589}, {6, 1293}, {68, 1524}, {70, 2175}, {72, 2234},
+  {3, 1401}, {61, 1438}, {8, 565}, {5, 1293}, {10, 1157}, {7, 565}, {12, 837}, {74, 1266},
+  {9, 1157}, {45, 1415}, {14, 501}, {11, 837}, {16, 919}, {13, 501}, {18, 969}, {76, 1235},
+  {78, 1536}, {15, 919}, {63, 825}, {20, 411}, {17, 969}, {22, 447}, {19, 411}, {0, 1161},
+  {64, 1473}, {66, 1320}, {21, 447}, {59, 565}, {26, 931}, {41, 800}, {28, 582}, {25, 931},
+  {57, 810}, {30, 1126}, {42, 1209}, {27, 582}, {32, 763}, {29, 1126}, {34, 503}, {31, 763},
+  {49, 937}, {36, 1067}, {53, 902}, {33, 503}, {38, 555}, {35, 1067}, {40, 462}, {37, 555},
+  {62, 398}, {24, 800}, {60, 821}, {39, 462}, {44, 1025}, {46, 1303}, {29, 1209}, {10, 1415},
+  {43, 1025}, {48, 1258}, {43, 1303}, {32, 937}, {50, 1259}, {47, 1258}, {52, 1150}, {48, 1259},
+  {35, 902}, {51, 1150}, {54, 1140}, {56, 699}, {52, 1140}, {26, 810}, {58, 710}, {55, 699},
+  {22, 565}, {56, 710}, {4, 1438}, {41, 821}, {16, 825}, {38, 398}, {23, 1473}, {23, 1320},
+  {5, 1524}, {5, 2175}, {5, 2234}, {11, 1266}, {17, 1235}, {17, 1536},
+};
+
+static const unsigned char TRACKB_NODE_TYPE[140] = {
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR, TRACK_NODE_SENSOR,
+  TRACK_NODE_BRANCH, TRACK_NODE_MERGE, TRACK_NODE_BRANCH, TRACK_NODE_MERGE,
+  TRACK_NODE_BRANCH, TRACK_NODE_MERGE, TRACK_NODE_BRANCH, TRACK_NODE_MERGE,
+  TRACK_NODE_BRANCH, TRACK_NODE_MERGE, TRACK_NODE_BRANCH, TRACK_NODE_MERGE,
+  TRACK_NODE_BRANCH, TRACK_NODE_MERGE, TRACK_NODE_BRANCH, TRACK_NODE_MERGE,
+  TRACK_NODE_BRANCH, TRACK_NODE_MERGE, TRACK_NODE_BRANCH, TRACK_NODE_MERGE,
+  TRACK_NODE_BRANCH, TRACK_NODE_MERGE, TRACK_NODE_BRANCH, TRACK_NODE_MERGE,
+  TRACK_NODE_BRANCH, TRACK_NODE_MERGE, TRACK_NODE_BRANCH, TRACK_NODE_MERGE,
+  TRACK_NODE_BRANCH, TRACK_NODE_MERGE, TRACK_NODE_BRANCH, TRACK_NODE_MERGE,
+  TRACK_NODE_BRANCH, TRACK_NODE_MERGE, TRACK_NODE_BRANCH, TRACK_NODE_MERGE,
+  TRACK_NODE_BRANCH, TRACK_NODE_MERGE, TRACK_NODE_BRANCH, TRACK_NODE_MERGE,
+  TRACK_NODE_BRANCH, TRACK_NODE_MERGE, TRACK_NODE_BRANCH, TRACK_NODE_MERGE,
+  TRACK_NODE_ENTER, TRACK_NODE_EXIT, TRACK_NODE_ENTER, TRACK_NODE_EXIT,
+  TRACK_NODE_ENTER, TRACK_NODE_EXIT, TRACK_NODE_ENTER, TRACK_NODE_EXIT,
+  TRACK_NODE_ENTER, TRACK_NODE_EXIT, TRACK_NODE_ENTER, TRACK_NODE_EXIT,
+  TRACK_NODE_ENTER, TRACK_NODE_EXIT, TRACK_NODE_ENTER, TRACK_NODE_EXIT,
+};
+
+static const unsigned char TRACKB_NODE_NUM[140] = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+  32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+  64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+  1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8,
+  9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15, 16, 16,
+  17, 17, 18, 18, 153, 153, 154, 154, 155, 155, 156, 156, 1, 1, 2, 2,
+  3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8,
+};
+
+static const unsigned char TRACKB_EDGE[140][2] = {
+  {2, 255}, {81, 255}, {83, 255}, {1, 255}, {84, 255}, {82, 255}, {8, 255}, {85, 255},
+  {87, 255}, {7, 255}, {88, 255}, {86, 255}, {14, 255}, {89, 255}, {91, 255}, {13, 255},
+  {92, 255}, {90, 255}, {20, 255}, {93, 255}, {95, 255}, {19, 255}, {80, 255}, {94, 255},
+  {99, 255}, {97, 255}, {28, 255}, {98, 255}, {100, 255}, {27, 255}, {103, 255}, {101, 255},
+  {34, 255}, {102, 255}, {104, 255}, {33, 255}, {107, 255}, {105, 255}, {40, 255}, {106, 255},
+  {96, 255}, {39, 255}, {116, 255}, {101, 255}, {87, 255}, {117, 255}, {119, 255}, {117, 255},
+  {103, 255}, {118, 255}, {121, 255}, {119, 255}, {105, 255}, {120, 255}, {123, 255}, {121, 255},
+  {99, 255}, {122, 255}, {95, 255}, {123, 255}, {83, 255}, {97, 255}, {91, 255}, {107, 255},
+  {125, 255}, {109, 255}, {127, 255}, {109, 255}, {129, 255}, {111, 255}, {131, 255}, {113, 255},
+  {133, 255}, {113, 255}, {135, 255}, {89, 255}, {137, 255}, {115, 255}, {139, 255}, {115, 255},
+  {0, 108}, {23, 255}, {3, 61}, {4, 255}, {6, 110}, {5, 255}, {9, 45}, {10, 255},
+  {12, 74}, {11, 255}, {15, 63}, {16, 255}, {18, 114}, {17, 255}, {21, 59}, {22, 255},
+  {24, 60}, {41, 255}, {25, 57}, {26, 255}, {30, 42}, {29, 255}, {31, 49}, {32, 255},
+  {36, 53}, {35, 255}, {37, 62}, {38, 255}, {64, 66}, {81, 255}, {68, 112}, {85, 255},
+  {70, 72}, {111, 255}, {76, 78}, {93, 255}, {44, 46}, {43, 255}, {50, 47}, {48, 255},
+  {51, 54}, {52, 255}, {58, 55}, {56, 255}, {65, 255}, {255, 255}, {67, 255}, {255, 255},
+  {69, 255}, {255, 255}, {71, 255}, {255, 255}, {73, 255}, {255, 255}, {75, 255}, {255, 255},
+  {77, 255}, {255, 255}, {79, 255}, {255, 255},
+};
+
+static const unsigned short TRACKB_EDGE_DIST[140][2] = {
+  {589, 0}, {422, 0}, {727, 0}, {589, 0}, {574, 0}, {674, 0}, {565, 0}, {719, 0},
+  {411, 0}, {565, 0}, {639, 0}, {746, 0}, {501, 0}, {198, 0}, {667, 0}, {501, 0},
+  {626, 0}, {252, 0}, {411, 0}, {343, 0}, {186, 0}, {411, 0}, {739, 0}, {261, 0},
+  {688, 0}, {271, 0}, {582, 0}, {243, 0}, {620, 0}, {582, 0}, {564, 0}, {506, 0},
+  {503, 0}, {199, 0}, {579, 0}, {503, 0}, {352, 0}, {488, 0}, {462, 0}, {203, 0},
+  {529, 0}, {462, 0}, {566, 0}, {589, 0}, {669, 0}, {459, 0}, {534, 0}, {737, 0},
+  {738, 0}, {724, 0}, {746, 0}, {535, 0}, {323, 0}, {404, 0}, {270, 0}, {736, 0},
+  {567, 0}, {429, 0}, {304, 0}, {281, 0}, {764, 0}, {292, 0}, {573, 0}, {195, 0},
+  {322, 0}, {549, 0}, {707, 0}, {396, 0}, {527, 0}, {384, 0}, {539, 0}, {431, 0},
+  {194, 0}, {490, 0}, {323, 0}, {627, 0}, {525, 0}, {249, 0}, {546, 0}, {550, 0},
+  {422, 185}, {739, 0}, {727, 764}, {674, 0}, {719, 566}, {574, 0}, {411, 669}, {746, 0},
+  {198, 627}, {639, 0}, {667, 573}, {252, 0}, {343, 360}, {626, 0}, {186, 304}, {261, 0},
+  {271, 292}, {529, 0}, {688, 567}, {243, 0}, {506, 589}, {620, 0}, {564, 738}, {199, 0},
+  {488, 323}, {579, 0}, {352, 195}, {203, 0}, {549, 396}, {185, 0}, {384, 604}, {566, 0},
+  {431, 490}, {604, 0}, {249, 550}, {360, 0}, {459, 737}, {566, 0}, {535, 534}, {724, 0},
+  {746, 736}, {404, 0}, {281, 270}, {429, 0}, {322, 0}, {0, 0}, {707, 0}, {0, 0},
+  {527, 0}, {0, 0}, {539, 0}, {0, 0}, {194, 0}, {0, 0}, {323, 0}, {0, 0},
+  {525, 0}, {0, 0}, {546, 0}, {0, 0},
+};
+
+static const unsigned char TRACKB_NEXT_DIR[140 * 140] = {
+  // A1
+  255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // A2
+  0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // A3
+  0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // A4
+  0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // A5
+  0, 255, 0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // A6
+  0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // A7
+  0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // A8
+  0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // A9
+  0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // A10
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // A11
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // A12
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // A13
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // A14
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // A15
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // A16
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B1
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B2
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B3
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B4
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B5
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B6
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B7
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B8
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B9
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B10
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B11
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B12
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B13
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B14
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 255, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B15
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // B16
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 255,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C1
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C2
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C3
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C4
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C5
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C6
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C7
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C8
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C9
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C10
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C11
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C12
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C13
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C14
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C15
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // C16
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // D1
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // D2
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // D3
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 255, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // D4
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // D5
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 255, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // D6
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 255, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // D7
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // D8
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 255, 0, 0, 255, 255, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // D9
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // D10
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 255, 0, 255, 255, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // D11
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // D12
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // D13
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // D14
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // D15
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // D16
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // E1
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  // E2
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // E3
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  // E4
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // E5
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  // E6
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // E7
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+  // E8
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // E9
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 0, 255, 255, 255, 255, 255, 255,
+  // E10
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // E11
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 0, 255, 255, 255, 255,
+  // E12
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // E13
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 255,
+  // E14
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // E15
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0,
+  // E16
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR1
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 255, 1,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // MR1
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR2
+  1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 1, 0, 1, 0, 1, 0, 1,
+  0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0,
+  1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 0, 255, 1, 255, 1, 255, 1, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1,
+  0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 1, 255, 0, 255, 0, 255, 1, 255, 0, 1, 1, 0, 0, 1, 1, 0, 255, 1, 255, 1,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 1, 255, 1,
+  // MR2
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR3
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 1, 255, 1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 1, 255, 1, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0,
+  255, 1, 255, 1, 255, 1, 255, 0, 255, 0, 255, 0,
+  // MR3
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR4
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 1, 0, 1, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0,
+  1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 1, 0, 0, 1, 1, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+  0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 255, 1, 255, 1, 255, 0, 255, 0, 1, 0, 0, 0, 1, 1, 0, 255, 1, 255, 1,
+  255, 1, 255, 1, 255, 1, 255, 0, 255, 0, 255, 0,
+  // MR4
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 255, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR5
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 1, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 1, 255, 0, 255, 0,
+  // MR5
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR6
+  0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 0, 1, 0, 0, 1,
+  0, 255, 0, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 0, 0, 0, 1, 1, 0, 0, 1, 1, 0, 255, 1, 1, 0, 0, 0,
+  1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 0, 255, 1, 255, 1, 255, 1, 255, 1, 0, 0, 1, 1, 0, 0, 1, 255, 0, 255, 0,
+  255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1,
+  // MR6
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 255, 0, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR7
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 1, 255, 1, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 255, 0,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 1, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 1, 255, 1,
+  // MR7
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR8
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 1, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 1, 255, 1, 255, 1, 255, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 1, 0, 255, 0,
+  0, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 255, 0, 255, 0, 255, 1, 255, 1, 0, 0, 1, 1, 0, 0, 1, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 1, 255, 1, 255, 1,
+  // MR8
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR9
+  1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 1, 255, 255, 255,
+  1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 255, 1, 1, 255, 255, 1, 1, 255, 255, 1, 1, 255, 255, 1,
+  255, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 1, 255, 1, 255, 1, 255, 1, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 1, 255, 1,
+  255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1,
+  // MR9
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR10
+  1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 1, 255, 255, 0, 255, 1, 255, 1, 255, 1,
+  255, 1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 1, 255, 255, 255, 1, 255, 1, 1, 255, 1, 255, 255, 1, 255, 1, 1, 255, 255, 255, 0, 255,
+  1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 0, 255, 0, 255, 1, 255, 255, 1, 1, 255, 255, 1, 1, 255, 255, 0, 0, 255, 255, 1,
+  255, 0, 255, 255, 255, 1, 1, 255, 255, 1, 0, 255, 1, 255, 1, 255, 1, 255, 0, 255, 255, 1, 1, 255, 255, 1, 1, 255, 255, 1, 255, 1,
+  255, 1, 255, 1, 255, 1, 255, 1, 255, 0, 255, 0,
+  // MR10
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR11
+  1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 1, 255, 1, 255, 1, 255, 1, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255,
+  1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 1, 255, 1, 255, 1, 255, 1, 255, 255, 0, 0, 255, 255, 1, 1, 255, 255, 1, 1, 255, 255, 1,
+  0, 255, 255, 0, 255, 255, 255, 0, 0, 255, 255, 0, 1, 255, 0, 255, 0, 255, 1, 255, 1, 255, 255, 1, 0, 255, 255, 0, 255, 1, 255, 1,
+  255, 0, 255, 0, 255, 0, 255, 1, 255, 1, 255, 1,
+  // MR11
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 255, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR12
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 1, 255, 255, 255, 1, 255, 1, 1, 255, 1, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 255, 255, 255, 1, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 1, 1, 255, 255, 1, 0, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // MR12
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 255, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR13
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 1, 255, 1, 255, 1, 255,
+  1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 1, 255, 1, 255, 1, 255, 1, 255, 255, 1, 255, 1, 1, 255, 1, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 1, 1, 255, 255, 1, 255, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 1, 255, 255, 1, 1, 255, 255, 1, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // MR13
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR14
+  1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 1, 255,
+  1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 255, 1, 1, 255, 255, 1, 1, 255, 255, 1, 1, 255, 255, 1,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 1, 255, 1, 255, 1, 255, 1, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 1, 255, 1,
+  255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1,
+  // MR14
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR15
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  0, 255, 1, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 1,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  // MR15
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR16
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 0, 255, 1, 255, 1, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 0, 255, 1, 255, 1, 255, 255, 255, 255, 255, 255,
+  // MR16
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR17
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 0, 255, 1, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 0, 255, 1, 255, 255, 255, 255, 255, 255,
+  // MR17
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR18
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 1, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 1,
+  // MR18
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR153
+  0, 255, 0, 255, 1, 255, 1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 1, 255, 1, 255, 1, 255, 1, 255,
+  1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 0, 255, 1, 255, 1, 255, 255, 1, 255, 1, 1, 255, 1, 255, 255, 255, 1, 255, 255, 255,
+  0, 255, 0, 255, 1, 255, 1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 1, 1, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  1, 255, 255, 1, 1, 255, 255, 1, 1, 255, 255, 1, 0, 255, 1, 255, 1, 255, 0, 255, 255, 255, 255, 1, 1, 255, 255, 1, 255, 0, 255, 0,
+  255, 1, 255, 1, 255, 1, 255, 0, 255, 0, 255, 0,
+  // MR153
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 255, 0, 0, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR154
+  1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 255, 1, 255, 1, 255, 1, 255, 0,
+  255, 0, 255, 0, 255, 1, 255, 1, 255, 1, 255, 1, 255, 255, 255, 1, 255, 0, 0, 255, 0, 255, 255, 1, 255, 1, 1, 255, 255, 255, 1, 255,
+  1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 255, 1, 1, 255, 255, 1, 1, 255, 255, 1, 1, 255, 255, 1,
+  255, 1, 1, 255, 255, 1, 0, 255, 255, 0, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 255, 1, 255, 255, 255, 0, 1, 255, 255, 1, 255, 1,
+  255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1,
+  // MR154
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR155
+  1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 0, 255, 1, 255, 1, 255, 1, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 1, 255, 1, 255, 1, 255, 0, 255, 255, 0, 255, 0, 1, 255, 1, 255, 255, 255, 0, 255, 255, 255,
+  1, 255, 1, 255, 0, 255, 0, 255, 0, 255, 1, 255, 1, 255, 1, 255, 1, 255, 255, 0, 0, 255, 255, 1, 1, 255, 255, 1, 1, 255, 255, 1,
+  0, 255, 255, 1, 1, 255, 255, 0, 0, 255, 255, 0, 1, 255, 0, 255, 0, 255, 1, 255, 1, 255, 255, 0, 255, 255, 255, 1, 255, 1, 255, 1,
+  255, 0, 255, 0, 255, 0, 255, 1, 255, 1, 255, 1,
+  // MR155
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 255, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 255, 0, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // BR156
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 1, 255, 1, 255, 1, 255, 0, 255, 255, 1, 255, 1, 255, 1, 255, 1,
+  255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 1, 255, 255, 255, 1, 255, 1, 1, 255, 1, 255, 255, 1, 255, 1, 0, 255, 255, 255, 1, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 1, 255, 1, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 1, 1, 255, 255, 0,
+  255, 1, 1, 255, 255, 1, 1, 255, 255, 1, 1, 255, 0, 255, 0, 255, 0, 255, 1, 255, 255, 1, 1, 255, 255, 1, 255, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 1, 255, 1,
+  // MR156
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 255, 0, 255, 255, 255,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0,
+  0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 0, 255, 255, 255, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // EN1
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // EX1
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  // EN2
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // EX2
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  // EN3
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // EX3
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  // EN4
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // EX4
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  // EN5
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // EX5
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  // EN6
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // EX6
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  // EN7
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // EX7
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  // EN8
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 255, 0,
+  255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+  // EX8
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+};
+
+static const unsigned short TRACKB_DIST[140 * 140] = {
+  // A1
+  0, 65535, 589, 65535, 1990, 65535, 3283, 65535, 3848, 65535, 5005, 65535, 5842, 65535, 6343, 65535,
+  7262, 65535, 8231, 65535, 8642, 65535, 9089, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  10562, 65535, 10409, 65535, 3514, 65535, 4165, 65535, 4224, 65535, 6271, 65535, 8497, 65535, 8798, 65535,
+  9828, 65535, 65535, 1316, 2564, 65535, 65535, 4259, 5644, 65535, 65535, 7010, 7888, 65535, 65535, 8828,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 10013, 65535, 3130, 65535,
+  3734, 65535, 8248, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 10884, 65535, 11116,
+  65535, 4041, 65535, 4704, 65535, 4418, 65535, 6594, 65535, 9022, 65535, 9344,
+  // A2
+  12722, 0, 13311, 9661, 6932, 8260, 8225, 6967, 8790, 6402, 7477, 5245, 8314, 4408, 8815, 3907,
+  9734, 2988, 10703, 2019, 11114, 1608, 11561, 1161, 5473, 10407, 3246, 9476, 3828, 8894, 4954, 13869,
+  5717, 13106, 6220, 12603, 7287, 11536, 4211, 10981, 4673, 10519, 5037, 7685, 6062, 6660, 6340, 15301,
+  7598, 14043, 15302, 8272, 12125, 7122, 8262, 10985, 2436, 10286, 10996, 1726, 5494, 9698, 11379, 3813,
+  13034, 65535, 12881, 65535, 8456, 65535, 9107, 65535, 9166, 65535, 8743, 65535, 10969, 65535, 11270, 65535,
+  12300, 422, 8934, 6258, 7506, 7686, 5991, 6731, 8116, 4606, 3240, 9482, 10360, 2362, 1422, 11300,
+  5202, 9990, 9719, 3003, 4448, 8274, 13305, 5518, 6799, 12024, 11184, 4008, 12485, 65535, 8072, 65535,
+  8676, 65535, 10720, 65535, 5603, 7119, 14767, 6874, 7526, 11721, 10715, 2007, 65535, 13356, 65535, 13588,
+  65535, 8983, 65535, 9646, 65535, 9360, 65535, 9066, 65535, 11494, 65535, 11816,
+  // A3
+  9661, 65535, 0, 65535, 1401, 65535, 2694, 65535, 3259, 65535, 4416, 65535, 5253, 65535, 5754, 65535,
+  6673, 65535, 7642, 65535, 8053, 65535, 8500, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  9973, 65535, 9820, 65535, 2925, 65535, 3576, 65535, 3635, 65535, 5682, 65535, 7908, 65535, 8209, 65535,
+  9239, 65535, 65535, 727, 1975, 65535, 65535, 3670, 5055, 65535, 65535, 6421, 7299, 65535, 65535, 8239,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 9424, 65535, 2541, 65535,
+  3145, 65535, 7659, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 10295, 65535, 10527,
+  65535, 3452, 65535, 4115, 65535, 3829, 65535, 6005, 65535, 8433, 65535, 8755,
+  // A4
+  13311, 589, 13900, 0, 7521, 8849, 8814, 7556, 9379, 6991, 8066, 5834, 8903, 4997, 9404, 4496,
+  10323, 3577, 11292, 2608, 11703, 2197, 12150, 1750, 6062, 10996, 3835, 10065, 4417, 9483, 5543, 14458,
+  6306, 13695, 6809, 13192, 7876, 12125, 4800, 11570, 5262, 11108, 5626, 8274, 6651, 7249, 6929, 15890,
+  8187, 14632, 15891, 8861, 12714, 7711, 8851, 11574, 3025, 10875, 11585, 2315, 6083, 10287, 11968, 4402,
+  13623, 65535, 13470, 65535, 9045, 65535, 9696, 65535, 9755, 65535, 9332, 65535, 11558, 65535, 11859, 65535,
+  12889, 1011, 9523, 6847, 8095, 8275, 6580, 7320, 8705, 5195, 3829, 10071, 10949, 2951, 2011, 11889,
+  5791, 10579, 10308, 3592, 5037, 8863, 13894, 6107, 7388, 12613, 11773, 4597, 13074, 65535, 8661, 65535,
+  9265, 65535, 11309, 65535, 6192, 7708, 15356, 7463, 8115, 12310, 11304, 2596, 65535, 13945, 65535, 14177,
+  65535, 9572, 65535, 10235, 65535, 9949, 65535, 9655, 65535, 12083, 65535, 12405,
+  // A5
+  8260, 65535, 8849, 65535, 0, 65535, 1293, 65535, 1858, 65535, 3015, 65535, 3852, 65535, 4353, 65535,
+  5272, 65535, 6241, 65535, 6652, 65535, 7099, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  8572, 65535, 8419, 65535, 1524, 65535, 2175, 65535, 2234, 65535, 4281, 65535, 6507, 65535, 6808, 65535,
+  7838, 65535, 65535, 9576, 574, 65535, 65535, 2269, 3654, 65535, 65535, 5020, 5898, 65535, 65535, 6838,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 8023, 65535, 1140, 65535,
+  1744, 65535, 6258, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 8894, 65535, 9126,
+  65535, 2051, 65535, 2714, 65535, 2428, 65535, 4604, 65535, 7032, 65535, 7354,
+  // A6
+  6932, 1990, 7521, 1401, 8922, 0, 10215, 8957, 10780, 8392, 9467, 7235, 10304, 6398, 10805, 5897,
+  3944, 4978, 4913, 4009, 5324, 3598, 5771, 3151, 7463, 8248, 5236, 7317, 5818, 6735, 6944, 5609,
+  7707, 4846, 8210, 4343, 9277, 3276, 6201, 2721, 6663, 2259, 7027, 8344, 8052, 8650, 8330, 7041,
+  9588, 5783, 7042, 10262, 8192, 9112, 10252, 8826, 4426, 8127, 8837, 3716, 7484, 1438, 3119, 5803,
+  7244, 65535, 7091, 65535, 10446, 65535, 11097, 65535, 11156, 65535, 10733, 65535, 5179, 65535, 5480, 65535,
+  6510, 2412, 674, 8248, 9496, 9676, 7981, 8721, 10106, 6596, 5230, 3692, 4570, 4352, 3412, 5510,
+  7192, 1730, 7560, 4993, 6438, 6115, 5045, 7508, 8789, 3764, 2924, 5998, 6695, 65535, 10062, 65535,
+  10666, 65535, 4930, 65535, 7593, 7778, 6507, 8864, 9516, 7788, 8556, 3997, 65535, 7566, 65535, 7798,
+  65535, 10973, 65535, 11636, 65535, 11350, 65535, 11056, 65535, 5704, 65535, 6026,
+  // A7
+  6967, 65535, 7556, 65535, 8957, 65535, 0, 65535, 565, 65535, 1722, 65535, 2559, 65535, 3060, 65535,
+  3979, 65535, 4948, 65535, 5359, 65535, 5806, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  7279, 65535, 7126, 65535, 10481, 65535, 11132, 65535, 11191, 65535, 2988, 65535, 5214, 65535, 5515, 65535,
+  6545, 65535, 65535, 8283, 9531, 65535, 65535, 976, 2361, 65535, 65535, 3727, 4605, 65535, 65535, 5545,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 6730, 65535, 10097, 65535,
+  10701, 65535, 4965, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 7601, 65535, 7833,
+  65535, 11008, 65535, 11671, 65535, 11385, 65535, 3311, 65535, 5739, 65535, 6061,
+  // A8
+  8225, 3283, 8814, 2694, 10215, 1293, 11508, 0, 12073, 9685, 10760, 8528, 11597, 7691, 12098, 7190,
+  5237, 6271, 6206, 5302, 6617, 4891, 7064, 4444, 8756, 9541, 6529, 8610, 7111, 8028, 8237, 6902,
+  9000, 6139, 9503, 5636, 10570, 4569, 7494, 4014, 7956, 3552, 8320, 9637, 9345, 9943, 9623, 8334,
+  10881, 7076, 8335, 11555, 9485, 10405, 11545, 10119, 5719, 9420, 10130, 5009, 8777, 2731, 4412, 7096,
+  8537, 65535, 8384, 65535, 11739, 65535, 12390, 65535, 12449, 65535, 12026, 65535, 6472, 65535, 6773, 65535,
+  7803, 3705, 1967, 9541, 10789, 719, 9274, 10014, 11399, 7889, 6523, 4985, 5863, 5645, 4705, 6803,
+  8485, 3023, 8853, 6286, 7731, 7408, 6338, 8801, 10082, 5057, 4217, 7291, 7988, 65535, 11355, 65535,
+  11959, 65535, 6223, 65535, 8886, 9071, 7800, 10157, 10809, 9081, 9849, 5290, 65535, 8859, 65535, 9091,
+  65535, 12266, 65535, 12929, 65535, 12643, 65535, 12349, 65535, 6997, 65535, 7319,
+  // A9
+  6402, 65535, 6991, 65535, 8392, 65535, 9685, 65535, 0, 65535, 1157, 65535, 1994, 65535, 2495, 65535,
+  3414, 65535, 4383, 65535, 4794, 65535, 5241, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  6714, 65535, 6561, 65535, 9916, 65535, 10567, 65535, 10626, 65535, 2423, 65535, 4649, 65535, 4950, 65535,
+  5980, 65535, 65535, 7718, 8966, 65535, 65535, 411, 1796, 65535, 65535, 3162, 4040, 65535, 65535, 4980,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 6165, 65535, 9532, 65535,
+  10136, 65535, 4400, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 7036, 65535, 7268,
+  65535, 10443, 65535, 11106, 65535, 10820, 65535, 2746, 65535, 5174, 65535, 5496,
+  // A10
+  8790, 3848, 9379, 3259, 10780, 1858, 12073, 565, 12638, 0, 11325, 9093, 12162, 8256, 12663, 7755,
+  5802, 6836, 6771, 5867, 7182, 5456, 7629, 5009, 9321, 10106, 7094, 9175, 7676, 8593, 8802, 7467,
+  9565, 6704, 10068, 6201, 11135, 5134, 8059, 4579, 8521, 4117, 8885, 10202, 9910, 10508, 10188, 8899,
+  11446, 7641, 8900, 12120, 10050, 10970, 12110, 10684, 6284, 9985, 10695, 5574, 9342, 3296, 4977, 7661,
+  9102, 65535, 8949, 65535, 12304, 65535, 12955, 65535, 13014, 65535, 12591, 65535, 7037, 65535, 7338, 65535,
+  8368, 4270, 2532, 10106, 11354, 1284, 9839, 10579, 11964, 8454, 7088, 5550, 6428, 6210, 5270, 7368,
+  9050, 3588, 9418, 6851, 8296, 7973, 6903, 9366, 10647, 5622, 4782, 7856, 8553, 65535, 11920, 65535,
+  12524, 65535, 6788, 65535, 9451, 9636, 8365, 10722, 11374, 9646, 10414, 5855, 65535, 9424, 65535, 9656,
+  65535, 12831, 65535, 13494, 65535, 13208, 65535, 12914, 65535, 7562, 65535, 7884,
+  // A11
+  5245, 65535, 5834, 65535, 7235, 65535, 8528, 65535, 9093, 65535, 0, 65535, 837, 65535, 1338, 65535,
+  2257, 65535, 3226, 65535, 3637, 65535, 4084, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  5557, 65535, 5404, 65535, 8759, 65535, 9410, 65535, 9469, 65535, 1266, 65535, 3492, 65535, 3793, 65535,
+  4823, 65535, 65535, 6561, 7809, 65535, 65535, 9504, 639, 65535, 65535, 2005, 2883, 65535, 65535, 3823,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5008, 65535, 8375, 65535,
+  8979, 65535, 3243, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5879, 65535, 6111,
+  65535, 9286, 65535, 9949, 65535, 9663, 65535, 1589, 65535, 4017, 65535, 4339,
+  // A12
+  7477, 5005, 8066, 4416, 9467, 3015, 10760, 1722, 11325, 1157, 12482, 0, 13319, 9413, 13820, 8912,
+  6959, 7993, 7928, 7024, 8339, 6613, 6316, 6166, 10478, 5162, 8251, 4231, 8833, 3649, 9959, 8624,
+  10722, 7861, 11225, 7358, 12292, 6291, 9216, 5736, 9678, 5274, 10042, 2440, 11067, 1415, 11345, 10056,
+  12603, 8798, 10057, 13277, 6880, 12127, 13267, 5740, 7441, 5041, 5751, 6731, 10499, 4453, 6134, 8818,
+  7789, 65535, 7636, 65535, 10991, 65535, 11642, 65535, 11701, 65535, 13748, 65535, 8194, 65535, 8495, 65535,
+  7055, 5427, 3689, 8793, 10041, 2441, 746, 11736, 13121, 9611, 8245, 6707, 7585, 7367, 6427, 6055,
+  10207, 4745, 4474, 8008, 9453, 3029, 8060, 10523, 11804, 6779, 5939, 9013, 7240, 65535, 10607, 65535,
+  11211, 65535, 7945, 65535, 10608, 1874, 9522, 11879, 12531, 6476, 5470, 7012, 65535, 8111, 65535, 8343,
+  65535, 11518, 65535, 12181, 65535, 11895, 65535, 14071, 65535, 8719, 65535, 9041,
+  // A13
+  4408, 65535, 4997, 65535, 6398, 65535, 7691, 65535, 8256, 65535, 9413, 65535, 0, 65535, 501, 65535,
+  1420, 65535, 2389, 65535, 2800, 65535, 3247, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  4720, 65535, 4567, 65535, 7922, 65535, 8573, 65535, 8632, 65535, 10679, 65535, 2655, 65535, 2956, 65535,
+  3986, 65535, 65535, 5724, 6972, 65535, 65535, 8667, 10052, 65535, 65535, 1168, 2046, 65535, 65535, 2986,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4171, 65535, 7538, 65535,
+  8142, 65535, 2406, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5042, 65535, 5274,
+  65535, 8449, 65535, 9112, 65535, 8826, 65535, 11002, 65535, 3180, 65535, 3502,
+  // A14
+  8314, 5842, 8903, 5253, 10304, 3852, 11597, 2559, 12162, 1994, 13319, 837, 14156, 0, 14657, 9749,
+  7796, 8830, 8765, 7861, 9176, 7450, 7153, 7003, 11315, 5999, 9088, 5068, 9670, 4486, 10796, 9461,
+  11559, 8698, 12062, 8195, 13129, 7128, 10053, 6573, 10515, 6111, 10879, 3277, 11904, 2252, 12182, 10893,
+  13440, 9635, 10894, 14114, 7717, 12964, 14104, 6577, 8278, 5878, 6588, 7568, 11336, 5290, 6971, 9655,
+  8626, 65535, 8473, 65535, 11828, 65535, 12479, 65535, 12538, 65535, 14585, 65535, 9031, 65535, 9332, 65535,
+  7892, 6264, 4526, 9630, 10878, 3278, 1583, 12573, 13958, 198, 9082, 7544, 8422, 8204, 7264, 6892,
+  11044, 5582, 5311, 8845, 10290, 3866, 8897, 11360, 12641, 7616, 6776, 9850, 8077, 65535, 11444, 65535,
+  12048, 65535, 8782, 65535, 11445, 2711, 10359, 12716, 13368, 7313, 6307, 7849, 65535, 8948, 65535, 9180,
+  65535, 12355, 65535, 13018, 65535, 12732, 65535, 14908, 65535, 9556, 65535, 9878,
+  // A15
+  3907, 65535, 4496, 65535, 5897, 65535, 7190, 65535, 7755, 65535, 8912, 65535, 9749, 65535, 0, 65535,
+  919, 65535, 1888, 65535, 2299, 65535, 2746, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  4219, 65535, 4066, 65535, 7421, 65535, 8072, 65535, 8131, 65535, 10178, 65535, 2154, 65535, 2455, 65535,
+  3485, 65535, 65535, 5223, 6471, 65535, 65535, 8166, 9551, 65535, 65535, 667, 1545, 65535, 65535, 2485,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3670, 65535, 7037, 65535,
+  7641, 65535, 1905, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4541, 65535, 4773,
+  65535, 7948, 65535, 8611, 65535, 8325, 65535, 10501, 65535, 2679, 65535, 3001,
+  // A16
+  8815, 6343, 9404, 5754, 10805, 4353, 12098, 3060, 12663, 2495, 13820, 1338, 14657, 501, 15158, 0,
+  8297, 9331, 9266, 8362, 9677, 7951, 7654, 7504, 11816, 6500, 9589, 5569, 10171, 4987, 11297, 9962,
+  12060, 9199, 12563, 8696, 13630, 7629, 10554, 7074, 11016, 6612, 11380, 3778, 12405, 2753, 12683, 11394,
+  13941, 10136, 11395, 14615, 8218, 13465, 14605, 7078, 8779, 6379, 7089, 8069, 11837, 5791, 7472, 10156,
+  9127, 65535, 8974, 65535, 12329, 65535, 12980, 65535, 13039, 65535, 15086, 65535, 9532, 65535, 9833, 65535,
+  8393, 6765, 5027, 10131, 11379, 3779, 2084, 13074, 14459, 699, 9583, 8045, 8923, 8705, 7765, 7393,
+  11545, 6083, 5812, 9346, 10791, 4367, 9398, 11861, 13142, 8117, 7277, 10351, 8578, 65535, 11945, 65535,
+  12549, 65535, 9283, 65535, 11946, 3212, 10860, 13217, 13869, 7814, 6808, 8350, 65535, 9449, 65535, 9681,
+  65535, 12856, 65535, 13519, 65535, 13233, 65535, 15409, 65535, 10057, 65535, 10379,
+  // B1
+  2988, 65535, 3577, 65535, 4978, 65535, 6271, 65535, 6836, 65535, 7993, 65535, 8830, 65535, 9331, 65535,
+  0, 65535, 969, 65535, 1380, 65535, 1827, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  3300, 65535, 3147, 65535, 6502, 65535, 7153, 65535, 7212, 65535, 9259, 65535, 1235, 65535, 1536, 65535,
+  2566, 65535, 65535, 4304, 5552, 65535, 65535, 7247, 8632, 65535, 65535, 9998, 626, 65535, 65535, 1566,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2751, 65535, 6118, 65535,
+  6722, 65535, 986, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3622, 65535, 3854,
+  65535, 7029, 65535, 7692, 65535, 7406, 65535, 9582, 65535, 1760, 65535, 2082,
+  // B2
+  9734, 7262, 10323, 6673, 3944, 5272, 5237, 3979, 5802, 3414, 6959, 2257, 7796, 1420, 8297, 919,
+  9216, 0, 10185, 9281, 10596, 8870, 8573, 8423, 2485, 7419, 3416, 6488, 3998, 5906, 5124, 10881,
+  5887, 10118, 6390, 9615, 7457, 8548, 1223, 7993, 1685, 7531, 5207, 4697, 6232, 3672, 6510, 12313,
+  7768, 11055, 12314, 8442, 9137, 7292, 8432, 7997, 9131, 7298, 8008, 8988, 2506, 6710, 8391, 825,
+  10046, 65535, 9893, 65535, 5468, 65535, 6119, 65535, 6178, 65535, 8225, 65535, 10451, 65535, 10752, 65535,
+  9312, 7684, 5946, 3270, 4518, 4698, 3003, 6213, 7598, 1618, 252, 8964, 9842, 9624, 8684, 8312,
+  2214, 7002, 6731, 3173, 4618, 5286, 10317, 5688, 6969, 9036, 8196, 1020, 9497, 65535, 5084, 65535,
+  5688, 65535, 10202, 65535, 5773, 4131, 11779, 7044, 7696, 8733, 7727, 8702, 65535, 10368, 65535, 10600,
+  65535, 5995, 65535, 6658, 65535, 6372, 65535, 8548, 65535, 10976, 65535, 11298,
+  // B3
+  2019, 65535, 2608, 65535, 4009, 65535, 5302, 65535, 5867, 65535, 7024, 65535, 7861, 65535, 8362, 65535,
+  9281, 65535, 0, 65535, 411, 65535, 858, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  2331, 65535, 2178, 65535, 5533, 65535, 6184, 65535, 6243, 65535, 8290, 65535, 10516, 65535, 10817, 65535,
+  1597, 65535, 65535, 3335, 4583, 65535, 65535, 6278, 7663, 65535, 65535, 9029, 9907, 65535, 65535, 597,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1782, 65535, 5149, 65535,
+  5753, 65535, 10267, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2653, 65535, 2885,
+  65535, 6060, 65535, 6723, 65535, 6437, 65535, 8613, 65535, 11041, 65535, 11363,
+  // B4
+  10703, 8231, 11292, 7642, 4913, 6241, 6206, 4948, 6771, 4383, 7928, 3226, 8765, 2389, 9266, 1888,
+  10185, 969, 11154, 0, 11565, 9839, 9542, 9392, 3454, 8388, 4385, 7457, 4967, 6875, 6093, 11850,
+  6856, 11087, 7359, 10584, 8426, 9517, 2192, 8962, 2654, 8500, 6176, 5666, 7201, 4641, 7479, 13282,
+  8737, 12024, 13283, 9411, 10106, 8261, 9401, 8966, 10100, 8267, 8977, 9957, 3475, 7679, 9360, 1794,
+  11015, 65535, 10862, 65535, 6437, 65535, 7088, 65535, 7147, 65535, 9194, 65535, 11420, 65535, 11721, 65535,
+  10281, 8653, 6915, 4239, 5487, 5667, 3972, 7182, 8567, 2587, 1221, 9933, 10811, 343, 9653, 9281,
+  3183, 7971, 7700, 4142, 5587, 6255, 11286, 6657, 7938, 10005, 9165, 1989, 10466, 65535, 6053, 65535,
+  6657, 65535, 11171, 65535, 6742, 5100, 12748, 8013, 8665, 9702, 8696, 9671, 65535, 11337, 65535, 11569,
+  65535, 6964, 65535, 7627, 65535, 7341, 65535, 9517, 65535, 11945, 65535, 12267,
+  // B5
+  1608, 65535, 2197, 65535, 3598, 65535, 4891, 65535, 5456, 65535, 6613, 65535, 7450, 65535, 7951, 65535,
+  8870, 65535, 9839, 65535, 0, 65535, 447, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  1920, 65535, 1767, 65535, 5122, 65535, 5773, 65535, 5832, 65535, 7879, 65535, 10105, 65535, 10406, 65535,
+  1186, 65535, 65535, 2924, 4172, 65535, 65535, 5867, 7252, 65535, 65535, 8618, 9496, 65535, 65535, 186,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1371, 65535, 4738, 65535,
+  5342, 65535, 9856, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2242, 65535, 2474,
+  65535, 5649, 65535, 6312, 65535, 6026, 65535, 8202, 65535, 10630, 65535, 10952,
+  // B6
+  11114, 8642, 11703, 8053, 5324, 6652, 6617, 5359, 7182, 4794, 8339, 3637, 9176, 2800, 9677, 2299,
+  10596, 1380, 11565, 411, 11976, 0, 9953, 9803, 3865, 8799, 4796, 7868, 5378, 7286, 6504, 12261,
+  7267, 11498, 7770, 10995, 8837, 9928, 2603, 9373, 3065, 8911, 6587, 6077, 7612, 5052, 7890, 13693,
+  9148, 12435, 13694, 9822, 10517, 8672, 9812, 9377, 10511, 8678, 9388, 10368, 3886, 8090, 9771, 2205,
+  11426, 65535, 11273, 65535, 6848, 65535, 7499, 65535, 7558, 65535, 9605, 65535, 11831, 65535, 12132, 65535,
+  10692, 9064, 7326, 4650, 5898, 6078, 4383, 7593, 8978, 2998, 1632, 10344, 11222, 754, 10064, 9692,
+  3594, 8382, 8111, 4553, 5998, 6666, 11697, 7068, 8349, 10416, 9576, 2400, 10877, 65535, 6464, 65535,
+  7068, 65535, 11582, 65535, 7153, 5511, 13159, 8424, 9076, 10113, 9107, 10082, 65535, 11748, 65535, 11980,
+  65535, 7375, 65535, 8038, 65535, 7752, 65535, 9928, 65535, 12356, 65535, 12678,
+  // B7
+  1161, 65535, 1750, 65535, 3151, 65535, 4444, 65535, 5009, 65535, 6166, 65535, 7003, 65535, 7504, 65535,
+  8423, 65535, 9392, 65535, 9803, 65535, 0, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  1473, 65535, 1320, 65535, 4675, 65535, 5326, 65535, 5385, 65535, 7432, 65535, 9658, 65535, 9959, 65535,
+  739, 65535, 65535, 2477, 3725, 65535, 65535, 5420, 6805, 65535, 65535, 8171, 9049, 65535, 65535, 9989,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 924, 65535, 4291, 65535,
+  4895, 65535, 9409, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1795, 65535, 2027,
+  65535, 5202, 65535, 5865, 65535, 5579, 65535, 7755, 65535, 10183, 65535, 10505,
+  // B8
+  11561, 9089, 12150, 8500, 5771, 7099, 7064, 5806, 7629, 5241, 6316, 4084, 7153, 3247, 7654, 2746,
+  8573, 1827, 9542, 858, 9953, 447, 10400, 0, 4312, 9246, 2085, 8315, 2667, 7733, 3793, 12708,
+  4556, 11945, 5059, 11442, 6126, 10375, 3050, 9820, 3512, 9358, 3876, 6524, 4901, 5499, 5179, 14140,
+  6437, 12882, 14141, 7111, 10964, 5961, 7101, 9824, 1275, 9125, 9835, 565, 4333, 8537, 10218, 2652,
+  11873, 65535, 11720, 65535, 7295, 65535, 7946, 65535, 8005, 65535, 7582, 65535, 9808, 65535, 10109, 65535,
+  11139, 9511, 7773, 5097, 6345, 6525, 4830, 5570, 6955, 3445, 2079, 8321, 9199, 1201, 261, 10139,
+  4041, 8829, 8558, 1842, 3287, 7113, 12144, 4357, 5638, 10863, 10023, 2847, 11324, 65535, 6911, 65535,
+  7515, 65535, 9559, 65535, 4442, 5958, 13606, 5713, 6365, 10560, 9554, 846, 65535, 12195, 65535, 12427,
+  65535, 7822, 65535, 8485, 65535, 8199, 65535, 7905, 65535, 10333, 65535, 10655,
+  // B9
+  10407, 65535, 10996, 65535, 8248, 65535, 9541, 65535, 10106, 65535, 5162, 65535, 5999, 65535, 6500, 65535,
+  7419, 65535, 8388, 65535, 8799, 65535, 9246, 65535, 0, 65535, 931, 65535, 1513, 65535, 2639, 65535,
+  3402, 65535, 3905, 65535, 4972, 65535, 5527, 65535, 5989, 65535, 2722, 65535, 3747, 65535, 4025, 65535,
+  5283, 65535, 65535, 5957, 65535, 4807, 5947, 65535, 6646, 65535, 65535, 65535, 6810, 65535, 65535, 65535,
+  10719, 65535, 10566, 65535, 9772, 65535, 10423, 65535, 10482, 65535, 6428, 65535, 8654, 65535, 8955, 65535,
+  9985, 65535, 65535, 7574, 8822, 65535, 65535, 4416, 5801, 65535, 65535, 7167, 8045, 65535, 65535, 8985,
+  6518, 65535, 65535, 688, 2133, 65535, 65535, 3203, 4484, 65535, 65535, 5324, 10170, 65535, 9388, 65535,
+  9992, 65535, 8405, 65535, 3288, 65535, 65535, 4559, 5211, 65535, 65535, 6217, 65535, 11041, 65535, 11273,
+  65535, 10299, 65535, 10962, 65535, 10676, 65535, 6751, 65535, 9179, 65535, 9501,
+  // B10
+  5473, 65535, 6062, 65535, 7463, 65535, 8756, 65535, 9321, 65535, 10478, 65535, 11315, 65535, 11816, 65535,
+  2485, 65535, 3454, 65535, 3865, 65535, 4312, 65535, 65535, 0, 65535, 5858, 65535, 5276, 65535, 4150,
+  65535, 3387, 65535, 2884, 65535, 1817, 65535, 1262, 65535, 800, 65535, 6885, 65535, 65535, 65535, 5582,
+  65535, 4324, 5583, 65535, 6733, 65535, 65535, 7367, 65535, 6668, 7378, 65535, 65535, 65535, 1660, 65535,
+  5785, 65535, 5632, 65535, 8987, 65535, 9638, 65535, 9697, 65535, 11744, 65535, 3720, 65535, 4021, 65535,
+  5051, 65535, 65535, 6789, 8037, 65535, 65535, 9732, 11117, 65535, 65535, 2233, 3111, 65535, 65535, 4051,
+  65535, 271, 6101, 65535, 65535, 4656, 3586, 65535, 65535, 2305, 1465, 65535, 5236, 65535, 8603, 65535,
+  9207, 65535, 3471, 65535, 65535, 6319, 5048, 65535, 65535, 6329, 7097, 65535, 65535, 6107, 65535, 6339,
+  65535, 9514, 65535, 10177, 65535, 9891, 65535, 12067, 65535, 4245, 65535, 4567,
+  // B11
+  9476, 65535, 10065, 65535, 7317, 65535, 8610, 65535, 9175, 65535, 4231, 65535, 5068, 65535, 5569, 65535,
+  6488, 65535, 7457, 65535, 7868, 65535, 8315, 65535, 5858, 65535, 0, 65535, 582, 65535, 1708, 65535,
+  2471, 65535, 2974, 65535, 4041, 65535, 4596, 65535, 5058, 65535, 1791, 65535, 2816, 65535, 3094, 65535,
+  4352, 65535, 65535, 5026, 65535, 3876, 5016, 65535, 5715, 65535, 65535, 65535, 5879, 65535, 65535, 65535,
+  9788, 65535, 9635, 65535, 8841, 65535, 9492, 65535, 9551, 65535, 5497, 65535, 7723, 65535, 8024, 65535,
+  9054, 65535, 65535, 6643, 7891, 65535, 65535, 3485, 4870, 65535, 65535, 6236, 7114, 65535, 65535, 8054,
+  5587, 65535, 65535, 6282, 1202, 65535, 65535, 2272, 3553, 65535, 65535, 4393, 9239, 65535, 8457, 65535,
+  9061, 65535, 7474, 65535, 2357, 65535, 65535, 3628, 4280, 65535, 65535, 5286, 65535, 10110, 65535, 10342,
+  65535, 9368, 65535, 10031, 65535, 9745, 65535, 5820, 65535, 8248, 65535, 8570,
+  // B12
+  3246, 65535, 3835, 65535, 5236, 65535, 6529, 65535, 7094, 65535, 8251, 65535, 9088, 65535, 9589, 65535,
+  3416, 65535, 4385, 65535, 4796, 65535, 2085, 65535, 65535, 931, 65535, 0, 65535, 5943, 65535, 4817,
+  65535, 4054, 65535, 3551, 65535, 2748, 65535, 2193, 65535, 1731, 65535, 7552, 65535, 65535, 65535, 6249,
+  65535, 4991, 6250, 65535, 2649, 65535, 65535, 1509, 65535, 810, 1520, 65535, 65535, 65535, 2591, 65535,
+  3558, 65535, 3405, 65535, 6760, 65535, 7411, 65535, 7470, 65535, 9517, 65535, 4651, 65535, 4952, 65535,
+  2824, 65535, 65535, 4562, 5810, 65535, 65535, 7505, 8890, 65535, 65535, 3164, 4042, 65535, 65535, 1824,
+  65535, 1202, 243, 65535, 65535, 5323, 4253, 65535, 65535, 2972, 2396, 65535, 3009, 65535, 6376, 65535,
+  6980, 65535, 4402, 65535, 65535, 6986, 5715, 65535, 65535, 2245, 1239, 65535, 65535, 3880, 65535, 4112,
+  65535, 7287, 65535, 7950, 65535, 7664, 65535, 9840, 65535, 5176, 65535, 5498,
+  // B13
+  8894, 65535, 9483, 65535, 6735, 65535, 8028, 65535, 8593, 65535, 3649, 65535, 4486, 65535, 4987, 65535,
+  5906, 65535, 6875, 65535, 7286, 65535, 7733, 65535, 5276, 65535, 5943, 65535, 0, 65535, 1126, 65535,
+  1889, 65535, 2392, 65535, 3459, 65535, 4014, 65535, 4476, 65535, 1209, 65535, 2234, 65535, 2512, 65535,
+  3770, 65535, 65535, 4444, 65535, 3294, 4434, 65535, 5133, 65535, 65535, 65535, 5297, 65535, 65535, 65535,
+  9206, 65535, 9053, 65535, 8259, 65535, 8910, 65535, 8969, 65535, 4915, 65535, 7141, 65535, 7442, 65535,
+  8472, 65535, 65535, 6061, 7309, 65535, 65535, 2903, 4288, 65535, 65535, 5654, 6532, 65535, 65535, 7472,
+  5005, 65535, 65535, 5700, 620, 65535, 65535, 1690, 2971, 65535, 65535, 3811, 8657, 65535, 7875, 65535,
+  8479, 65535, 6892, 65535, 1775, 65535, 65535, 3046, 3698, 65535, 65535, 4704, 65535, 9528, 65535, 9760,
+  65535, 8786, 65535, 9449, 65535, 9163, 65535, 5238, 65535, 7666, 65535, 7988,
+  // B14
+  3828, 65535, 4417, 65535, 5818, 65535, 7111, 65535, 7676, 65535, 8833, 65535, 9670, 65535, 10171, 65535,
+  3998, 65535, 4967, 65535, 5378, 65535, 2667, 65535, 65535, 1513, 65535, 582, 65535, 0, 65535, 5399,
+  65535, 4636, 65535, 4133, 65535, 3330, 65535, 2775, 65535, 2313, 65535, 8134, 65535, 65535, 65535, 6831,
+  65535, 5573, 6832, 65535, 3231, 65535, 65535, 2091, 65535, 1392, 2102, 65535, 65535, 65535, 3173, 65535,
+  4140, 65535, 3987, 65535, 7342, 65535, 7993, 65535, 8052, 65535, 10099, 65535, 5233, 65535, 5534, 65535,
+  3406, 65535, 65535, 5144, 6392, 65535, 65535, 8087, 9472, 65535, 65535, 3746, 4624, 65535, 65535, 2406,
+  65535, 1784, 825, 65535, 65535, 5905, 4835, 65535, 65535, 3554, 2978, 65535, 3591, 65535, 6958, 65535,
+  7562, 65535, 4984, 65535, 65535, 7568, 6297, 65535, 65535, 2827, 1821, 65535, 65535, 4462, 65535, 4694,
+  65535, 7869, 65535, 8532, 65535, 8246, 65535, 10422, 65535, 5758, 65535, 6080,
+  // B15
+  13869, 65535, 14458, 65535, 5609, 65535, 6902, 65535, 7467, 65535, 8624, 65535, 9461, 65535, 9962, 65535,
+  10881, 65535, 11850, 65535, 12261, 65535, 12708, 65535, 4150, 65535, 4817, 65535, 5399, 65535, 0, 65535,
+  763, 65535, 1266, 65535, 2333, 65535, 2888, 65535, 3350, 65535, 6608, 65535, 7633, 65535, 7911, 65535,
+  4577, 65535, 65535, 3318, 65535, 2168, 3308, 65535, 4007, 65535, 65535, 65535, 4171, 65535, 65535, 65535,
+  14181, 65535, 14028, 65535, 7133, 65535, 7784, 65535, 7843, 65535, 9890, 65535, 12116, 65535, 12417, 65535,
+  13447, 65535, 65535, 4935, 6183, 65535, 65535, 7878, 9263, 65535, 65535, 10629, 11507, 65535, 65535, 12447,
+  3879, 65535, 65535, 4574, 6019, 65535, 65535, 564, 1845, 65535, 65535, 2685, 13632, 65535, 6749, 65535,
+  7353, 65535, 11867, 65535, 7174, 65535, 65535, 3853, 2572, 65535, 65535, 3578, 65535, 14503, 65535, 14735,
+  65535, 7660, 65535, 8323, 65535, 8037, 65535, 10213, 65535, 12641, 65535, 12963,
+  // B16
+  4954, 65535, 5543, 65535, 6944, 65535, 8237, 65535, 8802, 65535, 9959, 65535, 10796, 65535, 11297, 65535,
+  5124, 65535, 6093, 65535, 6504, 65535, 3793, 65535, 65535, 2639, 65535, 1708, 65535, 1126, 65535, 0,
+  65535, 5762, 65535, 5259, 65535, 4456, 65535, 3901, 65535, 3439, 65535, 9260, 65535, 65535, 65535, 7957,
+  65535, 6699, 7958, 65535, 4357, 65535, 65535, 3217, 65535, 2518, 3228, 65535, 65535, 65535, 4299, 65535,
+  5266, 65535, 5113, 65535, 8468, 65535, 9119, 65535, 9178, 65535, 11225, 65535, 6359, 65535, 6660, 65535,
+  4532, 65535, 65535, 6270, 7518, 65535, 65535, 9213, 10598, 65535, 65535, 4872, 5750, 65535, 65535, 3532,
+  65535, 2910, 1951, 65535, 65535, 506, 5961, 65535, 65535, 4680, 4104, 65535, 4717, 65535, 8084, 65535,
+  8688, 65535, 6110, 65535, 65535, 8694, 7423, 65535, 65535, 3953, 2947, 65535, 65535, 5588, 65535, 5820,
+  65535, 8995, 65535, 9658, 65535, 9372, 65535, 11548, 65535, 6884, 65535, 7206,
+  // C1
+  13106, 65535, 13695, 65535, 4846, 65535, 6139, 65535, 6704, 65535, 7861, 65535, 8698, 65535, 9199, 65535,
+  10118, 65535, 11087, 65535, 11498, 65535, 11945, 65535, 3387, 65535, 4054, 65535, 4636, 65535, 5762, 65535,
+  0, 65535, 503, 65535, 1570, 65535, 2125, 65535, 2587, 65535, 5845, 65535, 6870, 65535, 7148, 65535,
+  3814, 65535, 65535, 2555, 65535, 1405, 2545, 65535, 3244, 65535, 65535, 65535, 3408, 65535, 65535, 65535,
+  13418, 65535, 13265, 65535, 6370, 65535, 7021, 65535, 7080, 65535, 9127, 65535, 11353, 65535, 11654, 65535,
+  12684, 65535, 65535, 4172, 5420, 65535, 65535, 7115, 8500, 65535, 65535, 9866, 10744, 65535, 65535, 11684,
+  3116, 65535, 65535, 3811, 5256, 65535, 65535, 4552, 1082, 65535, 65535, 1922, 12869, 65535, 5986, 65535,
+  6590, 65535, 11104, 65535, 6411, 65535, 65535, 3090, 1809, 65535, 65535, 2815, 65535, 13740, 65535, 13972,
+  65535, 6897, 65535, 7560, 65535, 7274, 65535, 9450, 65535, 11878, 65535, 12200,
+  // C2
+  5717, 65535, 6306, 65535, 7707, 65535, 9000, 65535, 9565, 65535, 10722, 65535, 11559, 65535, 12060, 65535,
+  5887, 65535, 6856, 65535, 7267, 65535, 4556, 65535, 65535, 3402, 65535, 2471, 65535, 1889, 65535, 763,
+  65535, 0, 65535, 4248, 65535, 5219, 65535, 4664, 65535, 4202, 65535, 3498, 65535, 65535, 65535, 2195,
+  65535, 937, 2196, 65535, 3346, 65535, 65535, 3980, 65535, 3281, 3991, 65535, 65535, 65535, 5062, 65535,
+  6029, 65535, 5876, 65535, 9231, 65535, 9882, 65535, 9941, 65535, 11988, 65535, 7122, 65535, 7423, 65535,
+  5295, 65535, 65535, 7033, 8281, 65535, 65535, 9976, 11361, 65535, 65535, 5635, 6513, 65535, 65535, 4295,
+  65535, 3673, 2714, 65535, 65535, 1269, 199, 65535, 65535, 3669, 4867, 65535, 5480, 65535, 8847, 65535,
+  9451, 65535, 6873, 65535, 65535, 2932, 1661, 65535, 65535, 2942, 3710, 65535, 65535, 6351, 65535, 6583,
+  65535, 9758, 65535, 10421, 65535, 10135, 65535, 12311, 65535, 7647, 65535, 7969,
+  // C3
+  12603, 65535, 13192, 65535, 4343, 65535, 5636, 65535, 6201, 65535, 7358, 65535, 8195, 65535, 8696, 65535,
+  9615, 65535, 10584, 65535, 10995, 65535, 11442, 65535, 2884, 65535, 3551, 65535, 4133, 65535, 5259, 65535,
+  4248, 65535, 0, 65535, 1067, 65535, 1622, 65535, 2084, 65535, 5342, 65535, 6367, 65535, 6645, 65535,
+  3311, 65535, 65535, 2052, 65535, 902, 2042, 65535, 2741, 65535, 65535, 65535, 2905, 65535, 65535, 65535,
+  12915, 65535, 12762, 65535, 5867, 65535, 6518, 65535, 6577, 65535, 8624, 65535, 10850, 65535, 11151, 65535,
+  12181, 65535, 65535, 3669, 4917, 65535, 65535, 6612, 7997, 65535, 65535, 9363, 10241, 65535, 65535, 11181,
+  2613, 65535, 65535, 3308, 4753, 65535, 65535, 4049, 579, 65535, 65535, 1419, 12366, 65535, 5483, 65535,
+  6087, 65535, 10601, 65535, 5908, 65535, 65535, 2587, 1306, 65535, 65535, 2312, 65535, 13237, 65535, 13469,
+  65535, 6394, 65535, 7057, 65535, 6771, 65535, 8947, 65535, 11375, 65535, 11697,
+  // C4
+  6220, 65535, 6809, 65535, 8210, 65535, 9503, 65535, 10068, 65535, 11225, 65535, 12062, 65535, 12563, 65535,
+  6390, 65535, 7359, 65535, 7770, 65535, 5059, 65535, 65535, 3905, 65535, 2974, 65535, 2392, 65535, 1266,
+  65535, 503, 65535, 0, 65535, 5722, 65535, 5167, 65535, 4705, 65535, 4001, 65535, 65535, 65535, 2698,
+  65535, 1440, 2699, 65535, 3849, 65535, 65535, 4483, 65535, 3784, 4494, 65535, 65535, 65535, 5565, 65535,
+  6532, 65535, 6379, 65535, 9734, 65535, 10385, 65535, 10444, 65535, 12491, 65535, 7625, 65535, 7926, 65535,
+  5798, 65535, 65535, 7536, 8784, 65535, 65535, 10479, 11864, 65535, 65535, 6138, 7016, 65535, 65535, 4798,
+  65535, 4176, 3217, 65535, 65535, 1772, 702, 65535, 65535, 4172, 5370, 65535, 5983, 65535, 9350, 65535,
+  9954, 65535, 7376, 65535, 65535, 3435, 2164, 65535, 65535, 3445, 4213, 65535, 65535, 6854, 65535, 7086,
+  65535, 10261, 65535, 10924, 65535, 10638, 65535, 12814, 65535, 8150, 65535, 8472,
+  // C5
+  11536, 65535, 12125, 65535, 3276, 65535, 4569, 65535, 5134, 65535, 6291, 65535, 7128, 65535, 7629, 65535,
+  8548, 65535, 9517, 65535, 9928, 65535, 10375, 65535, 1817, 65535, 2748, 65535, 3330, 65535, 4456, 65535,
+  5219, 65535, 5722, 65535, 0, 65535, 555, 65535, 1017, 65535, 4539, 65535, 5564, 65535, 5842, 65535,
+  7100, 65535, 65535, 7774, 65535, 6624, 7764, 65535, 8463, 65535, 65535, 65535, 1838, 65535, 65535, 65535,
+  11848, 65535, 11695, 65535, 4800, 65535, 5451, 65535, 5510, 65535, 7557, 65535, 9783, 65535, 10084, 65535,
+  11114, 65535, 65535, 2602, 3850, 65535, 65535, 5545, 6930, 65535, 65535, 8296, 9174, 65535, 65535, 10114,
+  1546, 65535, 65535, 2505, 3950, 65535, 65535, 5020, 6301, 65535, 65535, 352, 11299, 65535, 4416, 65535,
+  5020, 65535, 9534, 65535, 5105, 65535, 65535, 6376, 7028, 65535, 65535, 8034, 65535, 12170, 65535, 12402,
+  65535, 5327, 65535, 5990, 65535, 5704, 65535, 7880, 65535, 10308, 65535, 10630,
+  // C6
+  7287, 65535, 7876, 65535, 9277, 65535, 10570, 65535, 11135, 65535, 12292, 65535, 13129, 65535, 13630, 65535,
+  7457, 65535, 8426, 65535, 8837, 65535, 6126, 65535, 65535, 4972, 65535, 4041, 65535, 3459, 65535, 2333,
+  65535, 1570, 65535, 1067, 65535, 0, 65535, 6234, 65535, 5772, 65535, 5068, 65535, 65535, 65535, 3765,
+  65535, 2507, 3766, 65535, 4916, 65535, 65535, 5550, 65535, 4851, 5561, 65535, 65535, 65535, 6632, 65535,
+  7599, 65535, 7446, 65535, 10801, 65535, 11452, 65535, 11511, 65535, 13558, 65535, 8692, 65535, 8993, 65535,
+  6865, 65535, 65535, 8603, 9851, 65535, 65535, 11546, 12931, 65535, 65535, 7205, 8083, 65535, 65535, 5865,
+  65535, 5243, 4284, 65535, 65535, 2839, 1769, 65535, 65535, 488, 6437, 65535, 7050, 65535, 10417, 65535,
+  11021, 65535, 8443, 65535, 65535, 4502, 3231, 65535, 65535, 4512, 5280, 65535, 65535, 7921, 65535, 8153,
+  65535, 11328, 65535, 11991, 65535, 11705, 65535, 13881, 65535, 9217, 65535, 9539,
+  // C7
+  10981, 65535, 11570, 65535, 2721, 65535, 4014, 65535, 4579, 65535, 5736, 65535, 6573, 65535, 7074, 65535,
+  7993, 65535, 8962, 65535, 9373, 65535, 9820, 65535, 1262, 65535, 2193, 65535, 2775, 65535, 3901, 65535,
+  4664, 65535, 5167, 65535, 6234, 65535, 0, 65535, 462, 65535, 3984, 65535, 5009, 65535, 5287, 65535,
+  6545, 65535, 65535, 7219, 65535, 6069, 7209, 65535, 7908, 65535, 65535, 65535, 1283, 65535, 65535, 65535,
+  11293, 65535, 11140, 65535, 4245, 65535, 4896, 65535, 4955, 65535, 7002, 65535, 9228, 65535, 9529, 65535,
+  10559, 65535, 65535, 2047, 3295, 65535, 65535, 4990, 6375, 65535, 65535, 7741, 8619, 65535, 65535, 9559,
+  991, 65535, 65535, 1950, 3395, 65535, 65535, 4465, 5746, 65535, 65535, 6586, 10744, 65535, 3861, 65535,
+  4465, 65535, 8979, 65535, 4550, 65535, 65535, 5821, 6473, 65535, 65535, 7479, 65535, 11615, 65535, 11847,
+  65535, 4772, 65535, 5435, 65535, 5149, 65535, 7325, 65535, 9753, 65535, 10075,
+  // C8
+  4211, 65535, 4800, 65535, 6201, 65535, 7494, 65535, 8059, 65535, 9216, 65535, 10053, 65535, 10554, 65535,
+  1223, 65535, 2192, 65535, 2603, 65535, 3050, 65535, 65535, 5527, 65535, 4596, 65535, 4014, 65535, 2888,
+  65535, 2125, 65535, 1622, 65535, 555, 65535, 0, 65535, 6327, 65535, 5623, 65535, 65535, 65535, 4320,
+  65535, 3062, 4321, 65535, 5471, 65535, 65535, 6105, 65535, 5406, 6116, 65535, 65535, 65535, 398, 65535,
+  4523, 65535, 4370, 65535, 7725, 65535, 8376, 65535, 8435, 65535, 10482, 65535, 2458, 65535, 2759, 65535,
+  3789, 65535, 65535, 5527, 6775, 65535, 65535, 8470, 9855, 65535, 65535, 971, 1849, 65535, 65535, 2789,
+  65535, 5798, 4839, 65535, 65535, 3394, 2324, 65535, 65535, 1043, 203, 65535, 3974, 65535, 7341, 65535,
+  7945, 65535, 2209, 65535, 65535, 5057, 3786, 65535, 65535, 5067, 5835, 65535, 65535, 4845, 65535, 5077,
+  65535, 8252, 65535, 8915, 65535, 8629, 65535, 10805, 65535, 2983, 65535, 3305,
+  // C9
+  10519, 65535, 11108, 65535, 2259, 65535, 3552, 65535, 4117, 65535, 5274, 65535, 6111, 65535, 6612, 65535,
+  7531, 65535, 8500, 65535, 8911, 65535, 9358, 65535, 800, 65535, 1731, 65535, 2313, 65535, 3439, 65535,
+  4202, 65535, 4705, 65535, 5772, 65535, 6327, 65535, 0, 65535, 3522, 65535, 4547, 65535, 4825, 65535,
+  6083, 65535, 65535, 6757, 65535, 5607, 6747, 65535, 7446, 65535, 65535, 65535, 821, 65535, 65535, 65535,
+  10831, 65535, 10678, 65535, 3783, 65535, 4434, 65535, 4493, 65535, 6540, 65535, 8766, 65535, 9067, 65535,
+  10097, 65535, 65535, 1585, 2833, 65535, 65535, 4528, 5913, 65535, 65535, 7279, 8157, 65535, 65535, 9097,
+  529, 65535, 65535, 1488, 2933, 65535, 65535, 4003, 5284, 65535, 65535, 6124, 10282, 65535, 3399, 65535,
+  4003, 65535, 8517, 65535, 4088, 65535, 65535, 5359, 6011, 65535, 65535, 7017, 65535, 11153, 65535, 11385,
+  65535, 4310, 65535, 4973, 65535, 4687, 65535, 6863, 65535, 9291, 65535, 9613,
+  // C10
+  4673, 65535, 5262, 65535, 6663, 65535, 7956, 65535, 8521, 65535, 9678, 65535, 10515, 65535, 11016, 65535,
+  1685, 65535, 2654, 65535, 3065, 65535, 3512, 65535, 65535, 5989, 65535, 5058, 65535, 4476, 65535, 3350,
+  65535, 2587, 65535, 2084, 65535, 1017, 65535, 462, 65535, 0, 65535, 6085, 65535, 65535, 65535, 4782,
+  65535, 3524, 4783, 65535, 5933, 65535, 65535, 6567, 65535, 5868, 6578, 65535, 65535, 65535, 860, 65535,
+  4985, 65535, 4832, 65535, 8187, 65535, 8838, 65535, 8897, 65535, 10944, 65535, 2920, 65535, 3221, 65535,
+  4251, 65535, 65535, 5989, 7237, 65535, 65535, 8932, 10317, 65535, 65535, 1433, 2311, 65535, 65535, 3251,
+  65535, 6260, 5301, 65535, 65535, 3856, 2786, 65535, 65535, 1505, 665, 65535, 4436, 65535, 7803, 65535,
+  8407, 65535, 2671, 65535, 65535, 5519, 4248, 65535, 65535, 5529, 6297, 65535, 65535, 5307, 65535, 5539,
+  65535, 8714, 65535, 9377, 65535, 9091, 65535, 11267, 65535, 3445, 65535, 3767,
+  // C11
+  7685, 65535, 8274, 65535, 8344, 65535, 9637, 65535, 10202, 65535, 2440, 65535, 3277, 65535, 3778, 65535,
+  4697, 65535, 5666, 65535, 6077, 65535, 6524, 65535, 6885, 65535, 7552, 65535, 8134, 65535, 9260, 65535,
+  3498, 65535, 4001, 65535, 5068, 65535, 5623, 65535, 6085, 65535, 0, 65535, 1025, 65535, 1303, 65535,
+  2561, 65535, 65535, 6053, 65535, 4903, 6043, 65535, 6742, 65535, 65535, 65535, 6906, 65535, 65535, 65535,
+  7997, 65535, 7844, 65535, 9868, 65535, 10519, 65535, 10578, 65535, 3706, 65535, 5932, 65535, 6233, 65535,
+  7263, 65535, 65535, 7670, 8918, 65535, 65535, 1694, 3079, 65535, 65535, 4445, 5323, 65535, 65535, 6263,
+  6614, 65535, 65535, 7309, 8754, 65535, 65535, 3299, 4580, 65535, 65535, 5420, 7448, 65535, 9484, 65535,
+  10088, 65535, 5683, 65535, 566, 65535, 65535, 1837, 5307, 65535, 65535, 6313, 65535, 8319, 65535, 8551,
+  65535, 10395, 65535, 11058, 65535, 10772, 65535, 4029, 65535, 6457, 65535, 6779,
+  // C12
+  5037, 65535, 5626, 65535, 7027, 65535, 8320, 65535, 8885, 65535, 10042, 65535, 10879, 65535, 11380, 65535,
+  5207, 65535, 6176, 65535, 6587, 65535, 3876, 65535, 65535, 2722, 65535, 1791, 65535, 1209, 65535, 6608,
+  65535, 5845, 65535, 5342, 65535, 4539, 65535, 3984, 65535, 3522, 65535, 0, 65535, 65535, 65535, 8040,
+  65535, 6782, 8041, 65535, 4440, 65535, 65535, 3300, 65535, 2601, 3311, 65535, 65535, 65535, 4382, 65535,
+  5349, 65535, 5196, 65535, 8551, 65535, 9202, 65535, 9261, 65535, 11308, 65535, 6442, 65535, 6743, 65535,
+  4615, 65535, 65535, 6353, 7601, 65535, 65535, 9296, 10681, 65535, 65535, 4955, 5833, 65535, 65535, 3615,
+  65535, 2993, 2034, 65535, 65535, 589, 6044, 65535, 65535, 4763, 4187, 65535, 4800, 65535, 8167, 65535,
+  8771, 65535, 6193, 65535, 65535, 8777, 7506, 65535, 65535, 4036, 3030, 65535, 65535, 5671, 65535, 5903,
+  65535, 9078, 65535, 9741, 65535, 9455, 65535, 11631, 65535, 6967, 65535, 7289,
+  // C13
+  6660, 65535, 7249, 65535, 8650, 65535, 9943, 65535, 10508, 65535, 1415, 65535, 2252, 65535, 2753, 65535,
+  3672, 65535, 4641, 65535, 5052, 65535, 5499, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  6972, 65535, 6819, 65535, 10174, 65535, 10825, 65535, 10884, 65535, 2681, 65535, 4907, 65535, 5208, 65535,
+  6238, 65535, 65535, 7976, 9224, 65535, 65535, 669, 2054, 65535, 65535, 3420, 4298, 65535, 65535, 5238,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 6423, 65535, 9790, 65535,
+  10394, 65535, 4658, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 7294, 65535, 7526,
+  65535, 10701, 65535, 11364, 65535, 11078, 65535, 3004, 65535, 5432, 65535, 5754,
+  // C14
+  6062, 65535, 6651, 65535, 8052, 65535, 9345, 65535, 9910, 65535, 11067, 65535, 11904, 65535, 12405, 65535,
+  6232, 65535, 7201, 65535, 7612, 65535, 4901, 65535, 65535, 3747, 65535, 2816, 65535, 2234, 65535, 7633,
+  65535, 6870, 65535, 6367, 65535, 5564, 65535, 5009, 65535, 4547, 65535, 1025, 65535, 0, 65535, 9065,
+  65535, 7807, 9066, 65535, 5465, 65535, 65535, 4325, 65535, 3626, 4336, 65535, 65535, 65535, 5407, 65535,
+  6374, 65535, 6221, 65535, 9576, 65535, 10227, 65535, 10286, 65535, 12333, 65535, 7467, 65535, 7768, 65535,
+  5640, 65535, 65535, 7378, 8626, 65535, 65535, 10321, 11706, 65535, 65535, 5980, 6858, 65535, 65535, 4640,
+  65535, 4018, 3059, 65535, 65535, 1614, 7069, 65535, 65535, 5788, 5212, 65535, 5825, 65535, 9192, 65535,
+  9796, 65535, 7218, 65535, 65535, 459, 8531, 65535, 65535, 5061, 4055, 65535, 65535, 6696, 65535, 6928,
+  65535, 10103, 65535, 10766, 65535, 10480, 65535, 12656, 65535, 7992, 65535, 8314,
+  // C15
+  15301, 65535, 15890, 65535, 7041, 65535, 8334, 65535, 8899, 65535, 10056, 65535, 10893, 65535, 11394, 65535,
+  12313, 65535, 13282, 65535, 13693, 65535, 14140, 65535, 5582, 65535, 6249, 65535, 6831, 65535, 7957, 65535,
+  2195, 65535, 2698, 65535, 3765, 65535, 4320, 65535, 4782, 65535, 8040, 65535, 9065, 65535, 0, 65535,
+  1258, 65535, 65535, 4750, 65535, 3600, 4740, 65535, 5439, 65535, 65535, 65535, 5603, 65535, 65535, 65535,
+  15613, 65535, 15460, 65535, 8565, 65535, 9216, 65535, 9275, 65535, 11322, 65535, 13548, 65535, 13849, 65535,
+  14879, 65535, 65535, 6367, 7615, 65535, 65535, 9310, 10695, 65535, 65535, 12061, 12939, 65535, 65535, 13879,
+  5311, 65535, 65535, 6006, 7451, 65535, 65535, 1996, 3277, 65535, 65535, 4117, 15064, 65535, 8181, 65535,
+  8785, 65535, 13299, 65535, 8606, 65535, 65535, 534, 4004, 65535, 65535, 5010, 65535, 15935, 65535, 16167,
+  65535, 9092, 65535, 9755, 65535, 9469, 65535, 11645, 65535, 14073, 65535, 14395,
+  // C16
+  6340, 65535, 6929, 65535, 8330, 65535, 9623, 65535, 10188, 65535, 11345, 65535, 12182, 65535, 12683, 65535,
+  6510, 65535, 7479, 65535, 7890, 65535, 5179, 65535, 65535, 4025, 65535, 3094, 65535, 2512, 65535, 7911,
+  65535, 7148, 65535, 6645, 65535, 5842, 65535, 5287, 65535, 4825, 65535, 1303, 65535, 65535, 65535, 0,
+  65535, 8085, 9344, 65535, 5743, 65535, 65535, 4603, 65535, 3904, 4614, 65535, 65535, 65535, 5685, 65535,
+  6652, 65535, 6499, 65535, 9854, 65535, 10505, 65535, 10564, 65535, 12611, 65535, 7745, 65535, 8046, 65535,
+  5918, 65535, 65535, 7656, 8904, 65535, 65535, 10599, 11984, 65535, 65535, 6258, 7136, 65535, 65535, 4918,
+  65535, 4296, 3337, 65535, 65535, 1892, 7347, 65535, 65535, 6066, 5490, 65535, 6103, 65535, 9470, 65535,
+  10074, 65535, 7496, 65535, 65535, 737, 8809, 65535, 65535, 5339, 4333, 65535, 65535, 6974, 65535, 7206,
+  65535, 10381, 65535, 11044, 65535, 10758, 65535, 12934, 65535, 8270, 65535, 8592,
+  // D1
+  14043, 65535, 14632, 65535, 5783, 65535, 7076, 65535, 7641, 65535, 8798, 65535, 9635, 65535, 10136, 65535,
+  11055, 65535, 12024, 65535, 12435, 65535, 12882, 65535, 4324, 65535, 4991, 65535, 5573, 65535, 6699, 65535,
+  937, 65535, 1440, 65535, 2507, 65535, 3062, 65535, 3524, 65535, 6782, 65535, 7807, 65535, 8085, 65535,
+  0, 65535, 65535, 3492, 65535, 2342, 3482, 65535, 4181, 65535, 65535, 65535, 4345, 65535, 65535, 65535,
+  14355, 65535, 14202, 65535, 7307, 65535, 7958, 65535, 8017, 65535, 10064, 65535, 12290, 65535, 12591, 65535,
+  13621, 65535, 65535, 5109, 6357, 65535, 65535, 8052, 9437, 65535, 65535, 10803, 11681, 65535, 65535, 12621,
+  4053, 65535, 65535, 4748, 6193, 65535, 65535, 738, 2019, 65535, 65535, 2859, 13806, 65535, 6923, 65535,
+  7527, 65535, 12041, 65535, 7348, 65535, 65535, 4027, 2746, 65535, 65535, 3752, 65535, 14677, 65535, 14909,
+  65535, 7834, 65535, 8497, 65535, 8211, 65535, 10387, 65535, 12815, 65535, 13137,
+  // D2
+  7598, 65535, 8187, 65535, 9588, 65535, 10881, 65535, 11446, 65535, 12603, 65535, 13440, 65535, 13941, 65535,
+  7768, 65535, 8737, 65535, 9148, 65535, 6437, 65535, 65535, 5283, 65535, 4352, 65535, 3770, 65535, 4577,
+  65535, 3814, 65535, 3311, 65535, 7100, 65535, 6545, 65535, 6083, 65535, 2561, 65535, 65535, 65535, 1258,
+  65535, 0, 1259, 65535, 2409, 65535, 65535, 5861, 65535, 5162, 5872, 65535, 65535, 65535, 6943, 65535,
+  7910, 65535, 7757, 65535, 11112, 65535, 11763, 65535, 11822, 65535, 13869, 65535, 9003, 65535, 9304, 65535,
+  7176, 65535, 65535, 8914, 10162, 65535, 65535, 11857, 13242, 65535, 65535, 7516, 8394, 65535, 65535, 6176,
+  65535, 5554, 4595, 65535, 65535, 3150, 4013, 65535, 65535, 2732, 6748, 65535, 7361, 65535, 10728, 65535,
+  11332, 65535, 8754, 65535, 65535, 1995, 724, 65535, 65535, 2005, 5591, 65535, 65535, 8232, 65535, 8464,
+  65535, 11639, 65535, 12302, 65535, 12016, 65535, 14192, 65535, 9528, 65535, 9850,
+  // D3
+  8272, 65535, 8861, 65535, 10262, 65535, 11555, 65535, 12120, 65535, 13277, 65535, 14114, 65535, 14615, 65535,
+  8442, 65535, 9411, 65535, 9822, 65535, 7111, 65535, 65535, 5957, 65535, 5026, 65535, 4444, 65535, 3318,
+  65535, 2555, 65535, 2052, 65535, 7774, 65535, 7219, 65535, 6757, 65535, 6053, 65535, 65535, 65535, 4750,
+  65535, 3492, 0, 65535, 1150, 65535, 65535, 6535, 65535, 5836, 6546, 65535, 65535, 65535, 7617, 65535,
+  8584, 65535, 8431, 65535, 11786, 65535, 12437, 65535, 12496, 65535, 14543, 65535, 9677, 65535, 9978, 65535,
+  7850, 65535, 65535, 9588, 10836, 65535, 65535, 12531, 13916, 65535, 65535, 8190, 9068, 65535, 65535, 6850,
+  65535, 6228, 5269, 65535, 65535, 3824, 2754, 65535, 65535, 1473, 7422, 65535, 8035, 65535, 11402, 65535,
+  12006, 65535, 9428, 65535, 65535, 5487, 4216, 65535, 65535, 746, 6265, 65535, 65535, 8906, 65535, 9138,
+  65535, 12313, 65535, 12976, 65535, 12690, 65535, 14866, 65535, 10202, 65535, 10524,
+  // D4
+  15302, 65535, 15891, 65535, 7042, 65535, 8335, 65535, 8900, 65535, 10057, 65535, 10894, 65535, 11395, 65535,
+  12314, 65535, 13283, 65535, 13694, 65535, 14141, 65535, 5583, 65535, 6250, 65535, 6832, 65535, 7958, 65535,
+  2196, 65535, 2699, 65535, 3766, 65535, 4321, 65535, 4783, 65535, 8041, 65535, 9066, 65535, 9344, 65535,
+  1259, 65535, 65535, 0, 65535, 3601, 4741, 65535, 5440, 65535, 65535, 65535, 5604, 65535, 65535, 65535,
+  15614, 65535, 15461, 65535, 8566, 65535, 9217, 65535, 9276, 65535, 11323, 65535, 13549, 65535, 13850, 65535,
+  14880, 65535, 65535, 6368, 7616, 65535, 65535, 9311, 10696, 65535, 65535, 12062, 12940, 65535, 65535, 13880,
+  5312, 65535, 65535, 6007, 7452, 65535, 65535, 1997, 3278, 65535, 65535, 4118, 15065, 65535, 8182, 65535,
+  8786, 65535, 13300, 65535, 8607, 65535, 65535, 535, 4005, 65535, 65535, 5011, 65535, 15936, 65535, 16168,
+  65535, 9093, 65535, 9756, 65535, 9470, 65535, 11646, 65535, 14074, 65535, 14396,
+  // D5
+  7122, 65535, 7711, 65535, 9112, 65535, 10405, 65535, 10970, 65535, 12127, 65535, 12964, 65535, 13465, 65535,
+  7292, 65535, 8261, 65535, 8672, 65535, 5961, 65535, 65535, 4807, 65535, 3876, 65535, 3294, 65535, 2168,
+  65535, 1405, 65535, 902, 65535, 6624, 65535, 6069, 65535, 5607, 65535, 4903, 65535, 65535, 65535, 3600,
+  65535, 2342, 3601, 65535, 0, 65535, 65535, 5385, 65535, 4686, 5396, 65535, 65535, 65535, 6467, 65535,
+  7434, 65535, 7281, 65535, 10636, 65535, 11287, 65535, 11346, 65535, 13393, 65535, 8527, 65535, 8828, 65535,
+  6700, 65535, 65535, 8438, 9686, 65535, 65535, 11381, 12766, 65535, 65535, 7040, 7918, 65535, 65535, 5700,
+  65535, 5078, 4119, 65535, 65535, 2674, 1604, 65535, 65535, 323, 6272, 65535, 6885, 65535, 10252, 65535,
+  10856, 65535, 8278, 65535, 65535, 4337, 3066, 65535, 65535, 4347, 5115, 65535, 65535, 7756, 65535, 7988,
+  65535, 11163, 65535, 11826, 65535, 11540, 65535, 13716, 65535, 9052, 65535, 9374,
+  // D6
+  12125, 65535, 12714, 65535, 8192, 65535, 9485, 65535, 10050, 65535, 6880, 65535, 7717, 65535, 8218, 65535,
+  9137, 65535, 10106, 65535, 10517, 65535, 10964, 65535, 6733, 65535, 2649, 65535, 3231, 65535, 4357, 65535,
+  3346, 65535, 3849, 65535, 4916, 65535, 5471, 65535, 5933, 65535, 4440, 65535, 5465, 65535, 5743, 65535,
+  2409, 65535, 65535, 1150, 65535, 0, 1140, 65535, 1839, 65535, 65535, 65535, 6754, 65535, 65535, 65535,
+  12437, 65535, 12284, 65535, 9716, 65535, 10367, 65535, 10426, 65535, 8146, 65535, 10372, 65535, 10673, 65535,
+  11703, 65535, 65535, 7518, 8766, 65535, 65535, 6134, 7519, 65535, 65535, 8885, 9763, 65535, 65535, 10703,
+  6462, 65535, 65535, 2406, 3851, 65535, 65535, 3147, 4428, 65535, 65535, 5268, 11888, 65535, 9332, 65535,
+  9936, 65535, 10123, 65535, 5006, 65535, 65535, 1685, 404, 65535, 65535, 1410, 65535, 12759, 65535, 12991,
+  65535, 10243, 65535, 10906, 65535, 10620, 65535, 8469, 65535, 10897, 65535, 11219,
+  // D7
+  10985, 65535, 11574, 65535, 8826, 65535, 10119, 65535, 10684, 65535, 5740, 65535, 6577, 65535, 7078, 65535,
+  7997, 65535, 8966, 65535, 9377, 65535, 9824, 65535, 7367, 65535, 1509, 65535, 2091, 65535, 3217, 65535,
+  3980, 65535, 4483, 65535, 5550, 65535, 6105, 65535, 6567, 65535, 3300, 65535, 4325, 65535, 4603, 65535,
+  5861, 65535, 65535, 6535, 65535, 5385, 0, 65535, 699, 65535, 65535, 65535, 7388, 65535, 65535, 65535,
+  11297, 65535, 11144, 65535, 10350, 65535, 11001, 65535, 11060, 65535, 7006, 65535, 9232, 65535, 9533, 65535,
+  10563, 65535, 65535, 8152, 9400, 65535, 65535, 4994, 6379, 65535, 65535, 7745, 8623, 65535, 65535, 9563,
+  7096, 65535, 65535, 1266, 2711, 65535, 65535, 3781, 5062, 65535, 65535, 5902, 10748, 65535, 9966, 65535,
+  10570, 65535, 8983, 65535, 3866, 65535, 65535, 5137, 5789, 65535, 65535, 270, 65535, 11619, 65535, 11851,
+  65535, 10877, 65535, 11540, 65535, 11254, 65535, 7329, 65535, 9757, 65535, 10079,
+  // D8
+  8262, 65535, 8851, 65535, 10252, 65535, 11545, 65535, 12110, 65535, 13267, 65535, 14104, 65535, 14605, 65535,
+  8432, 65535, 9401, 65535, 9812, 65535, 7101, 65535, 65535, 5947, 65535, 5016, 65535, 4434, 65535, 3308,
+  65535, 2545, 65535, 2042, 65535, 7764, 65535, 7209, 65535, 6747, 65535, 6043, 65535, 65535, 65535, 4740,
+  65535, 3482, 4741, 65535, 1140, 65535, 65535, 0, 65535, 5826, 6536, 65535, 65535, 65535, 7607, 65535,
+  8574, 65535, 8421, 65535, 11776, 65535, 12427, 65535, 12486, 65535, 14533, 65535, 9667, 65535, 9968, 65535,
+  7840, 65535, 65535, 9578, 10826, 65535, 65535, 12521, 13906, 65535, 65535, 8180, 9058, 65535, 65535, 6840,
+  65535, 6218, 5259, 65535, 65535, 3814, 2744, 65535, 65535, 1463, 7412, 65535, 8025, 65535, 11392, 65535,
+  11996, 65535, 9418, 65535, 65535, 5477, 4206, 65535, 65535, 736, 6255, 65535, 65535, 8896, 65535, 9128,
+  65535, 12303, 65535, 12966, 65535, 12680, 65535, 14856, 65535, 10192, 65535, 10514,
+  // D9
+  10286, 65535, 10875, 65535, 8127, 65535, 9420, 65535, 9985, 65535, 5041, 65535, 5878, 65535, 6379, 65535,
+  7298, 65535, 8267, 65535, 8678, 65535, 9125, 65535, 6668, 65535, 810, 65535, 1392, 65535, 2518, 65535,
+  3281, 65535, 3784, 65535, 4851, 65535, 5406, 65535, 5868, 65535, 2601, 65535, 3626, 65535, 3904, 65535,
+  5162, 65535, 65535, 5836, 65535, 4686, 5826, 65535, 0, 65535, 65535, 65535, 6689, 65535, 65535, 65535,
+  10598, 65535, 10445, 65535, 9651, 65535, 10302, 65535, 10361, 65535, 6307, 65535, 8533, 65535, 8834, 65535,
+  9864, 65535, 65535, 7453, 8701, 65535, 65535, 4295, 5680, 65535, 65535, 7046, 7924, 65535, 65535, 8864,
+  6397, 65535, 65535, 567, 2012, 65535, 65535, 3082, 4363, 65535, 65535, 5203, 10049, 65535, 9267, 65535,
+  9871, 65535, 8284, 65535, 3167, 65535, 65535, 4438, 5090, 65535, 65535, 6096, 65535, 10920, 65535, 11152,
+  65535, 10178, 65535, 10841, 65535, 10555, 65535, 6630, 65535, 9058, 65535, 9380,
+  // D10
+  2436, 65535, 3025, 65535, 4426, 65535, 5719, 65535, 6284, 65535, 7441, 65535, 8278, 65535, 8779, 65535,
+  9131, 65535, 10100, 65535, 10511, 65535, 1275, 65535, 65535, 6646, 65535, 5715, 65535, 5133, 65535, 4007,
+  65535, 3244, 65535, 2741, 65535, 8463, 65535, 7908, 65535, 7446, 65535, 6742, 65535, 65535, 65535, 5439,
+  65535, 4181, 5440, 65535, 1839, 65535, 65535, 699, 65535, 0, 710, 65535, 65535, 65535, 8306, 65535,
+  2748, 65535, 2595, 65535, 5950, 65535, 6601, 65535, 6660, 65535, 8707, 65535, 10366, 65535, 10667, 65535,
+  2014, 65535, 65535, 3752, 5000, 65535, 65535, 6695, 8080, 65535, 65535, 8879, 9757, 65535, 65535, 1014,
+  65535, 6917, 5958, 65535, 65535, 4513, 3443, 65535, 65535, 2162, 8111, 65535, 2199, 65535, 5566, 65535,
+  6170, 65535, 10117, 65535, 65535, 6176, 4905, 65535, 65535, 1435, 429, 65535, 65535, 3070, 65535, 3302,
+  65535, 6477, 65535, 7140, 65535, 6854, 65535, 9030, 65535, 10891, 65535, 11213,
+  // D11
+  1726, 65535, 2315, 65535, 3716, 65535, 5009, 65535, 5574, 65535, 6731, 65535, 7568, 65535, 8069, 65535,
+  8988, 65535, 9957, 65535, 10368, 65535, 565, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 65535, 65535, 65535, 65535, 65535,
+  2038, 65535, 1885, 65535, 5240, 65535, 5891, 65535, 5950, 65535, 7997, 65535, 10223, 65535, 10524, 65535,
+  1304, 65535, 65535, 3042, 4290, 65535, 65535, 5985, 7370, 65535, 65535, 8736, 9614, 65535, 65535, 304,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1489, 65535, 4856, 65535,
+  5460, 65535, 9974, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2360, 65535, 2592,
+  65535, 5767, 65535, 6430, 65535, 6144, 65535, 8320, 65535, 10748, 65535, 11070,
+  // D12
+  10996, 65535, 11585, 65535, 8837, 65535, 10130, 65535, 10695, 65535, 5751, 65535, 6588, 65535, 7089, 65535,
+  8008, 65535, 8977, 65535, 9388, 65535, 9835, 65535, 7378, 65535, 1520, 65535, 2102, 65535, 3228, 65535,
+  3991, 65535, 4494, 65535, 5561, 65535, 6116, 65535, 6578, 65535, 3311, 65535, 4336, 65535, 4614, 65535,
+  5872, 65535, 65535, 6546, 65535, 5396, 6536, 65535, 710, 65535, 65535, 0, 7399, 65535, 65535, 65535,
+  11308, 65535, 11155, 65535, 10361, 65535, 11012, 65535, 11071, 65535, 7017, 65535, 9243, 65535, 9544, 65535,
+  10574, 65535, 65535, 8163, 9411, 65535, 65535, 5005, 6390, 65535, 65535, 7756, 8634, 65535, 65535, 9574,
+  7107, 65535, 65535, 1277, 2722, 65535, 65535, 3792, 5073, 65535, 65535, 5913, 10759, 65535, 9977, 65535,
+  10581, 65535, 8994, 65535, 3877, 65535, 65535, 5148, 5800, 65535, 65535, 281, 65535, 11630, 65535, 11862,
+  65535, 10888, 65535, 11551, 65535, 11265, 65535, 7340, 65535, 9768, 65535, 10090,
+  // D13
+  9698, 65535, 10287, 65535, 1438, 65535, 2731, 65535, 3296, 65535, 4453, 65535, 5290, 65535, 5791, 65535,
+  6710, 65535, 7679, 65535, 8090, 65535, 8537, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 65535, 65535, 65535,
+  10010, 65535, 9857, 65535, 2962, 65535, 3613, 65535, 3672, 65535, 5719, 65535, 7945, 65535, 8246, 65535,
+  9276, 65535, 65535, 764, 2012, 65535, 65535, 3707, 5092, 65535, 65535, 6458, 7336, 65535, 65535, 8276,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 9461, 65535, 2578, 65535,
+  3182, 65535, 7696, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 10332, 65535, 10564,
+  65535, 3489, 65535, 4152, 65535, 3866, 65535, 6042, 65535, 8470, 65535, 8792,
+  // D14
+  5494, 65535, 6083, 65535, 7484, 65535, 8777, 65535, 9342, 65535, 10499, 65535, 11336, 65535, 11837, 65535,
+  2506, 65535, 3475, 65535, 3886, 65535, 4333, 65535, 65535, 6810, 65535, 5879, 65535, 5297, 65535, 4171,
+  65535, 3408, 65535, 2905, 65535, 1838, 65535, 1283, 65535, 821, 65535, 6906, 65535, 65535, 65535, 5603,
+  65535, 4345, 5604, 65535, 6754, 65535, 65535, 7388, 65535, 6689, 7399, 65535, 65535, 0, 1681, 65535,
+  5806, 65535, 5653, 65535, 9008, 65535, 9659, 65535, 9718, 65535, 11765, 65535, 3741, 65535, 4042, 65535,
+  5072, 65535, 65535, 6810, 8058, 65535, 65535, 9753, 11138, 65535, 65535, 2254, 3132, 65535, 65535, 4072,
+  65535, 292, 6122, 65535, 65535, 4677, 3607, 65535, 65535, 2326, 1486, 65535, 5257, 65535, 8624, 65535,
+  9228, 65535, 3492, 65535, 65535, 6340, 5069, 65535, 65535, 6350, 7118, 65535, 65535, 6128, 65535, 6360,
+  65535, 9535, 65535, 10198, 65535, 9912, 65535, 12088, 65535, 4266, 65535, 4588,
+  // D15
+  3813, 65535, 4402, 65535, 5803, 65535, 7096, 65535, 7661, 65535, 8818, 65535, 9655, 65535, 10156, 65535,
+  825, 65535, 1794, 65535, 2205, 65535, 2652, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 65535,
+  4125, 65535, 3972, 65535, 7327, 65535, 7978, 65535, 8037, 65535, 10084, 65535, 2060, 65535, 2361, 65535,
+  3391, 65535, 65535, 5129, 6377, 65535, 65535, 8072, 9457, 65535, 65535, 573, 1451, 65535, 65535, 2391,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3576, 65535, 6943, 65535,
+  7547, 65535, 1811, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4447, 65535, 4679,
+  65535, 7854, 65535, 8517, 65535, 8231, 65535, 10407, 65535, 2585, 65535, 2907,
+  // D16
+  11379, 65535, 11968, 65535, 3119, 65535, 4412, 65535, 4977, 65535, 6134, 65535, 6971, 65535, 7472, 65535,
+  8391, 65535, 9360, 65535, 9771, 65535, 10218, 65535, 1660, 65535, 2591, 65535, 3173, 65535, 4299, 65535,
+  5062, 65535, 5565, 65535, 6632, 65535, 398, 65535, 860, 65535, 4382, 65535, 5407, 65535, 5685, 65535,
+  6943, 65535, 65535, 7617, 65535, 6467, 7607, 65535, 8306, 65535, 65535, 65535, 1681, 65535, 65535, 0,
+  11691, 65535, 11538, 65535, 4643, 65535, 5294, 65535, 5353, 65535, 7400, 65535, 9626, 65535, 9927, 65535,
+  10957, 65535, 65535, 2445, 3693, 65535, 65535, 5388, 6773, 65535, 65535, 8139, 9017, 65535, 65535, 9957,
+  1389, 65535, 65535, 2348, 3793, 65535, 65535, 4863, 6144, 65535, 65535, 195, 11142, 65535, 4259, 65535,
+  4863, 65535, 9377, 65535, 4948, 65535, 65535, 6219, 6871, 65535, 65535, 7877, 65535, 12013, 65535, 12245,
+  65535, 5170, 65535, 5833, 65535, 5547, 65535, 7723, 65535, 10151, 65535, 10473,
+  // E1
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  0, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 322, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  // E2
+  13034, 10562, 13623, 9973, 7244, 8572, 8537, 7279, 9102, 6714, 7789, 5557, 8626, 4720, 9127, 4219,
+  10046, 3300, 11015, 2331, 11426, 1920, 11873, 1473, 5785, 10719, 3558, 9788, 4140, 9206, 5266, 14181,
+  6029, 13418, 6532, 12915, 7599, 11848, 4523, 11293, 4985, 10831, 5349, 7997, 6374, 6972, 6652, 15613,
+  7910, 14355, 15614, 8584, 12437, 7434, 8574, 11297, 2748, 10598, 11308, 2038, 5806, 10010, 11691, 4125,
+  13346, 0, 13193, 65535, 8768, 65535, 9419, 65535, 9478, 65535, 9055, 65535, 11281, 65535, 11582, 65535,
+  12612, 734, 9246, 6570, 7818, 7998, 6303, 7043, 8428, 4918, 3552, 9794, 10672, 2674, 1734, 11612,
+  5514, 10302, 10031, 3315, 4760, 8586, 13617, 5830, 7111, 12336, 11496, 4320, 12797, 549, 8384, 65535,
+  8988, 65535, 11032, 65535, 5915, 7431, 15079, 7186, 7838, 12033, 11027, 2319, 65535, 13668, 65535, 13900,
+  65535, 9295, 65535, 9958, 65535, 9672, 65535, 9378, 65535, 11806, 65535, 12128,
+  // E3
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 0, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 707,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  // E4
+  12881, 10409, 13470, 9820, 7091, 8419, 8384, 7126, 8949, 6561, 7636, 5404, 8473, 4567, 8974, 4066,
+  9893, 3147, 10862, 2178, 11273, 1767, 11720, 1320, 5632, 10566, 3405, 9635, 3987, 9053, 5113, 14028,
+  5876, 13265, 6379, 12762, 7446, 11695, 4370, 11140, 4832, 10678, 5196, 7844, 6221, 6819, 6499, 15460,
+  7757, 14202, 15461, 8431, 12284, 7281, 8421, 11144, 2595, 10445, 11155, 1885, 5653, 9857, 11538, 3972,
+  13193, 65535, 13040, 0, 8615, 65535, 9266, 65535, 9325, 65535, 8902, 65535, 11128, 65535, 11429, 65535,
+  12459, 581, 9093, 6417, 7665, 7845, 6150, 6890, 8275, 4765, 3399, 9641, 10519, 2521, 1581, 11459,
+  5361, 10149, 9878, 3162, 4607, 8433, 13464, 5677, 6958, 12183, 11343, 4167, 12644, 396, 8231, 65535,
+  8835, 65535, 10879, 65535, 5762, 7278, 14926, 7033, 7685, 11880, 10874, 2166, 65535, 13515, 65535, 13747,
+  65535, 9142, 65535, 9805, 65535, 9519, 65535, 9225, 65535, 11653, 65535, 11975,
+  // E5
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 0, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 527, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  // E6
+  8456, 3514, 9045, 2925, 10446, 1524, 11739, 10481, 12304, 9916, 10991, 8759, 11828, 7922, 12329, 7421,
+  5468, 6502, 6437, 5533, 6848, 5122, 7295, 4675, 8987, 9772, 6760, 8841, 7342, 8259, 8468, 7133,
+  9231, 6370, 9734, 5867, 10801, 4800, 7725, 4245, 8187, 3783, 8551, 9868, 9576, 10174, 9854, 8565,
+  11112, 7307, 8566, 11786, 9716, 10636, 11776, 10350, 5950, 9651, 10361, 5240, 9008, 2962, 4643, 7327,
+  8768, 65535, 8615, 65535, 11970, 0, 12621, 65535, 12680, 65535, 12257, 65535, 6703, 65535, 7004, 65535,
+  8034, 3936, 2198, 9772, 11020, 950, 9505, 10245, 11630, 8120, 6754, 5216, 6094, 5876, 4936, 7034,
+  8716, 3254, 9084, 6517, 7962, 7639, 6569, 9032, 10313, 5288, 4448, 7522, 8219, 65535, 11586, 384,
+  12190, 65535, 6454, 65535, 9117, 9302, 8031, 10388, 11040, 9312, 10080, 5521, 65535, 9090, 65535, 9322,
+  65535, 12497, 65535, 13160, 65535, 12874, 65535, 12580, 65535, 7228, 65535, 7550,
+  // E7
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 0, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 539, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  // E8
+  9107, 4165, 9696, 3576, 11097, 2175, 12390, 11132, 12955, 10567, 11642, 9410, 12479, 8573, 12980, 8072,
+  6119, 7153, 7088, 6184, 7499, 5773, 7946, 5326, 9638, 10423, 7411, 9492, 7993, 8910, 9119, 7784,
+  9882, 7021, 10385, 6518, 11452, 5451, 8376, 4896, 8838, 4434, 9202, 10519, 10227, 10825, 10505, 9216,
+  11763, 7958, 9217, 12437, 10367, 11287, 12427, 11001, 6601, 10302, 11012, 5891, 9659, 3613, 5294, 7978,
+  9419, 65535, 9266, 65535, 12621, 65535, 13272, 0, 13331, 65535, 12908, 65535, 7354, 65535, 7655, 65535,
+  8685, 4587, 2849, 10423, 11671, 1601, 10156, 10896, 12281, 8771, 7405, 5867, 6745, 6527, 5587, 7685,
+  9367, 3905, 9735, 7168, 8613, 8290, 7220, 9683, 10964, 5939, 5099, 8173, 8870, 65535, 12237, 1035,
+  12841, 431, 7105, 65535, 9768, 9953, 8682, 11039, 11691, 9963, 10731, 6172, 65535, 9741, 65535, 9973,
+  65535, 13148, 65535, 13811, 65535, 13525, 65535, 13231, 65535, 7879, 65535, 8201,
+  // E9
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 194, 65535, 65535, 65535, 65535, 65535, 65535,
+  // E10
+  9166, 4224, 9755, 3635, 11156, 2234, 12449, 11191, 13014, 10626, 11701, 9469, 12538, 8632, 13039, 8131,
+  6178, 7212, 7147, 6243, 7558, 5832, 8005, 5385, 9697, 10482, 7470, 9551, 8052, 8969, 9178, 7843,
+  9941, 7080, 10444, 6577, 11511, 5510, 8435, 4955, 8897, 4493, 9261, 10578, 10286, 10884, 10564, 9275,
+  11822, 8017, 9276, 12496, 10426, 11346, 12486, 11060, 6660, 10361, 11071, 5950, 9718, 3672, 5353, 8037,
+  9478, 65535, 9325, 65535, 12680, 65535, 13331, 65535, 13390, 0, 12967, 65535, 7413, 65535, 7714, 65535,
+  8744, 4646, 2908, 10482, 11730, 1660, 10215, 10955, 12340, 8830, 7464, 5926, 6804, 6586, 5646, 7744,
+  9426, 3964, 9794, 7227, 8672, 8349, 7279, 9742, 11023, 5998, 5158, 8232, 8929, 65535, 12296, 1094,
+  12900, 490, 7164, 65535, 9827, 10012, 8741, 11098, 11750, 10022, 10790, 6231, 65535, 9800, 65535, 10032,
+  65535, 13207, 65535, 13870, 65535, 13584, 65535, 13290, 65535, 7938, 65535, 8260,
+  // E11
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 323, 65535, 65535, 65535, 65535,
+  // E12
+  8743, 6271, 9332, 5682, 10733, 4281, 12026, 2988, 12591, 2423, 13748, 1266, 14585, 10679, 15086, 10178,
+  8225, 9259, 9194, 8290, 9605, 7879, 7582, 7432, 11744, 6428, 9517, 5497, 10099, 4915, 11225, 9890,
+  11988, 9127, 12491, 8624, 13558, 7557, 10482, 7002, 10944, 6540, 11308, 3706, 12333, 2681, 12611, 11322,
+  13869, 10064, 11323, 14543, 8146, 13393, 14533, 7006, 8707, 6307, 7017, 7997, 11765, 5719, 7400, 10084,
+  9055, 65535, 8902, 65535, 12257, 65535, 12908, 65535, 12967, 65535, 15014, 0, 9460, 65535, 9761, 65535,
+  8321, 6693, 4955, 10059, 11307, 3707, 2012, 13002, 14387, 627, 9511, 7973, 8851, 8633, 7693, 7321,
+  11473, 6011, 5740, 9274, 10719, 4295, 9326, 11789, 13070, 8045, 7205, 10279, 8506, 65535, 11873, 65535,
+  12477, 65535, 9211, 65535, 11874, 3140, 10788, 13145, 13797, 7742, 6736, 8278, 65535, 9377, 65535, 9609,
+  65535, 12784, 65535, 13447, 65535, 13161, 65535, 15337, 65535, 9985, 65535, 10307,
+  // E13
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 525, 65535, 65535,
+  // E14
+  10969, 8497, 11558, 7908, 5179, 6507, 6472, 5214, 7037, 4649, 8194, 3492, 9031, 2655, 9532, 2154,
+  10451, 1235, 11420, 10516, 11831, 10105, 9808, 9658, 3720, 8654, 4651, 7723, 5233, 7141, 6359, 12116,
+  7122, 11353, 7625, 10850, 8692, 9783, 2458, 9228, 2920, 8766, 6442, 5932, 7467, 4907, 7745, 13548,
+  9003, 12290, 13549, 9677, 10372, 8527, 9667, 9232, 10366, 8533, 9243, 10223, 3741, 7945, 9626, 2060,
+  11281, 65535, 11128, 65535, 6703, 65535, 7354, 65535, 7413, 65535, 9460, 65535, 11686, 0, 11987, 65535,
+  10547, 8919, 7181, 4505, 5753, 5933, 4238, 7448, 8833, 2853, 1487, 10199, 11077, 609, 9919, 9547,
+  3449, 8237, 7966, 4408, 5853, 6521, 11552, 6923, 8204, 10271, 9431, 2255, 10732, 65535, 6319, 65535,
+  6923, 65535, 11437, 249, 7008, 5366, 13014, 8279, 8931, 9968, 8962, 9937, 65535, 11603, 65535, 11835,
+  65535, 7230, 65535, 7893, 65535, 7607, 65535, 9783, 65535, 12211, 65535, 12533,
+  // E15
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 546,
+  // E16
+  11270, 8798, 11859, 8209, 5480, 6808, 6773, 5515, 7338, 4950, 8495, 3793, 9332, 2956, 9833, 2455,
+  10752, 1536, 11721, 10817, 12132, 10406, 10109, 9959, 4021, 8955, 4952, 8024, 5534, 7442, 6660, 12417,
+  7423, 11654, 7926, 11151, 8993, 10084, 2759, 9529, 3221, 9067, 6743, 6233, 7768, 5208, 8046, 13849,
+  9304, 12591, 13850, 9978, 10673, 8828, 9968, 9533, 10667, 8834, 9544, 10524, 4042, 8246, 9927, 2361,
+  11582, 65535, 11429, 65535, 7004, 65535, 7655, 65535, 7714, 65535, 9761, 65535, 11987, 65535, 12288, 0,
+  10848, 9220, 7482, 4806, 6054, 6234, 4539, 7749, 9134, 3154, 1788, 10500, 11378, 910, 10220, 9848,
+  3750, 8538, 8267, 4709, 6154, 6822, 11853, 7224, 8505, 10572, 9732, 2556, 11033, 65535, 6620, 65535,
+  7224, 65535, 11738, 550, 7309, 5667, 13315, 8580, 9232, 10269, 9263, 10238, 65535, 11904, 65535, 12136,
+  65535, 7531, 65535, 8194, 65535, 7908, 65535, 10084, 65535, 12512, 65535, 12834,
+  // BR1
+  422, 65535, 1011, 65535, 2412, 65535, 3705, 65535, 4270, 65535, 5427, 65535, 6264, 65535, 6765, 65535,
+  7684, 65535, 8653, 65535, 9064, 65535, 9511, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  734, 65535, 581, 65535, 3936, 65535, 4587, 65535, 4646, 65535, 6693, 65535, 8919, 65535, 9220, 65535,
+  0, 65535, 65535, 1738, 2986, 65535, 65535, 4681, 6066, 65535, 65535, 7432, 8310, 65535, 65535, 9250,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 185, 65535, 3552, 65535,
+  4156, 65535, 8670, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1056, 65535, 1288,
+  65535, 4463, 65535, 5126, 65535, 4840, 65535, 7016, 65535, 9444, 65535, 9766,
+  // MR1
+  12300, 9828, 12889, 9239, 6510, 7838, 7803, 6545, 8368, 5980, 7055, 4823, 7892, 3986, 8393, 3485,
+  9312, 2566, 10281, 1597, 10692, 1186, 11139, 739, 5051, 9985, 2824, 9054, 3406, 8472, 4532, 13447,
+  5295, 12684, 5798, 12181, 6865, 11114, 3789, 10559, 4251, 10097, 4615, 7263, 5640, 6238, 5918, 14879,
+  7176, 13621, 14880, 7850, 11703, 6700, 7840, 10563, 2014, 9864, 10574, 1304, 5072, 9276, 10957, 3391,
+  12612, 65535, 12459, 65535, 8034, 65535, 8685, 65535, 8744, 65535, 8321, 65535, 10547, 65535, 10848, 65535,
+  11878, 0, 8512, 5836, 7084, 7264, 5569, 6309, 7694, 4184, 2818, 9060, 9938, 1940, 1000, 10878,
+  4780, 9568, 9297, 2581, 4026, 7852, 12883, 5096, 6377, 11602, 10762, 3586, 12063, 65535, 7650, 65535,
+  8254, 65535, 10298, 65535, 5181, 6697, 14345, 6452, 7104, 11299, 10293, 1585, 65535, 12934, 65535, 13166,
+  65535, 8561, 65535, 9224, 65535, 8938, 65535, 8644, 65535, 11072, 65535, 11394,
+  // BR2
+  6258, 1316, 6847, 727, 8248, 9576, 9541, 8283, 10106, 7718, 8793, 6561, 9630, 5724, 10131, 5223,
+  3270, 4304, 4239, 3335, 4650, 2924, 5097, 2477, 6789, 7574, 4562, 6643, 5144, 6061, 6270, 4935,
+  7033, 4172, 7536, 3669, 8603, 2602, 5527, 2047, 5989, 1585, 6353, 7670, 7378, 7976, 7656, 6367,
+  8914, 5109, 6368, 9588, 7518, 8438, 9578, 8152, 3752, 7453, 8163, 3042, 6810, 764, 2445, 5129,
+  6570, 65535, 6417, 65535, 9772, 65535, 10423, 65535, 10482, 65535, 10059, 65535, 4505, 65535, 4806, 65535,
+  5836, 1738, 0, 7574, 8822, 9002, 7307, 8047, 9432, 5922, 4556, 3018, 3896, 3678, 2738, 4836,
+  6518, 1056, 6886, 4319, 5764, 5441, 4371, 6834, 8115, 3090, 2250, 5324, 6021, 65535, 9388, 65535,
+  9992, 65535, 4256, 65535, 6919, 7104, 5833, 8190, 8842, 7114, 7882, 3323, 65535, 6892, 65535, 7124,
+  65535, 10299, 65535, 10962, 65535, 10676, 65535, 10382, 65535, 5030, 65535, 5352,
+  // MR2
+  8934, 65535, 9523, 65535, 674, 65535, 1967, 65535, 2532, 65535, 3689, 65535, 4526, 65535, 5027, 65535,
+  5946, 65535, 6915, 65535, 7326, 65535, 7773, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  9246, 65535, 9093, 65535, 2198, 65535, 2849, 65535, 2908, 65535, 4955, 65535, 7181, 65535, 7482, 65535,
+  8512, 65535, 65535, 0, 1248, 65535, 65535, 2943, 4328, 65535, 65535, 5694, 6572, 65535, 65535, 7512,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 8697, 65535, 1814, 65535,
+  2418, 65535, 6932, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 9568, 65535, 9800,
+  65535, 2725, 65535, 3388, 65535, 3102, 65535, 5278, 65535, 7706, 65535, 8028,
+  // BR3
+  7686, 65535, 8275, 65535, 9676, 65535, 719, 65535, 1284, 65535, 2441, 65535, 3278, 65535, 3779, 65535,
+  4698, 65535, 5667, 65535, 6078, 65535, 6525, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  7998, 65535, 7845, 65535, 950, 65535, 1601, 65535, 1660, 65535, 3707, 65535, 5933, 65535, 6234, 65535,
+  7264, 65535, 65535, 9002, 0, 65535, 65535, 1695, 3080, 65535, 65535, 4446, 5324, 65535, 65535, 6264,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 7449, 65535, 566, 65535,
+  1170, 65535, 5684, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 8320, 65535, 8552,
+  65535, 1477, 65535, 2140, 65535, 1854, 65535, 4030, 65535, 6458, 65535, 6780,
+  // MR3
+  7506, 2564, 8095, 1975, 9496, 574, 10789, 9531, 11354, 8966, 10041, 7809, 10878, 6972, 11379, 6471,
+  4518, 5552, 5487, 4583, 5898, 4172, 6345, 3725, 8037, 8822, 5810, 7891, 6392, 7309, 7518, 6183,
+  8281, 5420, 8784, 4917, 9851, 3850, 6775, 3295, 7237, 2833, 7601, 8918, 8626, 9224, 8904, 7615,
+  10162, 6357, 7616, 10836, 8766, 9686, 10826, 9400, 5000, 8701, 9411, 4290, 8058, 2012, 3693, 6377,
+  7818, 65535, 7665, 65535, 11020, 65535, 11671, 65535, 11730, 65535, 11307, 65535, 5753, 65535, 6054, 65535,
+  7084, 2986, 1248, 8822, 10070, 0, 8555, 9295, 10680, 7170, 5804, 4266, 5144, 4926, 3986, 6084,
+  7766, 2304, 8134, 5567, 7012, 6689, 5619, 8082, 9363, 4338, 3498, 6572, 7269, 65535, 10636, 65535,
+  11240, 65535, 5504, 65535, 8167, 8352, 7081, 9438, 10090, 8362, 9130, 4571, 65535, 8140, 65535, 8372,
+  65535, 11547, 65535, 12210, 65535, 11924, 65535, 11630, 65535, 6278, 65535, 6600,
+  // BR4
+  6731, 4259, 7320, 3670, 8721, 2269, 10014, 976, 10579, 411, 11736, 9504, 12573, 8667, 13074, 8166,
+  6213, 7247, 7182, 6278, 7593, 5867, 5570, 5420, 9732, 4416, 7505, 3485, 8087, 2903, 9213, 7878,
+  9976, 7115, 10479, 6612, 11546, 5545, 8470, 4990, 8932, 4528, 9296, 1694, 10321, 669, 10599, 9310,
+  11857, 8052, 9311, 12531, 6134, 11381, 12521, 4994, 6695, 4295, 5005, 5985, 9753, 3707, 5388, 8072,
+  7043, 65535, 6890, 65535, 10245, 65535, 10896, 65535, 10955, 65535, 13002, 65535, 7448, 65535, 7749, 65535,
+  6309, 4681, 2943, 8047, 9295, 1695, 0, 10990, 12375, 8865, 7499, 5961, 6839, 6621, 5681, 5309,
+  9461, 3999, 3728, 7262, 8707, 2283, 7314, 9777, 11058, 6033, 5193, 8267, 6494, 65535, 9861, 65535,
+  10465, 65535, 7199, 65535, 9862, 1128, 8776, 11133, 11785, 5730, 4724, 6266, 65535, 7365, 65535, 7597,
+  65535, 10772, 65535, 11435, 65535, 11149, 65535, 13325, 65535, 7973, 65535, 8295,
+  // MR4
+  5991, 65535, 6580, 65535, 7981, 65535, 9274, 65535, 9839, 65535, 746, 65535, 1583, 65535, 2084, 65535,
+  3003, 65535, 3972, 65535, 4383, 65535, 4830, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  6303, 65535, 6150, 65535, 9505, 65535, 10156, 65535, 10215, 65535, 2012, 65535, 4238, 65535, 4539, 65535,
+  5569, 65535, 65535, 7307, 8555, 65535, 65535, 0, 1385, 65535, 65535, 2751, 3629, 65535, 65535, 4569,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5754, 65535, 9121, 65535,
+  9725, 65535, 3989, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 6625, 65535, 6857,
+  65535, 10032, 65535, 10695, 65535, 10409, 65535, 2335, 65535, 4763, 65535, 5085,
+  // BR5
+  4606, 65535, 5195, 65535, 6596, 65535, 7889, 65535, 8454, 65535, 9611, 65535, 198, 65535, 699, 65535,
+  1618, 65535, 2587, 65535, 2998, 65535, 3445, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  4918, 65535, 4765, 65535, 8120, 65535, 8771, 65535, 8830, 65535, 627, 65535, 2853, 65535, 3154, 65535,
+  4184, 65535, 65535, 5922, 7170, 65535, 65535, 8865, 0, 65535, 65535, 1366, 2244, 65535, 65535, 3184,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4369, 65535, 7736, 65535,
+  8340, 65535, 2604, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5240, 65535, 5472,
+  65535, 8647, 65535, 9310, 65535, 9024, 65535, 950, 65535, 3378, 65535, 3700,
+  // MR5
+  8116, 5644, 8705, 5055, 10106, 3654, 11399, 2361, 11964, 1796, 13121, 639, 13958, 10052, 14459, 9551,
+  7598, 8632, 8567, 7663, 8978, 7252, 6955, 6805, 11117, 5801, 8890, 4870, 9472, 4288, 10598, 9263,
+  11361, 8500, 11864, 7997, 12931, 6930, 9855, 6375, 10317, 5913, 10681, 3079, 11706, 2054, 11984, 10695,
+  13242, 9437, 10696, 13916, 7519, 12766, 13906, 6379, 8080, 5680, 6390, 7370, 11138, 5092, 6773, 9457,
+  8428, 65535, 8275, 65535, 11630, 65535, 12281, 65535, 12340, 65535, 14387, 65535, 8833, 65535, 9134, 65535,
+  7694, 6066, 4328, 9432, 10680, 3080, 1385, 12375, 13760, 0, 8884, 7346, 8224, 8006, 7066, 6694,
+  10846, 5384, 5113, 8647, 10092, 3668, 8699, 11162, 12443, 7418, 6578, 9652, 7879, 65535, 11246, 65535,
+  11850, 65535, 8584, 65535, 11247, 2513, 10161, 12518, 13170, 7115, 6109, 7651, 65535, 8750, 65535, 8982,
+  65535, 12157, 65535, 12820, 65535, 12534, 65535, 14710, 65535, 9358, 65535, 9680,
+  // BR6
+  9482, 7010, 10071, 6421, 3692, 5020, 4985, 3727, 5550, 3162, 6707, 2005, 7544, 1168, 8045, 667,
+  8964, 9998, 9933, 9029, 10344, 8618, 8321, 8171, 2233, 7167, 3164, 6236, 3746, 5654, 4872, 10629,
+  5635, 9866, 6138, 9363, 7205, 8296, 971, 7741, 1433, 7279, 4955, 4445, 5980, 3420, 6258, 12061,
+  7516, 10803, 12062, 8190, 8885, 7040, 8180, 7745, 8879, 7046, 7756, 8736, 2254, 6458, 8139, 573,
+  9794, 65535, 9641, 65535, 5216, 65535, 5867, 65535, 5926, 65535, 7973, 65535, 10199, 65535, 10500, 65535,
+  9060, 7432, 5694, 3018, 4266, 4446, 2751, 5961, 7346, 1366, 0, 8712, 9590, 9372, 8432, 8060,
+  1962, 6750, 6479, 2921, 4366, 5034, 10065, 5436, 6717, 8784, 7944, 768, 9245, 65535, 4832, 65535,
+  5436, 65535, 9950, 65535, 5521, 3879, 11527, 6792, 7444, 8481, 7475, 8450, 65535, 10116, 65535, 10348,
+  65535, 5743, 65535, 6406, 65535, 6120, 65535, 8296, 65535, 10724, 65535, 11046,
+  // MR6
+  3240, 65535, 3829, 65535, 5230, 65535, 6523, 65535, 7088, 65535, 8245, 65535, 9082, 65535, 9583, 65535,
+  252, 65535, 1221, 65535, 1632, 65535, 2079, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  3552, 65535, 3399, 65535, 6754, 65535, 7405, 65535, 7464, 65535, 9511, 65535, 1487, 65535, 1788, 65535,
+  2818, 65535, 65535, 4556, 5804, 65535, 65535, 7499, 8884, 65535, 65535, 0, 878, 65535, 65535, 1818,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3003, 65535, 6370, 65535,
+  6974, 65535, 1238, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3874, 65535, 4106,
+  65535, 7281, 65535, 7944, 65535, 7658, 65535, 9834, 65535, 2012, 65535, 2334,
+  // BR7
+  2362, 65535, 2951, 65535, 4352, 65535, 5645, 65535, 6210, 65535, 7367, 65535, 8204, 65535, 8705, 65535,
+  9624, 65535, 343, 65535, 754, 65535, 1201, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  2674, 65535, 2521, 65535, 5876, 65535, 6527, 65535, 6586, 65535, 8633, 65535, 609, 65535, 910, 65535,
+  1940, 65535, 65535, 3678, 4926, 65535, 65535, 6621, 8006, 65535, 65535, 9372, 0, 65535, 65535, 940,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2125, 65535, 5492, 65535,
+  6096, 65535, 360, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2996, 65535, 3228,
+  65535, 6403, 65535, 7066, 65535, 6780, 65535, 8956, 65535, 1134, 65535, 1456,
+  // MR7
+  10360, 7888, 10949, 7299, 4570, 5898, 5863, 4605, 6428, 4040, 7585, 2883, 8422, 2046, 8923, 1545,
+  9842, 626, 10811, 9907, 11222, 9496, 9199, 9049, 3111, 8045, 4042, 7114, 4624, 6532, 5750, 11507,
+  6513, 10744, 7016, 10241, 8083, 9174, 1849, 8619, 2311, 8157, 5833, 5323, 6858, 4298, 7136, 12939,
+  8394, 11681, 12940, 9068, 9763, 7918, 9058, 8623, 9757, 7924, 8634, 9614, 3132, 7336, 9017, 1451,
+  10672, 65535, 10519, 65535, 6094, 65535, 6745, 65535, 6804, 65535, 8851, 65535, 11077, 65535, 11378, 65535,
+  9938, 8310, 6572, 3896, 5144, 5324, 3629, 6839, 8224, 2244, 878, 9590, 10468, 0, 9310, 8938,
+  2840, 7628, 7357, 3799, 5244, 5912, 10943, 6314, 7595, 9662, 8822, 1646, 10123, 65535, 5710, 65535,
+  6314, 65535, 10828, 65535, 6399, 4757, 12405, 7670, 8322, 9359, 8353, 9328, 65535, 10994, 65535, 11226,
+  65535, 6621, 65535, 7284, 65535, 6998, 65535, 9174, 65535, 11602, 65535, 11924,
+  // BR8
+  11300, 8828, 11889, 8239, 5510, 6838, 6803, 5545, 7368, 4980, 6055, 3823, 6892, 2986, 7393, 2485,
+  8312, 1566, 9281, 597, 9692, 186, 10139, 9989, 4051, 8985, 1824, 8054, 2406, 7472, 3532, 12447,
+  4295, 11684, 4798, 11181, 5865, 10114, 2789, 9559, 3251, 9097, 3615, 6263, 4640, 5238, 4918, 13879,
+  6176, 12621, 13880, 6850, 10703, 5700, 6840, 9563, 1014, 8864, 9574, 304, 4072, 8276, 9957, 2391,
+  11612, 65535, 11459, 65535, 7034, 65535, 7685, 65535, 7744, 65535, 7321, 65535, 9547, 65535, 9848, 65535,
+  10878, 9250, 7512, 4836, 6084, 6264, 4569, 5309, 6694, 3184, 1818, 8060, 8938, 940, 0, 9878,
+  3780, 8568, 8297, 1581, 3026, 6852, 11883, 4096, 5377, 10602, 9762, 2586, 11063, 65535, 6650, 65535,
+  7254, 65535, 9298, 65535, 4181, 5697, 13345, 5452, 6104, 10299, 9293, 585, 65535, 11934, 65535, 12166,
+  65535, 7561, 65535, 8224, 65535, 7938, 65535, 7644, 65535, 10072, 65535, 10394,
+  // MR8
+  1422, 65535, 2011, 65535, 3412, 65535, 4705, 65535, 5270, 65535, 6427, 65535, 7264, 65535, 7765, 65535,
+  8684, 65535, 9653, 65535, 10064, 65535, 261, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  1734, 65535, 1581, 65535, 4936, 65535, 5587, 65535, 5646, 65535, 7693, 65535, 9919, 65535, 10220, 65535,
+  1000, 65535, 65535, 2738, 3986, 65535, 65535, 5681, 7066, 65535, 65535, 8432, 9310, 65535, 65535, 0,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1185, 65535, 4552, 65535,
+  5156, 65535, 9670, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2056, 65535, 2288,
+  65535, 5463, 65535, 6126, 65535, 5840, 65535, 8016, 65535, 10444, 65535, 10766,
+  // BR9
+  9990, 65535, 10579, 65535, 1730, 65535, 3023, 65535, 3588, 65535, 4745, 65535, 5582, 65535, 6083, 65535,
+  7002, 65535, 7971, 65535, 8382, 65535, 8829, 65535, 271, 65535, 1202, 65535, 1784, 65535, 2910, 65535,
+  3673, 65535, 4176, 65535, 5243, 65535, 5798, 65535, 6260, 65535, 2993, 65535, 4018, 65535, 4296, 65535,
+  5554, 65535, 65535, 6228, 65535, 5078, 6218, 65535, 6917, 65535, 65535, 65535, 292, 65535, 65535, 65535,
+  10302, 65535, 10149, 65535, 3254, 65535, 3905, 65535, 3964, 65535, 6011, 65535, 8237, 65535, 8538, 65535,
+  9568, 65535, 65535, 1056, 2304, 65535, 65535, 3999, 5384, 65535, 65535, 6750, 7628, 65535, 65535, 8568,
+  0, 65535, 65535, 959, 2404, 65535, 65535, 3474, 4755, 65535, 65535, 5595, 9753, 65535, 2870, 65535,
+  3474, 65535, 7988, 65535, 3559, 65535, 65535, 4830, 5482, 65535, 65535, 6488, 65535, 10624, 65535, 10856,
+  65535, 3781, 65535, 4444, 65535, 4158, 65535, 6334, 65535, 8762, 65535, 9084,
+  // MR9
+  5202, 65535, 5791, 65535, 7192, 65535, 8485, 65535, 9050, 65535, 10207, 65535, 11044, 65535, 11545, 65535,
+  2214, 65535, 3183, 65535, 3594, 65535, 4041, 65535, 65535, 6518, 65535, 5587, 65535, 5005, 65535, 3879,
+  65535, 3116, 65535, 2613, 65535, 1546, 65535, 991, 65535, 529, 65535, 6614, 65535, 65535, 65535, 5311,
+  65535, 4053, 5312, 65535, 6462, 65535, 65535, 7096, 65535, 6397, 7107, 65535, 65535, 65535, 1389, 65535,
+  5514, 65535, 5361, 65535, 8716, 65535, 9367, 65535, 9426, 65535, 11473, 65535, 3449, 65535, 3750, 65535,
+  4780, 65535, 65535, 6518, 7766, 65535, 65535, 9461, 10846, 65535, 65535, 1962, 2840, 65535, 65535, 3780,
+  65535, 0, 5830, 65535, 65535, 4385, 3315, 65535, 65535, 2034, 1194, 65535, 4965, 65535, 8332, 65535,
+  8936, 65535, 3200, 65535, 65535, 6048, 4777, 65535, 65535, 6058, 6826, 65535, 65535, 5836, 65535, 6068,
+  65535, 9243, 65535, 9906, 65535, 9620, 65535, 11796, 65535, 3974, 65535, 4296,
+  // BR10
+  3003, 65535, 3592, 65535, 4993, 65535, 6286, 65535, 6851, 65535, 8008, 65535, 8845, 65535, 9346, 65535,
+  3173, 65535, 4142, 65535, 4553, 65535, 1842, 65535, 65535, 688, 65535, 6282, 65535, 5700, 65535, 4574,
+  65535, 3811, 65535, 3308, 65535, 2505, 65535, 1950, 65535, 1488, 65535, 7309, 65535, 65535, 65535, 6006,
+  65535, 4748, 6007, 65535, 2406, 65535, 65535, 1266, 65535, 567, 1277, 65535, 65535, 65535, 2348, 65535,
+  3315, 65535, 3162, 65535, 6517, 65535, 7168, 65535, 7227, 65535, 9274, 65535, 4408, 65535, 4709, 65535,
+  2581, 65535, 65535, 4319, 5567, 65535, 65535, 7262, 8647, 65535, 65535, 2921, 3799, 65535, 65535, 1581,
+  65535, 959, 0, 65535, 65535, 5080, 4010, 65535, 65535, 2729, 2153, 65535, 2766, 65535, 6133, 65535,
+  6737, 65535, 4159, 65535, 65535, 6743, 5472, 65535, 65535, 2002, 996, 65535, 65535, 3637, 65535, 3869,
+  65535, 7044, 65535, 7707, 65535, 7421, 65535, 9597, 65535, 4933, 65535, 5255,
+  // MR10
+  9719, 65535, 10308, 65535, 7560, 65535, 8853, 65535, 9418, 65535, 4474, 65535, 5311, 65535, 5812, 65535,
+  6731, 65535, 7700, 65535, 8111, 65535, 8558, 65535, 6101, 65535, 243, 65535, 825, 65535, 1951, 65535,
+  2714, 65535, 3217, 65535, 4284, 65535, 4839, 65535, 5301, 65535, 2034, 65535, 3059, 65535, 3337, 65535,
+  4595, 65535, 65535, 5269, 65535, 4119, 5259, 65535, 5958, 65535, 65535, 65535, 6122, 65535, 65535, 65535,
+  10031, 65535, 9878, 65535, 9084, 65535, 9735, 65535, 9794, 65535, 5740, 65535, 7966, 65535, 8267, 65535,
+  9297, 65535, 65535, 6886, 8134, 65535, 65535, 3728, 5113, 65535, 65535, 6479, 7357, 65535, 65535, 8297,
+  5830, 65535, 65535, 0, 1445, 65535, 65535, 2515, 3796, 65535, 65535, 4636, 9482, 65535, 8700, 65535,
+  9304, 65535, 7717, 65535, 2600, 65535, 65535, 3871, 4523, 65535, 65535, 5529, 65535, 10353, 65535, 10585,
+  65535, 9611, 65535, 10274, 65535, 9988, 65535, 6063, 65535, 8491, 65535, 8813,
+  // BR11
+  8274, 65535, 8863, 65535, 6115, 65535, 7408, 65535, 7973, 65535, 3029, 65535, 3866, 65535, 4367, 65535,
+  5286, 65535, 6255, 65535, 6666, 65535, 7113, 65535, 4656, 65535, 5323, 65535, 5905, 65535, 506, 65535,
+  1269, 65535, 1772, 65535, 2839, 65535, 3394, 65535, 3856, 65535, 589, 65535, 1614, 65535, 1892, 65535,
+  3150, 65535, 65535, 3824, 65535, 2674, 3814, 65535, 4513, 65535, 65535, 65535, 4677, 65535, 65535, 65535,
+  8586, 65535, 8433, 65535, 7639, 65535, 8290, 65535, 8349, 65535, 4295, 65535, 6521, 65535, 6822, 65535,
+  7852, 65535, 65535, 5441, 6689, 65535, 65535, 2283, 3668, 65535, 65535, 5034, 5912, 65535, 65535, 6852,
+  4385, 65535, 65535, 5080, 0, 65535, 65535, 1070, 2351, 65535, 65535, 3191, 8037, 65535, 7255, 65535,
+  7859, 65535, 6272, 65535, 1155, 65535, 65535, 2426, 3078, 65535, 65535, 4084, 65535, 8908, 65535, 9140,
+  65535, 8166, 65535, 8829, 65535, 8543, 65535, 4618, 65535, 7046, 65535, 7368,
+  // MR11
+  4448, 65535, 5037, 65535, 6438, 65535, 7731, 65535, 8296, 65535, 9453, 65535, 10290, 65535, 10791, 65535,
+  4618, 65535, 5587, 65535, 5998, 65535, 3287, 65535, 65535, 2133, 65535, 1202, 65535, 620, 65535, 6019,
+  65535, 5256, 65535, 4753, 65535, 3950, 65535, 3395, 65535, 2933, 65535, 8754, 65535, 65535, 65535, 7451,
+  65535, 6193, 7452, 65535, 3851, 65535, 65535, 2711, 65535, 2012, 2722, 65535, 65535, 65535, 3793, 65535,
+  4760, 65535, 4607, 65535, 7962, 65535, 8613, 65535, 8672, 65535, 10719, 65535, 5853, 65535, 6154, 65535,
+  4026, 65535, 65535, 5764, 7012, 65535, 65535, 8707, 10092, 65535, 65535, 4366, 5244, 65535, 65535, 3026,
+  65535, 2404, 1445, 65535, 65535, 0, 5455, 65535, 65535, 4174, 3598, 65535, 4211, 65535, 7578, 65535,
+  8182, 65535, 5604, 65535, 65535, 8188, 6917, 65535, 65535, 3447, 2441, 65535, 65535, 5082, 65535, 5314,
+  65535, 8489, 65535, 9152, 65535, 8866, 65535, 11042, 65535, 6378, 65535, 6700,
+  // BR12
+  5518, 65535, 6107, 65535, 7508, 65535, 8801, 65535, 9366, 65535, 10523, 65535, 11360, 65535, 11861, 65535,
+  5688, 65535, 6657, 65535, 7068, 65535, 4357, 65535, 65535, 3203, 65535, 2272, 65535, 1690, 65535, 564,
+  65535, 4552, 65535, 4049, 65535, 5020, 65535, 4465, 65535, 4003, 65535, 3299, 65535, 65535, 65535, 1996,
+  65535, 738, 1997, 65535, 3147, 65535, 65535, 3781, 65535, 3082, 3792, 65535, 65535, 65535, 4863, 65535,
+  5830, 65535, 5677, 65535, 9032, 65535, 9683, 65535, 9742, 65535, 11789, 65535, 6923, 65535, 7224, 65535,
+  5096, 65535, 65535, 6834, 8082, 65535, 65535, 9777, 11162, 65535, 65535, 5436, 6314, 65535, 65535, 4096,
+  65535, 3474, 2515, 65535, 65535, 1070, 0, 65535, 65535, 3470, 4668, 65535, 5281, 65535, 8648, 65535,
+  9252, 65535, 6674, 65535, 65535, 2733, 1462, 65535, 65535, 2743, 3511, 65535, 65535, 6152, 65535, 6384,
+  65535, 9559, 65535, 10222, 65535, 9936, 65535, 12112, 65535, 7448, 65535, 7770,
+  // MR12
+  13305, 65535, 13894, 65535, 5045, 65535, 6338, 65535, 6903, 65535, 8060, 65535, 8897, 65535, 9398, 65535,
+  10317, 65535, 11286, 65535, 11697, 65535, 12144, 65535, 3586, 65535, 4253, 65535, 4835, 65535, 5961, 65535,
+  199, 65535, 702, 65535, 1769, 65535, 2324, 65535, 2786, 65535, 6044, 65535, 7069, 65535, 7347, 65535,
+  4013, 65535, 65535, 2754, 65535, 1604, 2744, 65535, 3443, 65535, 65535, 65535, 3607, 65535, 65535, 65535,
+  13617, 65535, 13464, 65535, 6569, 65535, 7220, 65535, 7279, 65535, 9326, 65535, 11552, 65535, 11853, 65535,
+  12883, 65535, 65535, 4371, 5619, 65535, 65535, 7314, 8699, 65535, 65535, 10065, 10943, 65535, 65535, 11883,
+  3315, 65535, 65535, 4010, 5455, 65535, 65535, 0, 1281, 65535, 65535, 2121, 13068, 65535, 6185, 65535,
+  6789, 65535, 11303, 65535, 6610, 65535, 65535, 3289, 2008, 65535, 65535, 3014, 65535, 13939, 65535, 14171,
+  65535, 7096, 65535, 7759, 65535, 7473, 65535, 9649, 65535, 12077, 65535, 12399,
+  // BR13
+  12024, 65535, 12613, 65535, 3764, 65535, 5057, 65535, 5622, 65535, 6779, 65535, 7616, 65535, 8117, 65535,
+  9036, 65535, 10005, 65535, 10416, 65535, 10863, 65535, 2305, 65535, 2972, 65535, 3554, 65535, 4680, 65535,
+  3669, 65535, 4172, 65535, 488, 65535, 1043, 65535, 1505, 65535, 4763, 65535, 5788, 65535, 6066, 65535,
+  2732, 65535, 65535, 1473, 65535, 323, 1463, 65535, 2162, 65535, 65535, 65535, 2326, 65535, 65535, 65535,
+  12336, 65535, 12183, 65535, 5288, 65535, 5939, 65535, 5998, 65535, 8045, 65535, 10271, 65535, 10572, 65535,
+  11602, 65535, 65535, 3090, 4338, 65535, 65535, 6033, 7418, 65535, 65535, 8784, 9662, 65535, 65535, 10602,
+  2034, 65535, 65535, 2729, 4174, 65535, 65535, 3470, 0, 65535, 65535, 840, 11787, 65535, 4904, 65535,
+  5508, 65535, 10022, 65535, 5329, 65535, 65535, 2008, 727, 65535, 65535, 1733, 65535, 12658, 65535, 12890,
+  65535, 5815, 65535, 6478, 65535, 6192, 65535, 8368, 65535, 10796, 65535, 11118,
+  // MR13
+  6799, 65535, 7388, 65535, 8789, 65535, 10082, 65535, 10647, 65535, 11804, 65535, 12641, 65535, 13142, 65535,
+  6969, 65535, 7938, 65535, 8349, 65535, 5638, 65535, 65535, 4484, 65535, 3553, 65535, 2971, 65535, 1845,
+  65535, 1082, 65535, 579, 65535, 6301, 65535, 5746, 65535, 5284, 65535, 4580, 65535, 65535, 65535, 3277,
+  65535, 2019, 3278, 65535, 4428, 65535, 65535, 5062, 65535, 4363, 5073, 65535, 65535, 65535, 6144, 65535,
+  7111, 65535, 6958, 65535, 10313, 65535, 10964, 65535, 11023, 65535, 13070, 65535, 8204, 65535, 8505, 65535,
+  6377, 65535, 65535, 8115, 9363, 65535, 65535, 11058, 12443, 65535, 65535, 6717, 7595, 65535, 65535, 5377,
+  65535, 4755, 3796, 65535, 65535, 2351, 1281, 65535, 65535, 0, 5949, 65535, 6562, 65535, 9929, 65535,
+  10533, 65535, 7955, 65535, 65535, 4014, 2743, 65535, 65535, 4024, 4792, 65535, 65535, 7433, 65535, 7665,
+  65535, 10840, 65535, 11503, 65535, 11217, 65535, 13393, 65535, 8729, 65535, 9051,
+  // BR14
+  4008, 65535, 4597, 65535, 5998, 65535, 7291, 65535, 7856, 65535, 9013, 65535, 9850, 65535, 10351, 65535,
+  1020, 65535, 1989, 65535, 2400, 65535, 2847, 65535, 65535, 5324, 65535, 4393, 65535, 3811, 65535, 2685,
+  65535, 1922, 65535, 1419, 65535, 352, 65535, 6586, 65535, 6124, 65535, 5420, 65535, 65535, 65535, 4117,
+  65535, 2859, 4118, 65535, 5268, 65535, 65535, 5902, 65535, 5203, 5913, 65535, 65535, 65535, 195, 65535,
+  4320, 65535, 4167, 65535, 7522, 65535, 8173, 65535, 8232, 65535, 10279, 65535, 2255, 65535, 2556, 65535,
+  3586, 65535, 65535, 5324, 6572, 65535, 65535, 8267, 9652, 65535, 65535, 768, 1646, 65535, 65535, 2586,
+  65535, 5595, 4636, 65535, 65535, 3191, 2121, 65535, 65535, 840, 0, 65535, 3771, 65535, 7138, 65535,
+  7742, 65535, 2006, 65535, 65535, 4854, 3583, 65535, 65535, 4864, 5632, 65535, 65535, 4642, 65535, 4874,
+  65535, 8049, 65535, 8712, 65535, 8426, 65535, 10602, 65535, 2780, 65535, 3102,
+  // MR14
+  11184, 65535, 11773, 65535, 2924, 65535, 4217, 65535, 4782, 65535, 5939, 65535, 6776, 65535, 7277, 65535,
+  8196, 65535, 9165, 65535, 9576, 65535, 10023, 65535, 1465, 65535, 2396, 65535, 2978, 65535, 4104, 65535,
+  4867, 65535, 5370, 65535, 6437, 65535, 203, 65535, 665, 65535, 4187, 65535, 5212, 65535, 5490, 65535,
+  6748, 65535, 65535, 7422, 65535, 6272, 7412, 65535, 8111, 65535, 65535, 65535, 1486, 65535, 65535, 65535,
+  11496, 65535, 11343, 65535, 4448, 65535, 5099, 65535, 5158, 65535, 7205, 65535, 9431, 65535, 9732, 65535,
+  10762, 65535, 65535, 2250, 3498, 65535, 65535, 5193, 6578, 65535, 65535, 7944, 8822, 65535, 65535, 9762,
+  1194, 65535, 65535, 2153, 3598, 65535, 65535, 4668, 5949, 65535, 65535, 0, 10947, 65535, 4064, 65535,
+  4668, 65535, 9182, 65535, 4753, 65535, 65535, 6024, 6676, 65535, 65535, 7682, 65535, 11818, 65535, 12050,
+  65535, 4975, 65535, 5638, 65535, 5352, 65535, 7528, 65535, 9956, 65535, 10278,
+  // BR15
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  549, 65535, 396, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 871, 65535, 1103,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  // MR15
+  12485, 10013, 13074, 9424, 6695, 8023, 7988, 6730, 8553, 6165, 7240, 5008, 8077, 4171, 8578, 3670,
+  9497, 2751, 10466, 1782, 10877, 1371, 11324, 924, 5236, 10170, 3009, 9239, 3591, 8657, 4717, 13632,
+  5480, 12869, 5983, 12366, 7050, 11299, 3974, 10744, 4436, 10282, 4800, 7448, 5825, 6423, 6103, 15064,
+  7361, 13806, 15065, 8035, 11888, 6885, 8025, 10748, 2199, 10049, 10759, 1489, 5257, 9461, 11142, 3576,
+  12797, 65535, 12644, 65535, 8219, 65535, 8870, 65535, 8929, 65535, 8506, 65535, 10732, 65535, 11033, 65535,
+  12063, 185, 8697, 6021, 7269, 7449, 5754, 6494, 7879, 4369, 3003, 9245, 10123, 2125, 1185, 11063,
+  4965, 9753, 9482, 2766, 4211, 8037, 13068, 5281, 6562, 11787, 10947, 3771, 12248, 0, 7835, 65535,
+  8439, 65535, 10483, 65535, 5366, 6882, 14530, 6637, 7289, 11484, 10478, 1770, 65535, 13119, 65535, 13351,
+  65535, 8746, 65535, 9409, 65535, 9123, 65535, 8829, 65535, 11257, 65535, 11579,
+  // BR16
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 384, 65535, 1035, 65535, 1094, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 65535,
+  604, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 911, 65535, 1574, 65535, 1288, 65535, 65535, 65535, 65535, 65535, 65535,
+  // MR16
+  8072, 3130, 8661, 2541, 10062, 1140, 11355, 10097, 11920, 9532, 10607, 8375, 11444, 7538, 11945, 7037,
+  5084, 6118, 6053, 5149, 6464, 4738, 6911, 4291, 8603, 9388, 6376, 8457, 6958, 7875, 8084, 6749,
+  8847, 5986, 9350, 5483, 10417, 4416, 7341, 3861, 7803, 3399, 8167, 9484, 9192, 9790, 9470, 8181,
+  10728, 6923, 8182, 11402, 9332, 10252, 11392, 9966, 5566, 9267, 9977, 4856, 8624, 2578, 4259, 6943,
+  8384, 65535, 8231, 65535, 11586, 65535, 12237, 65535, 12296, 65535, 11873, 65535, 6319, 65535, 6620, 65535,
+  7650, 3552, 1814, 9388, 10636, 566, 9121, 9861, 11246, 7736, 6370, 4832, 5710, 5492, 4552, 6650,
+  8332, 2870, 8700, 6133, 7578, 7255, 6185, 8648, 9929, 4904, 4064, 7138, 7835, 65535, 11202, 0,
+  11806, 65535, 6070, 65535, 8733, 8918, 7647, 10004, 10656, 8928, 9696, 5137, 65535, 8706, 65535, 8938,
+  65535, 12113, 65535, 12776, 65535, 12490, 65535, 12196, 65535, 6844, 65535, 7166,
+  // BR17
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 431, 65535, 490, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  0, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 970, 65535, 684, 65535, 65535, 65535, 65535, 65535, 65535,
+  // MR17
+  8676, 3734, 9265, 3145, 10666, 1744, 11959, 10701, 12524, 10136, 11211, 8979, 12048, 8142, 12549, 7641,
+  5688, 6722, 6657, 5753, 7068, 5342, 7515, 4895, 9207, 9992, 6980, 9061, 7562, 8479, 8688, 7353,
+  9451, 6590, 9954, 6087, 11021, 5020, 7945, 4465, 8407, 4003, 8771, 10088, 9796, 10394, 10074, 8785,
+  11332, 7527, 8786, 12006, 9936, 10856, 11996, 10570, 6170, 9871, 10581, 5460, 9228, 3182, 4863, 7547,
+  8988, 65535, 8835, 65535, 12190, 65535, 12841, 65535, 12900, 65535, 12477, 65535, 6923, 65535, 7224, 65535,
+  8254, 4156, 2418, 9992, 11240, 1170, 9725, 10465, 11850, 8340, 6974, 5436, 6314, 6096, 5156, 7254,
+  8936, 3474, 9304, 6737, 8182, 7859, 6789, 9252, 10533, 5508, 4668, 7742, 8439, 65535, 11806, 604,
+  12410, 0, 6674, 65535, 9337, 9522, 8251, 10608, 11260, 9532, 10300, 5741, 65535, 9310, 65535, 9542,
+  65535, 12717, 65535, 13380, 65535, 13094, 65535, 12800, 65535, 7448, 65535, 7770,
+  // BR18
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 249, 65535, 550, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 0, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 774, 65535, 1096,
+  // MR18
+  10720, 8248, 11309, 7659, 4930, 6258, 6223, 4965, 6788, 4400, 7945, 3243, 8782, 2406, 9283, 1905,
+  10202, 986, 11171, 10267, 11582, 9856, 9559, 9409, 3471, 8405, 4402, 7474, 4984, 6892, 6110, 11867,
+  6873, 11104, 7376, 10601, 8443, 9534, 2209, 8979, 2671, 8517, 6193, 5683, 7218, 4658, 7496, 13299,
+  8754, 12041, 13300, 9428, 10123, 8278, 9418, 8983, 10117, 8284, 8994, 9974, 3492, 7696, 9377, 1811,
+  11032, 65535, 10879, 65535, 6454, 65535, 7105, 65535, 7164, 65535, 9211, 65535, 11437, 65535, 11738, 65535,
+  10298, 8670, 6932, 4256, 5504, 5684, 3989, 7199, 8584, 2604, 1238, 9950, 10828, 360, 9670, 9298,
+  3200, 7988, 7717, 4159, 5604, 6272, 11303, 6674, 7955, 10022, 9182, 2006, 10483, 65535, 6070, 65535,
+  6674, 65535, 11188, 0, 6759, 5117, 12765, 8030, 8682, 9719, 8713, 9688, 65535, 11354, 65535, 11586,
+  65535, 6981, 65535, 7644, 65535, 7358, 65535, 9534, 65535, 11962, 65535, 12284,
+  // BR153
+  7119, 65535, 7708, 65535, 7778, 65535, 9071, 65535, 9636, 65535, 1874, 65535, 2711, 65535, 3212, 65535,
+  4131, 65535, 5100, 65535, 5511, 65535, 5958, 65535, 6319, 65535, 6986, 65535, 7568, 65535, 8694, 65535,
+  2932, 65535, 3435, 65535, 4502, 65535, 5057, 65535, 5519, 65535, 8777, 65535, 459, 65535, 737, 65535,
+  1995, 65535, 65535, 5487, 65535, 4337, 5477, 65535, 6176, 65535, 65535, 65535, 6340, 65535, 65535, 65535,
+  7431, 65535, 7278, 65535, 9302, 65535, 9953, 65535, 10012, 65535, 3140, 65535, 5366, 65535, 5667, 65535,
+  6697, 65535, 65535, 7104, 8352, 65535, 65535, 1128, 2513, 65535, 65535, 3879, 4757, 65535, 65535, 5697,
+  6048, 65535, 65535, 6743, 8188, 65535, 65535, 2733, 4014, 65535, 65535, 4854, 6882, 65535, 8918, 65535,
+  9522, 65535, 5117, 65535, 0, 65535, 65535, 1271, 4741, 65535, 65535, 5747, 65535, 7753, 65535, 7985,
+  65535, 9829, 65535, 10492, 65535, 10206, 65535, 3463, 65535, 5891, 65535, 6213,
+  // MR153
+  5603, 65535, 6192, 65535, 7593, 65535, 8886, 65535, 9451, 65535, 10608, 65535, 11445, 65535, 11946, 65535,
+  5773, 65535, 6742, 65535, 7153, 65535, 4442, 65535, 65535, 3288, 65535, 2357, 65535, 1775, 65535, 7174,
+  65535, 6411, 65535, 5908, 65535, 5105, 65535, 4550, 65535, 4088, 65535, 566, 65535, 65535, 65535, 8606,
+  65535, 7348, 8607, 65535, 5006, 65535, 65535, 3866, 65535, 3167, 3877, 65535, 65535, 65535, 4948, 65535,
+  5915, 65535, 5762, 65535, 9117, 65535, 9768, 65535, 9827, 65535, 11874, 65535, 7008, 65535, 7309, 65535,
+  5181, 65535, 65535, 6919, 8167, 65535, 65535, 9862, 11247, 65535, 65535, 5521, 6399, 65535, 65535, 4181,
+  65535, 3559, 2600, 65535, 65535, 1155, 6610, 65535, 65535, 5329, 4753, 65535, 5366, 65535, 8733, 65535,
+  9337, 65535, 6759, 65535, 65535, 0, 8072, 65535, 65535, 4602, 3596, 65535, 65535, 6237, 65535, 6469,
+  65535, 9644, 65535, 10307, 65535, 10021, 65535, 12197, 65535, 7533, 65535, 7855,
+  // BR154
+  6874, 65535, 7463, 65535, 8864, 65535, 10157, 65535, 10722, 65535, 11879, 65535, 12716, 65535, 13217, 65535,
+  7044, 65535, 8013, 65535, 8424, 65535, 5713, 65535, 65535, 4559, 65535, 3628, 65535, 3046, 65535, 3853,
+  65535, 3090, 65535, 2587, 65535, 6376, 65535, 5821, 65535, 5359, 65535, 1837, 65535, 65535, 65535, 534,
+  65535, 4027, 535, 65535, 1685, 65535, 65535, 5137, 65535, 4438, 5148, 65535, 65535, 65535, 6219, 65535,
+  7186, 65535, 7033, 65535, 10388, 65535, 11039, 65535, 11098, 65535, 13145, 65535, 8279, 65535, 8580, 65535,
+  6452, 65535, 65535, 8190, 9438, 65535, 65535, 11133, 12518, 65535, 65535, 6792, 7670, 65535, 65535, 5452,
+  65535, 4830, 3871, 65535, 65535, 2426, 3289, 65535, 65535, 2008, 6024, 65535, 6637, 65535, 10004, 65535,
+  10608, 65535, 8030, 65535, 65535, 1271, 0, 65535, 65535, 1281, 4867, 65535, 65535, 7508, 65535, 7740,
+  65535, 10915, 65535, 11578, 65535, 11292, 65535, 13468, 65535, 8804, 65535, 9126,
+  // MR154
+  14767, 65535, 15356, 65535, 6507, 65535, 7800, 65535, 8365, 65535, 9522, 65535, 10359, 65535, 10860, 65535,
+  11779, 65535, 12748, 65535, 13159, 65535, 13606, 65535, 5048, 65535, 5715, 65535, 6297, 65535, 7423, 65535,
+  1661, 65535, 2164, 65535, 3231, 65535, 3786, 65535, 4248, 65535, 7506, 65535, 8531, 65535, 8809, 65535,
+  724, 65535, 65535, 4216, 65535, 3066, 4206, 65535, 4905, 65535, 65535, 65535, 5069, 65535, 65535, 65535,
+  15079, 65535, 14926, 65535, 8031, 65535, 8682, 65535, 8741, 65535, 10788, 65535, 13014, 65535, 13315, 65535,
+  14345, 65535, 65535, 5833, 7081, 65535, 65535, 8776, 10161, 65535, 65535, 11527, 12405, 65535, 65535, 13345,
+  4777, 65535, 65535, 5472, 6917, 65535, 65535, 1462, 2743, 65535, 65535, 3583, 14530, 65535, 7647, 65535,
+  8251, 65535, 12765, 65535, 8072, 65535, 65535, 0, 3470, 65535, 65535, 4476, 65535, 15401, 65535, 15633,
+  65535, 8558, 65535, 9221, 65535, 8935, 65535, 11111, 65535, 13539, 65535, 13861,
+  // BR155
+  11721, 65535, 12310, 65535, 7788, 65535, 9081, 65535, 9646, 65535, 6476, 65535, 7313, 65535, 7814, 65535,
+  8733, 65535, 9702, 65535, 10113, 65535, 10560, 65535, 6329, 65535, 2245, 65535, 2827, 65535, 3953, 65535,
+  2942, 65535, 3445, 65535, 4512, 65535, 5067, 65535, 5529, 65535, 4036, 65535, 5061, 65535, 5339, 65535,
+  2005, 65535, 65535, 746, 65535, 4347, 736, 65535, 1435, 65535, 65535, 65535, 6350, 65535, 65535, 65535,
+  12033, 65535, 11880, 65535, 9312, 65535, 9963, 65535, 10022, 65535, 7742, 65535, 9968, 65535, 10269, 65535,
+  11299, 65535, 65535, 7114, 8362, 65535, 65535, 5730, 7115, 65535, 65535, 8481, 9359, 65535, 65535, 10299,
+  6058, 65535, 65535, 2002, 3447, 65535, 65535, 2743, 4024, 65535, 65535, 4864, 11484, 65535, 8928, 65535,
+  9532, 65535, 9719, 65535, 4602, 65535, 65535, 1281, 0, 65535, 65535, 1006, 65535, 12355, 65535, 12587,
+  65535, 9839, 65535, 10502, 65535, 10216, 65535, 8065, 65535, 10493, 65535, 10815,
+  // MR155
+  7526, 65535, 8115, 65535, 9516, 65535, 10809, 65535, 11374, 65535, 12531, 65535, 13368, 65535, 13869, 65535,
+  7696, 65535, 8665, 65535, 9076, 65535, 6365, 65535, 65535, 5211, 65535, 4280, 65535, 3698, 65535, 2572,
+  65535, 1809, 65535, 1306, 65535, 7028, 65535, 6473, 65535, 6011, 65535, 5307, 65535, 65535, 65535, 4004,
+  65535, 2746, 4005, 65535, 404, 65535, 65535, 5789, 65535, 5090, 5800, 65535, 65535, 65535, 6871, 65535,
+  7838, 65535, 7685, 65535, 11040, 65535, 11691, 65535, 11750, 65535, 13797, 65535, 8931, 65535, 9232, 65535,
+  7104, 65535, 65535, 8842, 10090, 65535, 65535, 11785, 13170, 65535, 65535, 7444, 8322, 65535, 65535, 6104,
+  65535, 5482, 4523, 65535, 65535, 3078, 2008, 65535, 65535, 727, 6676, 65535, 7289, 65535, 10656, 65535,
+  11260, 65535, 8682, 65535, 65535, 4741, 3470, 65535, 65535, 0, 5519, 65535, 65535, 8160, 65535, 8392,
+  65535, 11567, 65535, 12230, 65535, 11944, 65535, 14120, 65535, 9456, 65535, 9778,
+  // BR156
+  2007, 65535, 2596, 65535, 3997, 65535, 5290, 65535, 5855, 65535, 7012, 65535, 7849, 65535, 8350, 65535,
+  8702, 65535, 9671, 65535, 10082, 65535, 846, 65535, 65535, 6217, 65535, 5286, 65535, 4704, 65535, 3578,
+  65535, 2815, 65535, 2312, 65535, 8034, 65535, 7479, 65535, 7017, 65535, 6313, 65535, 65535, 65535, 5010,
+  65535, 3752, 5011, 65535, 1410, 65535, 65535, 270, 65535, 6096, 281, 65535, 65535, 65535, 7877, 65535,
+  2319, 65535, 2166, 65535, 5521, 65535, 6172, 65535, 6231, 65535, 8278, 65535, 9937, 65535, 10238, 65535,
+  1585, 65535, 65535, 3323, 4571, 65535, 65535, 6266, 7651, 65535, 65535, 8450, 9328, 65535, 65535, 585,
+  65535, 6488, 5529, 65535, 65535, 4084, 3014, 65535, 65535, 1733, 7682, 65535, 1770, 65535, 5137, 65535,
+  5741, 65535, 9688, 65535, 65535, 5747, 4476, 65535, 65535, 1006, 0, 65535, 65535, 2641, 65535, 2873,
+  65535, 6048, 65535, 6711, 65535, 6425, 65535, 8601, 65535, 10462, 65535, 10784,
+  // MR156
+  10715, 65535, 11304, 65535, 8556, 65535, 9849, 65535, 10414, 65535, 5470, 65535, 6307, 65535, 6808, 65535,
+  7727, 65535, 8696, 65535, 9107, 65535, 9554, 65535, 7097, 65535, 1239, 65535, 1821, 65535, 2947, 65535,
+  3710, 65535, 4213, 65535, 5280, 65535, 5835, 65535, 6297, 65535, 3030, 65535, 4055, 65535, 4333, 65535,
+  5591, 65535, 65535, 6265, 65535, 5115, 6255, 65535, 429, 65535, 65535, 65535, 7118, 65535, 65535, 65535,
+  11027, 65535, 10874, 65535, 10080, 65535, 10731, 65535, 10790, 65535, 6736, 65535, 8962, 65535, 9263, 65535,
+  10293, 65535, 65535, 7882, 9130, 65535, 65535, 4724, 6109, 65535, 65535, 7475, 8353, 65535, 65535, 9293,
+  6826, 65535, 65535, 996, 2441, 65535, 65535, 3511, 4792, 65535, 65535, 5632, 10478, 65535, 9696, 65535,
+  10300, 65535, 8713, 65535, 3596, 65535, 65535, 4867, 5519, 65535, 65535, 0, 65535, 11349, 65535, 11581,
+  65535, 10607, 65535, 11270, 65535, 10984, 65535, 7059, 65535, 9487, 65535, 9809,
+  // EN1
+  13356, 10884, 13945, 10295, 7566, 8894, 8859, 7601, 9424, 7036, 8111, 5879, 8948, 5042, 9449, 4541,
+  10368, 3622, 11337, 2653, 11748, 2242, 12195, 1795, 6107, 11041, 3880, 10110, 4462, 9528, 5588, 14503,
+  6351, 13740, 6854, 13237, 7921, 12170, 4845, 11615, 5307, 11153, 5671, 8319, 6696, 7294, 6974, 15935,
+  8232, 14677, 15936, 8906, 12759, 7756, 8896, 11619, 3070, 10920, 11630, 2360, 6128, 10332, 12013, 4447,
+  13668, 322, 13515, 65535, 9090, 65535, 9741, 65535, 9800, 65535, 9377, 65535, 11603, 65535, 11904, 65535,
+  12934, 1056, 9568, 6892, 8140, 8320, 6625, 7365, 8750, 5240, 3874, 10116, 10994, 2996, 2056, 11934,
+  5836, 10624, 10353, 3637, 5082, 8908, 13939, 6152, 7433, 12658, 11818, 4642, 13119, 871, 8706, 65535,
+  9310, 65535, 11354, 65535, 6237, 7753, 15401, 7508, 8160, 12355, 11349, 2641, 0, 13990, 65535, 14222,
+  65535, 9617, 65535, 10280, 65535, 9994, 65535, 9700, 65535, 12128, 65535, 12450,
+  // EX1
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  // EN2
+  13588, 11116, 14177, 10527, 7798, 9126, 9091, 7833, 9656, 7268, 8343, 6111, 9180, 5274, 9681, 4773,
+  10600, 3854, 11569, 2885, 11980, 2474, 12427, 2027, 6339, 11273, 4112, 10342, 4694, 9760, 5820, 14735,
+  6583, 13972, 7086, 13469, 8153, 12402, 5077, 11847, 5539, 11385, 5903, 8551, 6928, 7526, 7206, 16167,
+  8464, 14909, 16168, 9138, 12991, 7988, 9128, 11851, 3302, 11152, 11862, 2592, 6360, 10564, 12245, 4679,
+  13900, 65535, 13747, 707, 9322, 65535, 9973, 65535, 10032, 65535, 9609, 65535, 11835, 65535, 12136, 65535,
+  13166, 1288, 9800, 7124, 8372, 8552, 6857, 7597, 8982, 5472, 4106, 10348, 11226, 3228, 2288, 12166,
+  6068, 10856, 10585, 3869, 5314, 9140, 14171, 6384, 7665, 12890, 12050, 4874, 13351, 1103, 8938, 65535,
+  9542, 65535, 11586, 65535, 6469, 7985, 15633, 7740, 8392, 12587, 11581, 2873, 65535, 14222, 0, 14454,
+  65535, 9849, 65535, 10512, 65535, 10226, 65535, 9932, 65535, 12360, 65535, 12682,
+  // EX2
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  // EN3
+  8983, 4041, 9572, 3452, 10973, 2051, 12266, 11008, 12831, 10443, 11518, 9286, 12355, 8449, 12856, 7948,
+  5995, 7029, 6964, 6060, 7375, 5649, 7822, 5202, 9514, 10299, 7287, 9368, 7869, 8786, 8995, 7660,
+  9758, 6897, 10261, 6394, 11328, 5327, 8252, 4772, 8714, 4310, 9078, 10395, 10103, 10701, 10381, 9092,
+  11639, 7834, 9093, 12313, 10243, 11163, 12303, 10877, 6477, 10178, 10888, 5767, 9535, 3489, 5170, 7854,
+  9295, 65535, 9142, 65535, 12497, 527, 13148, 65535, 13207, 65535, 12784, 65535, 7230, 65535, 7531, 65535,
+  8561, 4463, 2725, 10299, 11547, 1477, 10032, 10772, 12157, 8647, 7281, 5743, 6621, 6403, 5463, 7561,
+  9243, 3781, 9611, 7044, 8489, 8166, 7096, 9559, 10840, 5815, 4975, 8049, 8746, 65535, 12113, 911,
+  12717, 65535, 6981, 65535, 9644, 9829, 8558, 10915, 11567, 9839, 10607, 6048, 65535, 9617, 65535, 9849,
+  0, 13024, 65535, 13687, 65535, 13401, 65535, 13107, 65535, 7755, 65535, 8077,
+  // EX3
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 0, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  // EN4
+  9646, 4704, 10235, 4115, 11636, 2714, 12929, 11671, 13494, 11106, 12181, 9949, 13018, 9112, 13519, 8611,
+  6658, 7692, 7627, 6723, 8038, 6312, 8485, 5865, 10177, 10962, 7950, 10031, 8532, 9449, 9658, 8323,
+  10421, 7560, 10924, 7057, 11991, 5990, 8915, 5435, 9377, 4973, 9741, 11058, 10766, 11364, 11044, 9755,
+  12302, 8497, 9756, 12976, 10906, 11826, 12966, 11540, 7140, 10841, 11551, 6430, 10198, 4152, 5833, 8517,
+  9958, 65535, 9805, 65535, 13160, 65535, 13811, 539, 13870, 65535, 13447, 65535, 7893, 65535, 8194, 65535,
+  9224, 5126, 3388, 10962, 12210, 2140, 10695, 11435, 12820, 9310, 7944, 6406, 7284, 7066, 6126, 8224,
+  9906, 4444, 10274, 7707, 9152, 8829, 7759, 10222, 11503, 6478, 5638, 8712, 9409, 65535, 12776, 1574,
+  13380, 970, 7644, 65535, 10307, 10492, 9221, 11578, 12230, 10502, 11270, 6711, 65535, 10280, 65535, 10512,
+  65535, 13687, 0, 14350, 65535, 14064, 65535, 13770, 65535, 8418, 65535, 8740,
+  // EX4
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 0, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  // EN5
+  9360, 4418, 9949, 3829, 11350, 2428, 12643, 11385, 13208, 10820, 11895, 9663, 12732, 8826, 13233, 8325,
+  6372, 7406, 7341, 6437, 7752, 6026, 8199, 5579, 9891, 10676, 7664, 9745, 8246, 9163, 9372, 8037,
+  10135, 7274, 10638, 6771, 11705, 5704, 8629, 5149, 9091, 4687, 9455, 10772, 10480, 11078, 10758, 9469,
+  12016, 8211, 9470, 12690, 10620, 11540, 12680, 11254, 6854, 10555, 11265, 6144, 9912, 3866, 5547, 8231,
+  9672, 65535, 9519, 65535, 12874, 65535, 13525, 65535, 13584, 194, 13161, 65535, 7607, 65535, 7908, 65535,
+  8938, 4840, 3102, 10676, 11924, 1854, 10409, 11149, 12534, 9024, 7658, 6120, 6998, 6780, 5840, 7938,
+  9620, 4158, 9988, 7421, 8866, 8543, 7473, 9936, 11217, 6192, 5352, 8426, 9123, 65535, 12490, 1288,
+  13094, 684, 7358, 65535, 10021, 10206, 8935, 11292, 11944, 10216, 10984, 6425, 65535, 9994, 65535, 10226,
+  65535, 13401, 65535, 14064, 0, 13778, 65535, 13484, 65535, 8132, 65535, 8454,
+  // EX5
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 0, 65535, 65535, 65535, 65535, 65535, 65535,
+  // EN6
+  9066, 6594, 9655, 6005, 11056, 4604, 12349, 3311, 12914, 2746, 14071, 1589, 14908, 11002, 15409, 10501,
+  8548, 9582, 9517, 8613, 9928, 8202, 7905, 7755, 12067, 6751, 9840, 5820, 10422, 5238, 11548, 10213,
+  12311, 9450, 12814, 8947, 13881, 7880, 10805, 7325, 11267, 6863, 11631, 4029, 12656, 3004, 12934, 11645,
+  14192, 10387, 11646, 14866, 8469, 13716, 14856, 7329, 9030, 6630, 7340, 8320, 12088, 6042, 7723, 10407,
+  9378, 65535, 9225, 65535, 12580, 65535, 13231, 65535, 13290, 65535, 15337, 323, 9783, 65535, 10084, 65535,
+  8644, 7016, 5278, 10382, 11630, 4030, 2335, 13325, 14710, 950, 9834, 8296, 9174, 8956, 8016, 7644,
+  11796, 6334, 6063, 9597, 11042, 4618, 9649, 12112, 13393, 8368, 7528, 10602, 8829, 65535, 12196, 65535,
+  12800, 65535, 9534, 65535, 12197, 3463, 11111, 13468, 14120, 8065, 7059, 8601, 65535, 9700, 65535, 9932,
+  65535, 13107, 65535, 13770, 65535, 13484, 0, 15660, 65535, 10308, 65535, 10630,
+  // EX6
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 65535, 65535, 65535, 65535,
+  // EN7
+  11494, 9022, 12083, 8433, 5704, 7032, 6997, 5739, 7562, 5174, 8719, 4017, 9556, 3180, 10057, 2679,
+  10976, 1760, 11945, 11041, 12356, 10630, 10333, 10183, 4245, 9179, 5176, 8248, 5758, 7666, 6884, 12641,
+  7647, 11878, 8150, 11375, 9217, 10308, 2983, 9753, 3445, 9291, 6967, 6457, 7992, 5432, 8270, 14073,
+  9528, 12815, 14074, 10202, 10897, 9052, 10192, 9757, 10891, 9058, 9768, 10748, 4266, 8470, 10151, 2585,
+  11806, 65535, 11653, 65535, 7228, 65535, 7879, 65535, 7938, 65535, 9985, 65535, 12211, 525, 12512, 65535,
+  11072, 9444, 7706, 5030, 6278, 6458, 4763, 7973, 9358, 3378, 2012, 10724, 11602, 1134, 10444, 10072,
+  3974, 8762, 8491, 4933, 6378, 7046, 12077, 7448, 8729, 10796, 9956, 2780, 11257, 65535, 6844, 65535,
+  7448, 65535, 11962, 774, 7533, 5891, 13539, 8804, 9456, 10493, 9487, 10462, 65535, 12128, 65535, 12360,
+  65535, 7755, 65535, 8418, 65535, 8132, 65535, 10308, 0, 12736, 65535, 13058,
+  // EX7
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 65535, 65535,
+  // EN8
+  11816, 9344, 12405, 8755, 6026, 7354, 7319, 6061, 7884, 5496, 9041, 4339, 9878, 3502, 10379, 3001,
+  11298, 2082, 12267, 11363, 12678, 10952, 10655, 10505, 4567, 9501, 5498, 8570, 6080, 7988, 7206, 12963,
+  7969, 12200, 8472, 11697, 9539, 10630, 3305, 10075, 3767, 9613, 7289, 6779, 8314, 5754, 8592, 14395,
+  9850, 13137, 14396, 10524, 11219, 9374, 10514, 10079, 11213, 9380, 10090, 11070, 4588, 8792, 10473, 2907,
+  12128, 65535, 11975, 65535, 7550, 65535, 8201, 65535, 8260, 65535, 10307, 65535, 12533, 65535, 12834, 546,
+  11394, 9766, 8028, 5352, 6600, 6780, 5085, 8295, 9680, 3700, 2334, 11046, 11924, 1456, 10766, 10394,
+  4296, 9084, 8813, 5255, 6700, 7368, 12399, 7770, 9051, 11118, 10278, 3102, 11579, 65535, 7166, 65535,
+  7770, 65535, 12284, 1096, 7855, 6213, 13861, 9126, 9778, 10815, 9809, 10784, 65535, 12450, 65535, 12682,
+  65535, 8077, 65535, 8740, 65535, 8454, 65535, 10630, 65535, 13058, 0, 13380,
+  // EX8
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0,
+};
+
+const track_t TRACKS[] = {
+  {
+    'A', 144,
+    TRACKA_NODE_TYPE, TRACKA_NODE_NUM, TRACKA_EDGE, TRACKA_EDGE_DIST,
+    TRACKA_NEXT_DIR, TRACKA_DIST,
+    TRACKA_SENSOR_LINK_BEGIN, TRACKA_SENSOR_LINKS,
+  },
+  {
+    'B', 140,
+    TRACKB_NODE_TYPE, TRACKB_NODE_NUM, TRACKB_EDGE, TRACKB_EDGE_DIST,
+    TRACKB_NEXT_DIR, TRACKB_DIST,
+    TRACKB_SENSOR_LINK_BEGIN, TRACKB_SENSOR_LINKS,
+  },
+};
+
+const size_t TRACK_COUNT = 2;
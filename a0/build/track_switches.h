@@ -0,0 +1,6 @@
+// generated by tools/trackgen.c, do not edit
+
+#pragma once
+
+// distinct switch ids over all layouts
+#define SWITCH_COUNT 22
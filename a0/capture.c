@@ -0,0 +1,94 @@
+#include "capture.h"
+#include "rpi.h"
+#include "util.h"
+
+#define ASSERT(x)  // TODO
+
+capture_t capture;
+
+// little endian, whatever the host is
+static void put_word(unsigned char *out, unsigned v) {
+  out[0] = v;
+  out[1] = v >> 8;
+  out[2] = v >> 16;
+  out[3] = v >> 24;
+}
+
+static unsigned get_word(const unsigned char *p) {
+  return p[0] | p[1] << 8 | p[2] << 16 | (unsigned)p[3] << 24;
+}
+
+void capture_start(void) {
+  capture.len = 0;
+  capture.last = CAPTURE_SIZE;
+  capture.full = 0;
+  capture.on = 1;
+}
+
+void capture_stop(void) {
+  capture.on = 0;
+}
+
+void capture_record(unsigned char kind, const char *buf, size_t len) {
+  ASSERT(buf);
+  unsigned now = timer_now();
+  // only the count of what goes to the screen is kept
+  int counted = kind == CAPTURE_KIND(0, CAPTURE_OUT);
+  while (len) {
+    unsigned char *last = capture.last < capture.len ? capture.data + capture.last : 0;
+    int append = last && last[4] == kind && last[5] < 255 && now - get_word(last) < CAPTURE_MERGE_US;
+    size_t n = append ? 255 - last[5] : 255;
+    n = len < n ? len : n;
+    size_t need = (append ? 0 : CAPTURE_HEADER_BYTES) + (counted ? 0 : n);
+    if (capture.len + need > CAPTURE_SIZE) {
+      capture.on = 0;
+      capture.full = 1;
+      return;
+    }
+    if (!append) {
+      capture.last = capture.len;
+      last = capture.data + capture.len;
+      put_word(last, now);
+      last[4] = kind;
+      last[5] = 0;
+      capture.len += CAPTURE_HEADER_BYTES;
+    }
+    if (!counted) {
+      memcpy(capture.data + capture.len, buf, n);
+      capture.len += n;
+    }
+    last[5] += n;
+    buf += n;
+    len -= n;
+  }
+}
+
+void capture_dump_begin(void) {
+  capture.on = 0;
+  capture.dump_sum = 0;
+  for (size_t i = 0; i < capture.len; ++i) {
+    capture.dump_sum += capture.data[i];
+  }
+}
+
+static char frame_byte(size_t pos) {
+  unsigned char word[4];
+  if (pos < 8) {
+    put_word(word, pos < 4 ? 0x31504143 : capture.len);  // "CAP1"
+    return word[pos % 4];
+  } else if (pos < 8 + capture.len) {
+    return capture.data[pos - 8];
+  }
+  put_word(word, capture.dump_sum);
+  return word[(pos - 8 - capture.len) % 4];
+}
+
+size_t capture_dump_read(size_t pos, char *out, size_t max) {
+  ASSERT(out);
+  size_t end = CAPTURE_FRAME_BYTES;
+  size_t n = 0;
+  for (; pos < end && n < max; ++pos, ++n) {
+    out[n] = frame_byte(pos);
+  }
+  return n;
+}
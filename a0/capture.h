@@ -0,0 +1,58 @@
+#pragma once
+
+#include <stddef.h>
+
+#define CAPTURE_SIZE (1 << 20)  // bytes of records
+#define CAPTURE_MERGE_US 1000  // input bytes this close to the start of a record join it
+
+// record kinds: uart channel << 1 | direction
+#define CAPTURE_IN 0
+#define CAPTURE_OUT 1
+#define CAPTURE_KIND(channel, dir) ((channel) << 1 | (dir))
+#define CAPTURE_HEADER_BYTES 6  // time, kind, length
+
+/**
+ * Record of the bytes crossing the uart_* functions, for replaying a session on the host (see
+ * testing/replay.c).
+ *
+ * A record is a little endian system timer time (us), a kind byte, a length byte and then the
+ * bytes. Bytes written to the terminal are counted but not kept, since they are most of the
+ * traffic and replay only compares how much there was. Input bytes that follow each other
+ * closely share one record. Recording stops when the buffer is full.
+ *
+ * A dump is a frame of "CAP1", the little endian byte count of the records, the records, and the
+ * sum of their bytes.
+ */
+typedef struct {
+  unsigned char data[CAPTURE_SIZE];
+  size_t len;
+  size_t last;  // offset of the last record, to append to it
+  char on;
+  char full;
+  // state of the dump in progress
+  unsigned dump_sum;
+} capture_t;
+
+extern capture_t capture;
+
+// records at timer_now()
+void capture_record(unsigned char kind, const char *buf, size_t len);
+
+static inline void capture_bytes(unsigned char kind, const char *buf, size_t len) {
+  if (capture.on && len) {
+    capture_record(kind, buf, len);
+  }
+}
+
+// clears the buffer and starts recording
+void capture_start(void);
+void capture_stop(void);
+
+#define CAPTURE_FRAME_BYTES (8 + capture.len + 4)
+
+// stops recording, and sums the records for capture_dump_read
+void capture_dump_begin(void);
+
+// copies up to max bytes of the dump frame, starting at byte pos, to out; returns how many were
+// copied, 0 at the end of the frame
+size_t capture_dump_read(size_t pos, char *out, size_t max);
@@ -0,0 +1,292 @@
+#include "command.h"
+#include "rpi.h"
+#include "section.h"
+#include "track.h"
+#include "train.h"
+
+#define ASSERT(x)  // TODO
+
+static int isnum(char c) {
+  return c >= '0' && c <= '9';
+}
+
+// what an argument can be; numbers are at most max_digits long
+enum { ARG_NONE, ARG_NUM, ARG_SENSOR, ARG_LETTER };
+
+typedef struct {
+  char name[6];
+  unsigned char kind;
+  unsigned char args[2];
+  unsigned char max_digits;
+  unsigned char train_bytes;  // put in the train queue when it runs, see cmd_train_bytes
+} command_syntax_t;
+
+// "track" comes before "tr", so that a complete "tr" is only taken once the word ends
+static const command_syntax_t COMMANDS[] = {
+  {"track", TRAIN_COMMAND_TRACK, {ARG_LETTER, ARG_NONE}, 0, 0},
+  {"tr", TRAIN_COMMAND_TR, {ARG_NUM, ARG_NUM}, 2, 2},
+  {"rv", TRAIN_COMMAND_RV, {ARG_NUM, ARG_NONE}, 2, 2},
+  {"sw", TRAIN_COMMAND_SW, {ARG_NUM, ARG_LETTER}, 3, 2},
+  {"route", TRAIN_COMMAND_ROUTE, {ARG_SENSOR, ARG_SENSOR}, 2, 0},
+  {"perf", TRAIN_COMMAND_PERF, {ARG_LETTER, ARG_NONE}, 0, 0},
+  {"prof", TRAIN_COMMAND_PROF, {ARG_LETTER, ARG_NONE}, 0, 0},
+  {"trace", TRAIN_COMMAND_TRACE, {ARG_LETTER, ARG_NONE}, 0, 0},
+  {"cap", TRAIN_COMMAND_CAPTURE, {ARG_LETTER, ARG_NONE}, 0, 0},
+  {"log", TRAIN_COMMAND_LOG, {ARG_LETTER, ARG_NONE}, 0, 0},
+  {"baud", TRAIN_COMMAND_BAUD, {ARG_NUM, ARG_NONE}, 6, 0},
+  {"bench", TRAIN_COMMAND_BENCH, {ARG_NONE, ARG_NONE}, 0, 0},
+  {"q", TRAIN_COMMAND_Q, {ARG_NONE, ARG_NONE}, 0, 0},
+};
+static const size_t COMMAND_COUNT = sizeof COMMANDS / sizeof(COMMANDS[0]);
+
+enum { PARSE_WORD, PARSE_SPACE, PARSE_ARG, PARSE_ERROR };
+
+static void parser_next_command(cmd_parser_t *p) {
+  p->state = PARSE_WORD;
+  p->syntax = COMMAND_COUNT;
+  p->arg = p->tok_len = 0;
+  p->tok_value = 0;
+  p->cur.kind = TRAIN_COMMAND_INVALID;
+}
+
+void cmd_parser_init(cmd_parser_t *p) {
+  ASSERT(p);
+  p->count = 0;
+  parser_next_command(p);
+}
+
+static int parse_error(cmd_parser_t *p) {
+  p->state = PARSE_ERROR;
+  return 0;
+}
+
+static int same_start(const char *a, const char *b, size_t len) {
+  for (size_t i = 0; i < len; ++i) {
+    if (a[i] != b[i]) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+// the word typed so far is the start of a command name
+static int word_prefix(cmd_parser_t *p, char c) {
+  for (size_t i = 0; i < COMMAND_COUNT; ++i) {
+    if (p->tok_len < 5 && COMMANDS[i].name[p->tok_len] == c
+        && same_start(COMMANDS[i].name, p->word, p->tok_len)) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static int end_word(cmd_parser_t *p) {
+  for (size_t i = 0; i < COMMAND_COUNT; ++i) {
+    if (COMMANDS[i].name[p->tok_len] == '\0' && same_start(COMMANDS[i].name, p->word, p->tok_len)) {
+      p->syntax = i;
+      p->tok_len = 0;
+      p->state = PARSE_SPACE;
+      return 1;
+    }
+  }
+  return parse_error(p);
+}
+
+// stores the finished argument token in cur
+static int end_arg(cmd_parser_t *p) {
+  const command_syntax_t *s = &COMMANDS[p->syntax];
+  unsigned v = p->tok_value;
+  train_command_t *c = &p->cur;
+  int ok = 1;
+  switch (s->args[p->arg]) {
+  case ARG_NUM:
+    ok = p->tok_len > 0;
+    break;
+  case ARG_SENSOR:
+    ok = p->tok_len > 1 && v >= 1 && v <= 16;
+    v = (p->tok_letter - 'A') * 16 + v - 1;
+    break;
+  case ARG_LETTER:
+    ok = p->tok_len == 1;
+    break;
+  }
+  switch (s->kind * 2 + p->arg) {
+  case TRAIN_COMMAND_TR * 2:
+    ok = ok && v >= 1 && v <= TRAIN_MAX;
+    c->cmd.tr.train_num = v;
+    break;
+  case TRAIN_COMMAND_TR * 2 + 1:
+    ok = ok && (v <= 14 || (v >= 16 && v <= 30));
+    c->cmd.tr.speed = v;
+    break;
+  case TRAIN_COMMAND_RV * 2:
+    ok = ok && v >= 1 && v <= TRAIN_MAX;
+    c->cmd.rv.train_num = v;
+    break;
+  case TRAIN_COMMAND_SW * 2:
+    ok = ok && v <= 255 && SWITCH_INDEX[v] != TRACK_NONE;
+    c->cmd.sw.switch_num = v;
+    break;
+  case TRAIN_COMMAND_SW * 2 + 1:
+    ok = ok && (v == 'S' || v == 'C');
+    c->cmd.sw.straight = v == 'S';
+    break;
+  case TRAIN_COMMAND_ROUTE * 2:
+    c->cmd.route.from = v;
+    break;
+  case TRAIN_COMMAND_ROUTE * 2 + 1:
+    c->cmd.route.to = v;
+    break;
+  case TRAIN_COMMAND_TRACK * 2:
+    ok = ok && v >= 'A' && v <= 'Z';
+    c->cmd.track.name = v;
+    break;
+  case TRAIN_COMMAND_PERF * 2:
+    ok = ok && (v == 'w' || v == 'a');
+    c->cmd.perf.windowed = v == 'w';
+    break;
+  case TRAIN_COMMAND_PROF * 2:
+    ok = ok && (v == 's' || v == 'h' || v == 'r');
+    c->cmd.prof.action = v;
+    break;
+  case TRAIN_COMMAND_TRACE * 2:
+    ok = ok && (v == 'd' || v == 's');
+    c->cmd.trace.action = v;
+    break;
+  case TRAIN_COMMAND_CAPTURE * 2:
+    ok = ok && (v == 's' || v == 'd');
+    c->cmd.capture.action = v;
+    break;
+  case TRAIN_COMMAND_LOG * 2:
+    ok = ok && (v == 'd' || v == 'i' || v == 'w' || v == 'e');
+    c->cmd.log.level = v;
+    break;
+  case TRAIN_COMMAND_BAUD * 2:
+    ok = ok && uart_baud_divisor(v);
+    c->cmd.baud.rate = v;
+    break;
+  }
+  if (!ok) {
+    return parse_error(p);
+  }
+  ++p->arg;
+  p->tok_len = 0;
+  p->tok_value = 0;
+  p->state = PARSE_SPACE;
+  return 1;
+}
+
+static int end_command(cmd_parser_t *p) {
+  if (p->state == PARSE_WORD && p->tok_len == 0) {
+    return 1;  // empty, e.g. nothing typed yet or after a trailing ;
+  }
+  if ((p->state == PARSE_WORD && !end_word(p)) || (p->state == PARSE_ARG && !end_arg(p))) {
+    return 0;
+  }
+  const command_syntax_t *s = &COMMANDS[p->syntax];
+  if (p->state == PARSE_ERROR || (p->arg < 2 && s->args[p->arg] != ARG_NONE) || p->count == CMD_BATCH_MAX) {
+    return parse_error(p);
+  }
+  p->cur.kind = s->kind;
+  p->cmds[p->count++] = p->cur;
+  return 1;
+}
+
+int cmd_parser_feed(cmd_parser_t *p, char c) {
+  ASSERT(p);
+  for (;;) {
+    switch (p->state) {
+    case PARSE_ERROR:
+      return 0;
+    case PARSE_WORD:
+      if ((c == ' ' || c == '\t') && p->tok_len == 0) {
+        return 1;
+      } else if (c >= 'a' && c <= 'z' && word_prefix(p, c)) {
+        p->word[p->tok_len++] = c;
+        return 1;
+      } else if (p->tok_len == 0 || !end_word(p)) {
+        return parse_error(p);
+      }
+      continue;  // the character after the word is looked at again
+    case PARSE_SPACE:
+      if (c == ' ' || c == '\t') {
+        return 1;
+      } else if (c == ';') {
+        if (!end_command(p)) {
+          return 0;
+        }
+        parser_next_command(p);
+        return 1;
+      } else if (p->arg == 2 || COMMANDS[p->syntax].args[p->arg] == ARG_NONE) {
+        return parse_error(p);
+      }
+      p->state = PARSE_ARG;
+      continue;
+    case PARSE_ARG: {
+      const command_syntax_t *s = &COMMANDS[p->syntax];
+      unsigned char kind = s->args[p->arg];
+      if (kind == ARG_NUM && isnum(c)) {
+        if (p->tok_len == s->max_digits) {
+          return parse_error(p);
+        }
+        p->tok_value = p->tok_value * 10 + (c - '0');
+        ++p->tok_len;
+        return 1;
+      } else if (kind == ARG_SENSOR && p->tok_len == 0) {
+        if (c < 'A' || c > 'E') {
+          return parse_error(p);
+        }
+        p->tok_letter = c;
+        ++p->tok_len;
+        return 1;
+      } else if (kind == ARG_SENSOR && isnum(c)) {
+        if (p->tok_len == 1 + s->max_digits) {
+          return parse_error(p);
+        }
+        p->tok_value = p->tok_value * 10 + (c - '0');
+        ++p->tok_len;
+        // so that A17 shows up as an error right away
+        return p->tok_value > 16 ? parse_error(p) : 1;
+      } else if (kind == ARG_LETTER && p->tok_len == 0) {
+        p->tok_value = c;
+        ++p->tok_len;
+        return 1;
+      } else if (!end_arg(p)) {
+        return 0;
+      }
+      continue;
+    }
+    }
+  }
+}
+
+int cmd_parser_end(cmd_parser_t *p) {
+  ASSERT(p);
+  if (!end_command(p)) {
+    return -1;
+  }
+  return p->count;
+}
+
+size_t cmd_train_bytes(const train_command_t *c) {
+  ASSERT(c);
+  for (size_t i = 0; i < COMMAND_COUNT; ++i) {
+    if (COMMANDS[i].kind == c->kind) {
+      return COMMANDS[i].train_bytes;
+    }
+  }
+  return 0;
+}
+
+COLD train_command_t try_parse_train_command(char *buf, size_t len) {
+  ASSERT(buf);
+  cmd_parser_t p;
+  cmd_parser_init(&p);
+  for (size_t i = 0; i < len; ++i) {
+    cmd_parser_feed(&p, buf[i]);
+  }
+  if (cmd_parser_end(&p) != 1) {
+    p.cmds[0].kind = TRAIN_COMMAND_INVALID;
+  }
+  return p.cmds[0];
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stddef.h>
+
+typedef struct {
+  enum {
+    TRAIN_COMMAND_TR,
+    TRAIN_COMMAND_RV,
+    TRAIN_COMMAND_SW,
+    TRAIN_COMMAND_ROUTE,
+    TRAIN_COMMAND_TRACK,
+    TRAIN_COMMAND_PERF,
+    TRAIN_COMMAND_PROF,
+    TRAIN_COMMAND_TRACE,
+    TRAIN_COMMAND_CAPTURE,
+    TRAIN_COMMAND_LOG,
+    TRAIN_COMMAND_BAUD,
+    TRAIN_COMMAND_BENCH,
+    TRAIN_COMMAND_Q,
+    TRAIN_COMMAND_INVALID,
+  } kind;
+  union {
+    struct { unsigned char train_num, speed; } tr;
+    struct { unsigned char train_num; } rv;
+    struct { unsigned char switch_num, straight; } sw;
+    struct { unsigned char from, to; } route;  // sensor ids
+    struct { char name; } track;
+    struct { unsigned char windowed; } perf;
+    struct { char action; } prof;  // 's'how, 'h'ide or 'r'eset
+    struct { char action; } trace;  // 'd'ump or toggle tracing 's'pi transfers
+    struct { char action; } capture;  // toggle 's'tarting/stopping, or 'd'ump
+    struct { char level; } log;  // least level shown: 'd'ebug, 'i'nfo, 'w'arning or 'e'rror
+    struct { unsigned rate; } baud;  // of the terminal; one the uart can make
+  } cmd;
+} train_command_t;
+
+#define CMD_BATCH_MAX 8  // commands per line
+
+/**
+ * Parses a command line one character at a time, as it is typed.
+ *
+ * A line is a ;-separated list of commands. Each character advances a small state machine: the
+ * command word is matched against the known names as it is typed, and each argument is checked
+ * digit by digit, so a line that cannot become valid is noticed at the character that broke it.
+ * Finished commands are collected in cmds; ending the line only has to close the last one.
+ */
+typedef struct {
+  train_command_t cmds[CMD_BATCH_MAX];
+  size_t count;
+  train_command_t cur;  // command being typed
+  unsigned char state;
+  unsigned char syntax;  // which command cur is, once its name is complete
+  unsigned char arg;  // arguments of cur completed so far
+  unsigned char tok_len;  // characters of the current word or argument
+  unsigned tok_value;
+  char tok_letter;
+  char word[5];
+} cmd_parser_t;
+
+void cmd_parser_init(cmd_parser_t *);
+// feeds the next character of the line; returns 0 if the line is invalid from here on
+int cmd_parser_feed(cmd_parser_t *, char);
+// ends the line; returns the number of commands in cmds, or -1 if the line is invalid
+int cmd_parser_end(cmd_parser_t *);
+
+// bytes the command puts in the train queue when it runs; a route adds 2 for each switch it sets
+size_t cmd_train_bytes(const train_command_t *);
+
+// parses a line holding a single command; TRAIN_COMMAND_INVALID otherwise
+train_command_t try_parse_train_command(char *, size_t);
@@ -0,0 +1,112 @@
+#include "console.h"
+#include "util.h"
+
+#define ASSERT(x)  // TODO
+
+console_t console;
+
+static const char LEVEL_LETTERS[CONSOLE_LEVELS] = {'D', 'I', 'W', 'E'};
+
+void console_init(unsigned char level) {
+  memset(&console, 0, sizeof console);
+  console.level = level;
+}
+
+// appends what fits of len bytes
+static void put(char *out, size_t *at, const char *s, size_t len) {
+  for (size_t i = 0; i < len && *at < CONSOLE_COLS; ++i) {
+    out[(*at)++] = s[i];
+  }
+}
+
+static void put_hex(char *out, size_t *at, unsigned v) {
+  char buf[8];
+  size_t len = 0;
+  do {
+    buf[len++] = "0123456789abcdef"[v % 16];
+    v /= 16;
+  } while (v);
+  while (len) {
+    put(out, at, &buf[--len], 1);
+  }
+}
+
+size_t console_format(const console_entry_t *e, unsigned freq, char *out) {
+  ASSERT(e);
+  ASSERT(out);
+  char num_buf[12];
+  size_t at = 0;
+  // seconds and tenths since the counter started
+  unsigned long long tenths = freq >= 10 ? e->time / (freq / 10) : 0;
+  put(out, &at, num_buf, utoa(tenths / 10, num_buf));
+  num_buf[0] = '.';
+  num_buf[1] = '0' + tenths % 10;
+  num_buf[2] = ' ';
+  num_buf[3] = e->level < CONSOLE_LEVELS ? LEVEL_LETTERS[e->level] : '?';
+  num_buf[4] = ' ';
+  put(out, &at, num_buf, 5);
+
+  unsigned args[2] = {e->a, e->b};
+  size_t arg = 0;
+  for (const char *p = e->fmt; *p && at < CONSOLE_COLS; ++p) {
+    if (*p != '%' || !p[1]) {
+      put(out, &at, p, 1);
+      continue;
+    }
+    char kind = *++p;
+    unsigned v = arg < 2 ? args[arg] : 0;
+    switch (kind) {
+    case 'u':
+      put(out, &at, num_buf, utoa(v, num_buf));
+      ++arg;
+      break;
+    case 'd':
+      if ((int)v < 0) {
+        put(out, &at, "-", 1);
+        v = 0 - v;
+      }
+      put(out, &at, num_buf, utoa(v, num_buf));
+      ++arg;
+      break;
+    case 'x':
+      put_hex(out, &at, v);
+      ++arg;
+      break;
+    case 'c':
+      num_buf[0] = v;
+      put(out, &at, num_buf, 1);
+      ++arg;
+      break;
+    default:
+      put(out, &at, p, 1);
+      break;
+    }
+  }
+  return at;
+}
+
+void console_update(unsigned freq) {
+  unsigned fresh = console.head - console.taken;
+  if (fresh > CONSOLE_SIZE) {
+    // overwritten before they got here
+    console.dropped += fresh - CONSOLE_SIZE;
+    fresh = CONSOLE_SIZE;
+  }
+  // the ones that would scroll out right away are not formatted at all
+  if (fresh > CONSOLE_ROWS) {
+    console.dropped += fresh - CONSOLE_ROWS;
+  }
+  console.taken = console.head - (fresh < CONSOLE_ROWS ? fresh : CONSOLE_ROWS);
+  for (; console.taken != console.head; ++console.taken) {
+    if (console.lines[0].len && !console.lines[0].shown) {
+      ++console.dropped;
+    }
+    for (size_t i = 0; i + 1 < CONSOLE_ROWS; ++i) {
+      console.lines[i] = console.lines[i + 1];
+    }
+    console_line_t *line = &console.lines[CONSOLE_ROWS - 1];
+    line->len = console_format(&console.entries[console.taken % CONSOLE_SIZE], freq, line->text);
+    line->shown = 0;
+    console.dirty = (1u << CONSOLE_ROWS) - 1;
+  }
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <stddef.h>
+
+#include "trace.h"
+
+#define CONSOLE_SIZE 64  // entries; must be a power of two
+#define CONSOLE_ROWS 6  // lines of the region on the dashboard
+#define CONSOLE_COLS 72  // characters of a line, time and level included
+#define CONSOLE_FRAME_BYTES 256  // the region draws at most this much a frame
+
+enum { CONSOLE_DEBUG, CONSOLE_INFO, CONSOLE_WARN, CONSOLE_ERROR, CONSOLE_LEVELS };
+
+typedef struct {
+  unsigned long long time;  // generic timer, all 64 bits: the low 32 wrap every 80 s
+  unsigned char level;
+  const char *fmt;  // a literal; formatted only once the entry is shown
+  unsigned a, b;
+} console_entry_t;
+
+typedef struct {
+  char text[CONSOLE_COLS];
+  unsigned char len;
+  char shown;  // drawn at least once
+} console_line_t;
+
+/**
+ * Log messages for the dashboard.
+ *
+ * console_log only stores the format and two arguments in a fixed-size ring, overwriting the
+ * oldest entry, so it costs about as much as a trace record and can be left in hot paths. Only
+ * the main loop may log. Once a frame, console_update formats the new entries into the lines of
+ * a scrolling region. The dashboard then redraws the lines that changed, within a byte budget.
+ *
+ * Formats take %u, %d, %x and %c for a and b, in order, and %% for a percent sign. Messages that
+ * are overwritten in the ring, or scroll out of the region before being drawn, count as dropped.
+ */
+typedef struct {
+  console_entry_t entries[CONSOLE_SIZE];
+  unsigned head;  // entries written
+  unsigned taken;  // entries moved to lines
+  unsigned char level;  // entries below it are not recorded
+  console_line_t lines[CONSOLE_ROWS];  // oldest first
+  unsigned dirty;  // bit per line changed since drawn
+  unsigned dropped;
+} console_t;
+
+extern console_t console;
+
+static inline void console_log(unsigned char level, const char *fmt, unsigned a, unsigned b) {
+  if (level >= console.level) {
+    console_entry_t *e = &console.entries[console.head++ % CONSOLE_SIZE];
+    e->time = trace_clock64();
+    e->level = level;
+    e->fmt = fmt;
+    e->a = a;
+    e->b = b;
+  }
+}
+
+// clears the ring and the region, and records level and above
+void console_init(unsigned char level);
+
+// writes the line for an entry to out (CONSOLE_COLS bytes) and returns its length; freq is the
+// timer frequency in Hz
+size_t console_format(const console_entry_t *, unsigned freq, char *out);
+
+// moves the entries logged since the last call into the region
+void console_update(unsigned freq);
@@ -0,0 +1,150 @@
+#include "fixed.h"
+
+#define ASSERT(x)  // TODO
+
+// multiplications only; a 128 bit division would need libgcc
+__extension__ typedef __int128 int128_t;
+__extension__ typedef unsigned __int128 uint128_t;
+
+static int saturate16(int64_t v, q16_t *out) {
+  if (v > Q16_MAX) {
+    *out = Q16_MAX;
+    return 0;
+  } else if (v < Q16_MIN) {
+    *out = Q16_MIN;
+    return 0;
+  }
+  *out = (q16_t)v;
+  return 1;
+}
+
+// n * 2^bits / d rounded to nearest for d > 0; 0 if it does not fit in 64 bits
+static int udiv_frac(uint64_t n, uint64_t d, unsigned bits, uint64_t *out) {
+  uint64_t q, r;
+  if (n >> (64 - bits) == 0) {
+    q = (n << bits) / d;
+    r = (n << bits) - q * d;
+  } else {
+    q = n / d;
+    r = n - q * d;
+    if (q >> (64 - bits)) {
+      return 0;
+    }
+    // long division for the fraction bits, keeping r < d without ever computing 2r
+    for (unsigned i = 0; i < bits; ++i) {
+      q <<= 1;
+      if (r >= d - r) {
+        r -= d - r;
+        q |= 1;
+      } else {
+        r <<= 1;
+      }
+    }
+  }
+  if (r >= d - r) {
+    if (q == UINT64_MAX) {
+      return 0;
+    }
+    ++q;
+  }
+  *out = q;
+  return 1;
+}
+
+// n * 2^bits / d, signed, saturating
+static int div_frac(int64_t n, int64_t d, unsigned bits, int64_t *out) {
+  int neg = (n < 0) != (d < 0);
+  uint64_t un = n < 0 ? -(uint64_t)n : (uint64_t)n, ud = d < 0 ? -(uint64_t)d : (uint64_t)d, q;
+  int ok = ud != 0 && udiv_frac(un, ud, bits, &q);
+  uint64_t limit = neg ? (uint64_t)INT64_MAX + 1 : (uint64_t)INT64_MAX;
+  if (!ok || q > limit) {
+    *out = neg ? INT64_MIN : INT64_MAX;
+    return 0;
+  }
+  *out = neg ? (int64_t)(0 - q) : (int64_t)q;
+  return 1;
+}
+
+int q16_from_q32(q32_t x, q16_t *out) {
+  ASSERT(out);
+  return saturate16(x >> 16, out);
+}
+
+int q16_mul(q16_t a, q16_t b, q16_t *out) {
+  ASSERT(out);
+  return saturate16(((int64_t)a * b + (1 << 15)) >> 16, out);
+}
+
+int q16_div(q16_t a, q16_t b, q16_t *out) {
+  ASSERT(out);
+  return q16_ratio(a, b, out);
+}
+
+int q16_ratio(int64_t num, int64_t den, q16_t *out) {
+  ASSERT(out);
+  int64_t v;
+  int ok = div_frac(num, den, 16, &v);
+  return saturate16(v, out) && ok;
+}
+
+int q32_mul(q32_t a, q32_t b, q32_t *out) {
+  ASSERT(out);
+  int128_t p = ((int128_t)a * b + ((int128_t)1 << 31)) >> 32;
+  if (p > INT64_MAX) {
+    *out = INT64_MAX;
+    return 0;
+  } else if (p < INT64_MIN) {
+    *out = INT64_MIN;
+    return 0;
+  }
+  *out = (q32_t)p;
+  return 1;
+}
+
+int q32_div(q32_t a, q32_t b, q32_t *out) {
+  ASSERT(out);
+  return div_frac(a, b, 32, out);
+}
+
+// 2^64 / d rounded up, so that the high half of x * RECIP[d - 1] is x / d rounded down for any
+// 32 bit x: the error is below x / 2^64 < 1 / d. The entry for 1 wraps to 0 and is not used.
+#define R1(d) (UINT64_MAX / (d) + 1)
+#define R4(d) R1(d), R1(d + 1), R1(d + 2), R1(d + 3)
+#define R16(d) R4(d), R4(d + 4), R4(d + 8), R4(d + 12)
+#define R64(d) R16(d), R16(d + 16), R16(d + 32), R16(d + 48)
+static const uint64_t RECIP[FIXED_RECIP_MAX] = {R64(1), R64(65), R64(129), R64(193)};
+
+uint32_t div_small(uint32_t x, unsigned d) {
+  ASSERT(d >= 1 && d <= FIXED_RECIP_MAX);
+  if (d == 1) {
+    return x;
+  }
+  return (uint32_t)(((uint128_t)x * RECIP[d - 1]) >> 64);
+}
+
+q16_t q16_mean(q16_t avg, q16_t sample, unsigned n) {
+  if (n <= 1) {
+    return sample;
+  }
+  // at most 2^32 - 1 apart
+  int64_t diff = (int64_t)sample - avg;
+  uint32_t mag = diff < 0 ? (uint32_t)-diff : (uint32_t)diff;
+  uint32_t step = n <= FIXED_RECIP_MAX ? div_small(mag, n) : mag / n;
+  return (q16_t)(diff < 0 ? avg - (int64_t)step : avg + (int64_t)step);
+}
+
+uint32_t isqrt64(uint64_t x) {
+  if (x < 2) {
+    return (uint32_t)x;
+  }
+  // Newton's method from a power of two above the root decreases to it in a few steps
+  uint64_t r = (uint64_t)1 << ((65 - __builtin_clzll(x)) / 2);
+  for (uint64_t next = (r + x / r) / 2; next < r; next = (r + x / r) / 2) {
+    r = next;
+  }
+  return (uint32_t)r;
+}
+
+q16_t q16_sqrt(q16_t x) {
+  return x > 0 ? (q16_t)isqrt64((uint64_t)x << 16) : 0;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Fixed-point arithmetic, since the kernel is built without floating point registers.
+ *
+ * q16_t is Q16.16: 16 integer and 16 fraction bits, signed, for quantities such as mm/s or
+ * mm/s^2 that stay below 32768. q32_t is Q32.32, for products and sums that would not fit. The
+ * checked operations round to nearest and return 1; when the result does not fit, or on a
+ * division by 0, they return 0 and store the nearest representable value instead.
+ */
+typedef int32_t q16_t;
+typedef int64_t q32_t;
+
+#define Q16_ONE ((q16_t)1 << 16)
+#define Q32_ONE ((q32_t)1 << 32)
+#define Q16_MAX INT32_MAX
+#define Q16_MIN INT32_MIN
+
+// divisors up to this come out of a table of reciprocals, see div_small
+#define FIXED_RECIP_MAX 256
+
+// x must be within +-32767
+static inline q16_t q16_from_int(int32_t x) {
+  return (q16_t)((uint32_t)x << 16);
+}
+
+// rounded to nearest
+static inline int32_t q16_round(q16_t x) {
+  return (int32_t)(((int64_t)x + (1 << 15)) >> 16);
+}
+
+static inline q32_t q32_from_q16(q16_t x) {
+  return (q32_t)x * (1 << 16);
+}
+
+// truncated to Q16.16, saturating
+int q16_from_q32(q32_t x, q16_t *out);
+
+int q16_mul(q16_t a, q16_t b, q16_t *out);
+int q16_div(q16_t a, q16_t b, q16_t *out);
+// num/den as a Q16.16 number, for the integer ratios that measurements come as
+int q16_ratio(int64_t num, int64_t den, q16_t *out);
+int q32_mul(q32_t a, q32_t b, q32_t *out);
+int q32_div(q32_t a, q32_t b, q32_t *out);
+
+// x / d rounded down for 1 <= d <= FIXED_RECIP_MAX, with a multiplication instead of a division
+uint32_t div_small(uint32_t x, unsigned d);
+
+// exponential moving average with weight 2^-shift for the new sample
+static inline q16_t q16_ema(q16_t avg, q16_t sample, unsigned shift) {
+  return avg + (q16_t)(((int64_t)sample - avg) >> shift);
+}
+
+// running mean: avg is the mean of n - 1 samples, the result includes sample as the nth
+q16_t q16_mean(q16_t avg, q16_t sample, unsigned n);
+
+// floor(sqrt(x))
+uint32_t isqrt64(uint64_t x);
+// square root of x >= 0; 0 for negative x
+q16_t q16_sqrt(q16_t x);
@@ -0,0 +1,136 @@
+#include "irq.h"
+
+// GIC-400, with the BCM2711 peripherals in low mode
+static volatile unsigned *const GICD = (unsigned *)0xFF841000;
+static volatile unsigned *const GICC = (unsigned *)0xFF842000;
+static const size_t GICD_CTLR = 0x000 / 4;
+static const size_t GICD_ISENABLER = 0x100 / 4;
+static volatile unsigned char *const GICD_IPRIORITYR = (unsigned char *)(0xFF841000 + 0x400);
+static volatile unsigned char *const GICD_ITARGETSR = (unsigned char *)(0xFF841000 + 0x800);
+static const size_t GICC_CTLR = 0x000 / 4;
+static const size_t GICC_PMR = 0x004 / 4;
+static const size_t GICC_IAR = 0x00C / 4;
+static const size_t GICC_EOIR = 0x010 / 4;
+static const unsigned GIC_SPURIOUS = 1020;
+
+// system timer: the VideoCore interrupts 0-3 are its compare channels, GIC ids 96 up
+static volatile unsigned *const TIMER = (unsigned *)0xFE003000;
+static const size_t TIMER_CS = 0;
+static const size_t TIMER_CLO = 1;
+static const size_t TIMER_C0 = 3;
+static const unsigned IRQ_TIMER_C1 = 97;
+static const unsigned IRQ_TIMER_C3 = 99;
+
+typedef struct {
+  unsigned at;
+  timer_callback_t fn;
+  void *arg;
+} timer_entry_t;
+
+// sorted by time, earliest last so that firing pops from the end
+static timer_entry_t timers[TIMER_CALLBACKS];
+static size_t timer_count;
+static unsigned tick;
+static volatile unsigned taken;
+
+static void enable(unsigned id) {
+  GICD_IPRIORITYR[id] = 0xA0;
+  GICD_ITARGETSR[id] = 1;  // core 0
+  GICD[GICD_ISENABLER + id / 32] = 1u << (id % 32);
+}
+
+void irq_init(unsigned tick_us) {
+  timer_count = 0;
+  tick = tick_us;
+  GICD[GICD_CTLR] = 1;
+  enable(IRQ_TIMER_C1);
+  enable(IRQ_TIMER_C3);
+  GICC[GICC_PMR] = 0xF0;
+  GICC[GICC_CTLR] = 1;
+  TIMER[TIMER_CS] = (1 << 1) | (1 << 3);
+  TIMER[TIMER_C0 + 3] = TIMER[TIMER_CLO] + tick;
+  asm volatile("msr daifclr, #2");
+}
+
+// time left until at, negative once it passed
+static int until(unsigned at) {
+  return (int)(at - TIMER[TIMER_CLO]);
+}
+
+// runs the callbacks that are due and sets channel 1 to the next one; interrupts are masked
+static void timers_fire(void) {
+  while (timer_count) {
+    timer_entry_t *t = &timers[timer_count - 1];
+    if (until(t->at) > 0) {
+      TIMER[TIMER_C0 + 1] = t->at;
+      // the compare only matches on equality, so it may have passed while being set
+      if (until(t->at) > 0) {
+        return;
+      }
+    }
+    --timer_count;
+    t->fn(t->arg);
+  }
+}
+
+int timer_at(unsigned at, timer_callback_t fn, void *arg) {
+  asm volatile("msr daifset, #2");
+  int ok = timer_count < TIMER_CALLBACKS;
+  if (ok) {
+    size_t i = timer_count++;
+    for (; i && (int)(timers[i - 1].at - at) < 0; --i) {
+      timers[i] = timers[i - 1];
+    }
+    timers[i].at = at;
+    timers[i].fn = fn;
+    timers[i].arg = arg;
+    if (i == timer_count - 1) {
+      timers_fire();
+    }
+  }
+  asm volatile("msr daifclr, #2");
+  return ok;
+}
+
+// called from the vector table in boot.S
+void irq_handle(void) {
+  unsigned iar = GICC[GICC_IAR];
+  unsigned id = iar & 0x3FF;
+  if (id == IRQ_TIMER_C1) {
+    TIMER[TIMER_CS] = 1 << 1;
+    timers_fire();
+  } else if (id == IRQ_TIMER_C3) {
+    TIMER[TIMER_CS] = 1 << 3;
+    unsigned next = TIMER[TIMER_C0 + 3] + tick;
+    // skip the ticks missed while interrupts were masked
+    if ((int)(next - TIMER[TIMER_CLO]) <= 0) {
+      next = TIMER[TIMER_CLO] + tick;
+    }
+    TIMER[TIMER_C0 + 3] = next;
+  }
+  if (id < GIC_SPURIOUS) {
+    GICC[GICC_EOIR] = iar;
+  }
+  taken = taken + 1;
+}
+
+unsigned irq_count(void) {
+  return taken;
+}
+
+int irq_take(volatile int *flag) {
+  asm volatile("msr daifset, #2");
+  int value = *flag;
+  *flag = 0;
+  asm volatile("msr daifclr, #2");
+  return value;
+}
+
+void irq_idle(unsigned since) {
+  // with interrupts masked, one arriving now still ends wfi, and is taken once they are unmasked
+  asm volatile("msr daifset, #2");
+  if (taken == since) {
+    asm volatile("dsb sy; wfi");
+  }
+  asm volatile("msr daifclr, #2");
+}
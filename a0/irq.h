@@ -0,0 +1,33 @@
+#pragma once
+
+#include <stddef.h>
+
+#define TIMER_CALLBACKS 128  // pending at once
+
+typedef void (*timer_callback_t)(void *arg);
+
+/**
+ * Interrupts from the system timer, through the GIC-400.
+ *
+ * Compare channel 1 fires one-shot callbacks at given times of the 1 MHz counter (TIMER_CLO);
+ * pending callbacks are kept sorted, so the channel is always set to the earliest. Channel 3
+ * ticks periodically and does nothing but wake the core, so that a loop sleeping in irq_idle
+ * still gets to poll the devices that cannot interrupt it.
+ *
+ * Callbacks run in the interrupt handler with interrupts masked: they should only record that
+ * something is due and leave the work to the loop, which owns all other state.
+ */
+void irq_init(unsigned tick_us);
+
+// runs fn(arg) once the counter reaches at; returns 0 if TIMER_CALLBACKS are already pending
+int timer_at(unsigned at, timer_callback_t fn, void *arg);
+
+// interrupts taken so far
+unsigned irq_count(void);
+
+// reads a flag that a callback sets and clears it, with interrupts masked so that a callback
+// between the two is not lost
+int irq_take(volatile int *flag);
+
+// sleeps in wfi until the next interrupt, unless one was taken since irq_count returned since
+void irq_idle(unsigned since);
@@ -1,8 +1,18 @@
+#include "attrib.h"
+#include "capture.h"
+#include "command.h"
+#include "console.h"
+#include "irq.h"
+#include "prof.h"
 #include "rpi.h"
+#include "section.h"
+#include "sensor.h"
+#include "trace.h"
+#include "train.h"
 #include "util.h"
+#include "velocity.h"
 
 static const unsigned TIMER_FREQ = 1000000;
-static const unsigned *TIMER_CLO = (unsigned *)(0xfe003000 + 0x04);
 static const unsigned TIMER_TICK = TIMER_FREQ / 10;  // 1 mhz => .1 s every tick
 static const unsigned TIMER_TICK_NEAREST_ROUND = 4294900000;
 
@@ -24,7 +34,6 @@ static const unsigned TRAIN_ACCELERATION[] = {
   TIMER_TICK * 55,
   TIMER_TICK * 55,
 };
-static const unsigned MAX_TRAINS = 99;
 
 static const char CLRSCR[] = "\033[1;1H\033[2J";
 static const char MOVSCR[] = "\033[;H";
@@ -32,76 +41,122 @@ static const char CLRLNE[] = "\033[2K\r";
 static const char HIDCSR[] = "\033[?25l";
 static const char SHWCSR[] = "\033[?25h";
 
-typedef struct {
-  char number;
-  char speed;
-} train_speed_elem_t;
-
-static void format_two_digits(unsigned num, char *out) {
+HOT static void format_two_digits(unsigned num, char *out) {
   out[0] = '0' + (num / 10 % 10);
   out[1] = '0' + (num % 10);
   out[2] = ' ';
 }
 
-static void draw_speeds(queue_t *scr_queue, train_speed_elem_t *train_speeds, size_t train_speeds_end) {
-  queue_emplace_literal(scr_queue, "\r\n\r\nTrain # ");
-  char num_buf[3];
-  for (size_t i = 0; i < train_speeds_end; ++i) {
-    format_two_digits(train_speeds[i].number, num_buf);
-    queue_emplace(scr_queue, num_buf, 3);
+// right aligns num in width columns, followed by a space; a number too wide for them shows as
+// >99..9 rather than as its leading digits
+HOT static void format_padded(unsigned num, char *out, size_t width) {
+  char num_buf[12];
+  size_t len = utoa(num, num_buf);
+  if (len > width) {
+    out[0] = '>';
+    memset(out + 1, '9', width - 1);
+  } else {
+    memset(out, ' ', width - len);
+    memcpy(out + width - len, num_buf, len);
   }
-  queue_emplace_literal(scr_queue, "\r\nSpeed   ");
-  for (size_t i = 0; i < train_speeds_end; ++i) {
-    format_two_digits(train_speeds[i].speed, num_buf);
-    queue_emplace(scr_queue, num_buf, 3);
+  out[width] = ' ';
+}
+
+HOT static void draw_sensor_name(queue_t *scr_queue, unsigned char sensor) {
+  char num_buf[4];
+  num_buf[0] = SENSOR_ALP(sensor);
+  format_two_digits(SENSOR_NUM(sensor), num_buf + 1);
+  queue_emplace(scr_queue, num_buf, 3);
+}
+
+static const size_t SPEED_COLUMN = 4;
+
+// the train table starts on this row, see the frame layout in main
+static const unsigned TRAIN_TABLE_ROW = 5;
+static const unsigned TRAIN_TABLE_COLUMN = 9;  // after the row labels
+static const char TRAIN_TABLE_LABELS[][9] = {"Train # ", "Speed   ", "mm/s    ", "At      "};
+static const size_t TRAIN_TABLE_ROWS = sizeof TRAIN_TABLE_LABELS / sizeof(TRAIN_TABLE_LABELS[0]);
+
+HOT static void move_cursor(queue_t *scr_queue, unsigned row, unsigned col) {
+  char buf[24];
+  size_t len = 0;
+  buf[len++] = '\033';
+  buf[len++] = '[';
+  len += utoa(row, buf + len);
+  buf[len++] = ';';
+  len += utoa(col, buf + len);
+  buf[len++] = 'H';
+  queue_emplace(scr_queue, buf, len);
+}
+
+HOT static void draw_train(queue_t *scr_queue, train_table_t *trains, unsigned char number, velocity_t *velocity) {
+  train_state_t *s = &trains->trains[number];
+  unsigned col = TRAIN_TABLE_COLUMN + s->column * (SPEED_COLUMN + 1);
+  char num_buf[SPEED_COLUMN + 1];
+  move_cursor(scr_queue, TRAIN_TABLE_ROW, col);
+  format_padded(number, num_buf, SPEED_COLUMN);
+  queue_emplace(scr_queue, num_buf, SPEED_COLUMN + 1);
+  move_cursor(scr_queue, TRAIN_TABLE_ROW + 1, col);
+  format_padded(s->speed, num_buf, SPEED_COLUMN);
+  queue_emplace(scr_queue, num_buf, SPEED_COLUMN + 1);
+  move_cursor(scr_queue, TRAIN_TABLE_ROW + 2, col);
+  format_padded(velocity_get(velocity, number, s->speed), num_buf, SPEED_COLUMN);
+  queue_emplace(scr_queue, num_buf, SPEED_COLUMN + 1);
+  move_cursor(scr_queue, TRAIN_TABLE_ROW + 3, col);
+  if (s->last_sensor != SENSOR_NONE) {
+    queue_emplace_literal(scr_queue, " ");
+    draw_sensor_name(scr_queue, s->last_sensor);
+  } else {
+    queue_emplace_literal(scr_queue, "  ? ");
   }
 }
 
-static train_speed_elem_t *find_train_speed(char number, train_speed_elem_t *train_speeds, size_t train_speeds_end) {
-  for (size_t i = 0; i < train_speeds_end; ++i) {
-    if (train_speeds[i].number == number) {
-      return &train_speeds[i];
+// redraws the trains that changed since the last frame, or everything if full; leaves the cursor
+// on the last row of the table
+HOT static void draw_trains(queue_t *scr_queue, train_table_t *trains, velocity_t *velocity, int full) {
+  if (full) {
+    for (size_t i = 0; i < TRAIN_TABLE_ROWS; ++i) {
+      move_cursor(scr_queue, TRAIN_TABLE_ROW + i, 1);
+      queue_emplace_literal(scr_queue, CLRLNE);
+      queue_emplace(scr_queue, TRAIN_TABLE_LABELS[i], TRAIN_TABLE_COLUMN - 1);
     }
+    train_touch_all(trains);
   }
-  return 0;
+  for (size_t i = 0; i < trains->journal_count; ++i) {
+    draw_train(scr_queue, trains, trains->journal[i], velocity);
+  }
+  train_journal_clear(trains);
+  move_cursor(scr_queue, TRAIN_TABLE_ROW + TRAIN_TABLE_ROWS - 1, 1);
 }
 
-static void update_train_speed(char number, char speed, train_speed_elem_t *train_speeds, size_t *train_speeds_end) {
-  train_speed_elem_t *train_speed = find_train_speed(number, train_speeds, *train_speeds_end);
-  if (train_speed) {
-    train_speed->speed = speed;
-  } else {
-    train_speeds[*train_speeds_end].number = number;
-    train_speeds[*train_speeds_end].speed = speed;
-    ++*train_speeds_end;
-  }
+static void set_train_speed(train_table_t *trains, unsigned char number, unsigned char speed, velocity_t *velocity,
+                            attrib_t *attrib, unsigned now) {
+  velocity_set_speed(velocity, number, speed, now, TRAIN_ACCELERATION[(size_t)speed % 16]);
+  attrib_set_speed(attrib, number, speed);
+  train_state_t *s = train_get(trains, number);
+  s->speed = speed;
+  s->last_cmd_time = now;
+  train_touch(trains, number);
 }
 
-static const unsigned MAX_SWITCHES = 22;
+static const size_t SWITCHES_PER_ROW = 11;
 static const unsigned SWITCH_TIMEOUT = TIMER_TICK * 3;
 
+// by switch index, see SWITCH_INDEX
 typedef char switch_status_t;
 
-static size_t switch2idx(size_t i) {
-  return ((i) < 19 ? ((i)-1) : ((i)-135));
-}
-
-static size_t idx2switch(size_t i) {
-  return i < 18 ? i + 1 : i + 135;
-}
-
-static void format_three_digits(unsigned num, char *out) {
+HOT static void format_three_digits(unsigned num, char *out) {
   out[0] = '0' + (num / 100);
   out[1] = '0' + (num / 10 % 10);
   out[2] = '0' + (num % 10);
   out[3] = ' ';
 }
 
-static void draw_switches_row(queue_t *scr_queue, switch_status_t *switches, size_t start, size_t end) {
+HOT static void draw_switches_row(queue_t *scr_queue, switch_status_t *switches, size_t start, size_t end) {
   queue_emplace_literal(scr_queue, "\r\nSwitch # ");
   char num_buf[4];
   for (size_t i = start; i < end; ++i) {
-    format_three_digits(idx2switch(i), num_buf);
+    format_three_digits(SWITCH_IDS[i], num_buf);
     queue_emplace(scr_queue, num_buf, 4);
   }
   queue_emplace_literal(scr_queue, "\r\nStatus   ");
@@ -112,140 +167,504 @@ static void draw_switches_row(queue_t *scr_queue, switch_status_t *switches, siz
   }
 }
 
-static void draw_switches(queue_t *scr_queue, switch_status_t *switches) {
+HOT static void draw_switches(queue_t *scr_queue, switch_status_t *switches) {
   queue_emplace_literal(scr_queue, "\r\n");
-  draw_switches_row(scr_queue, switches, 0, MAX_SWITCHES / 2);
-  draw_switches_row(scr_queue, switches, MAX_SWITCHES / 2, MAX_SWITCHES);
+  for (size_t i = 0; i < SWITCH_COUNT; i += SWITCHES_PER_ROW) {
+    draw_switches_row(scr_queue, switches, i, i + SWITCHES_PER_ROW < SWITCH_COUNT ? i + SWITCHES_PER_ROW : SWITCH_COUNT);
+  }
 }
 
 static const size_t MAX_SENSOR_OUT = 10;
+static const unsigned SENSOR_WINDOW = TIMER_TICK * 10 * 10;
 static const unsigned TRAIN_CMD_TIMEOUT = TIMER_TICK;
+// how often the loop wakes up to poll when it has nothing to do; the devices cannot interrupt it
+static const unsigned IDLE_POLL = TIMER_FREQ / 2000;
 
-typedef struct {
-  char alp, num;
-} sensor_elem_t;
-
-static void add_active_sensor(char alpha, char num, sensor_elem_t *list, size_t *list_idx) {
-  list[*list_idx].alp = alpha;
-  list[*list_idx].num = num;
-  ++*list_idx;
-  if (*list_idx == MAX_SENSOR_OUT) {
-    *list_idx = 0;
-  }
-}
-
-static void add_active_sensors_from_data(char dat, int num_offset, char alpha, sensor_elem_t *list, size_t *list_idx) {
-  // note: the track manual seems to use big endian, but the data from pi is little endian
-  // to both bytes and bits
-  for (unsigned i = 0; i < 8; ++i) {
-    if (((unsigned char)dat >> (7 - i)) & 1) {
-      add_active_sensor(alpha, i + 1 + num_offset, list, list_idx);
+HOT static void draw_sensors(queue_t *scr_queue, sensor_log_t *log, attrib_t *attrib) {
+  queue_emplace_literal(scr_queue, "\r\n\r\n");
+  queue_emplace_literal(scr_queue, CLRLNE);
+  queue_emplace_literal(scr_queue, "Most active sensors ");
+  char num_buf[12];
+  size_t active = sensor_log_active(log);
+  for (size_t i = 0; i < active && i < MAX_SENSOR_OUT; ++i) {
+    unsigned char sensor = log->order[i];
+    if (sensor == log->last) {
+      queue_emplace_literal(scr_queue, "\033[1m");
+    }
+    draw_sensor_name(scr_queue, sensor);
+    queue_emplace_literal(scr_queue, "x");
+    size_t len = utoa(log->window_hits[sensor], num_buf);
+    queue_emplace(scr_queue, num_buf, len);
+    if (sensor == log->last) {
+      queue_emplace_literal(scr_queue, "\033[0m");
     }
+    queue_emplace_literal(scr_queue, " ");
   }
-}
 
-static void draw_sensors(queue_t *scr_queue, sensor_elem_t *list, size_t list_idx) {
-  queue_emplace_literal(scr_queue, "\r\n\r\nMost active sensors ");
-  char num_buf[3];
-  size_t past_idx = (list_idx == 0 ? MAX_SENSOR_OUT : list_idx)- 1;
-  for (size_t i = 0; i < MAX_SENSOR_OUT; ++i) {
-    if (!list[i].alp) {  // unfilled initializer values
-      break;
-    }
-    format_two_digits(list[i].num, num_buf);
-    if (i == past_idx) {
-      queue_emplace_literal(scr_queue, "\033[1m");
-      queue_emplace(scr_queue, &list[i].alp, 1);
-      queue_emplace(scr_queue, num_buf, 2);
-      queue_emplace_literal(scr_queue, " \033[0m ");
-    } else {
-      queue_emplace(scr_queue, &list[i].alp, 1);
-      queue_emplace(scr_queue, num_buf, 3);
-    }
+  queue_emplace_literal(scr_queue, "\r\n");
+  queue_emplace_literal(scr_queue, CLRLNE);
+  if (log->last != SENSOR_NONE) {
+    queue_emplace_literal(scr_queue, "Last sensor ");
+    draw_sensor_name(scr_queue, log->last);
+    queue_emplace_literal(scr_queue, " hits ");
+    size_t len = utoa(log->hits[log->last], num_buf);
+    queue_emplace(scr_queue, num_buf, len);
+    queue_emplace_literal(scr_queue, " interval ");
+    len = utoa(log->interval[log->last] / (TIMER_FREQ / 1000), num_buf);
+    queue_emplace(scr_queue, num_buf, len);
+    queue_emplace_literal(scr_queue, " ms");
+  }
+  if (attrib->spurious) {
+    queue_emplace_literal(scr_queue, "  spurious ");
+    size_t len = utoa(attrib->spurious, num_buf);
+    queue_emplace(scr_queue, num_buf, len);
+    queue_emplace_literal(scr_queue, " (last ");
+    draw_sensor_name(scr_queue, attrib->last_spurious);
+    queue_emplace_literal(scr_queue, ")");
+  }
+  if (attrib->dropped) {
+    queue_emplace_literal(scr_queue, "  predictions dropped ");
+    size_t len = utoa(attrib->dropped, num_buf);
+    queue_emplace(scr_queue, num_buf, len);
+  }
+  if (attrib->untracked) {
+    queue_emplace_literal(scr_queue, "  untracked ");
+    size_t len = utoa(attrib->untracked, num_buf);
+    queue_emplace(scr_queue, num_buf, len);
   }
 }
 
-static const unsigned MAX_FEEDBACK_WAIT = TIMER_TICK * 10 * 5;
+static const unsigned PERF_WINDOW = TIMER_TICK * 10 * 10;
+
+enum { PERF_IT, PERF_FB, PERF_FF, PERF_RF, PERF_QW, PERF_AT, PERF_HISTS };
+static const char PERF_HIST_NAMES[PERF_HISTS][4] = {"IT ", "FB ", "FF ", "RF ", "QW ", "AT "};
+static const unsigned PERF_PERCENTILES[] = {5000, 9000, 9900, 9990};
 
 typedef struct {
-  unsigned last_it_timer, last_query_timer;
+  unsigned last_it_timer;
   struct perf_data_0_t {
-    unsigned it, query_resp, query_resp_full;
-  } rt, max;
-  char non_responding;
+    unsigned it, query_resp, query_resp_full, refresh;
+  } rt;
+  // latency distributions in us (AT in ns); in windowed mode they restart every PERF_WINDOW
+  hist_t hist[PERF_HISTS];
+  char windowed;
+  unsigned window_start;
 } perf_data_t;
 
-static unsigned umax(unsigned a, unsigned b) {
+HOT static unsigned umax(unsigned a, unsigned b) {
   return a > b ? a : b;
 }
 
-static unsigned tick2us(unsigned a) {
+HOT static unsigned tick2us(unsigned a) {
   return a * 1000000 / TIMER_FREQ;
 }
 
-static void draw_perf(queue_t *scr_queue, perf_data_t *perf) {
-  struct perf_data_0_t lst[] = {perf->rt, perf->max};
+// the generic timer counts much faster than the system timer; used for sub-microsecond timings
+HOT static unsigned long long counter_now(void) {
+#ifdef __aarch64__
+  unsigned long long v;
+  __asm__ volatile("isb; mrs %0, cntpct_el0" : "=r"(v));
+  return v;
+#else
+  return 0;
+#endif
+}
+
+static unsigned counter_freq(void) {
+  unsigned long long freq = 0;
+#ifdef __aarch64__
+  __asm__("mrs %0, cntfrq_el0" : "=r"(freq));
+#endif
+  return freq;
+}
+
+static unsigned counter2ns(unsigned long long ticks) {
+  unsigned long long freq = counter_freq();
+  return freq ? ticks * 1000000000 / freq : 0;
+}
+
+// streams the trace ring out as one binary frame; blocks until it is sent, which is about 0.4 s
+// for a full ring at 115200 baud
+COLD static void dump_trace(void) {
+  unsigned mask = trace.mask;
+  trace_dump_begin(counter_freq());
+  char buf[64];
+  size_t len;
+  for (size_t pos = 0; (len = trace_dump_read(pos, buf, sizeof buf)); pos += len) {
+    uart_puts(0, 0, buf, len);
+  }
+  trace_dump_end(mask);
+}
+
+// sends what was captured as one binary frame, see capture.h; blocks until it is sent, which is
+// about 1.5 s for every 16 KB at 115200 baud
+COLD static void dump_capture(void) {
+  capture_dump_begin();
+  char buf[64];
+  size_t len;
+  for (size_t pos = 0; (len = capture_dump_read(pos, buf, sizeof buf)); pos += len) {
+    uart_puts(0, 0, buf, len);
+  }
+}
+
+HOT static void perf_window(perf_data_t *perf, unsigned now) {
+  if (perf->windowed && now - perf->window_start >= PERF_WINDOW) {
+    for (size_t i = 0; i < PERF_HISTS; ++i) {
+      hist_reset(&perf->hist[i]);
+    }
+    perf->window_start = now;
+  }
+}
+
+static const size_t PERF_COLUMN = 7;
+
+HOT static void draw_perf(queue_t *scr_queue, perf_data_t *perf) {
+  unsigned rt[] = {perf->rt.it, perf->rt.query_resp, perf->rt.query_resp_full, perf->rt.refresh};
   char num_buf[20];
   queue_emplace_literal(scr_queue, "\r\n\r\n");
   queue_emplace_literal(scr_queue, CLRLNE);
   queue_emplace_literal(scr_queue, "RT:");
+  for (size_t i = 0; i < sizeof rt / sizeof(rt[0]); ++i) {
+    queue_emplace_literal(scr_queue, " ");
+    queue_emplace(scr_queue, PERF_HIST_NAMES[i], 3);
+    size_t len = utoa(rt[i], num_buf);
+    queue_emplace(scr_queue, num_buf, len);
+  }
+  queue_emplace_literal(scr_queue, " us");
 
+  queue_emplace_literal(scr_queue, "\r\n");
+  queue_emplace_literal(scr_queue, CLRLNE);
+  queue_emplace_literal(scr_queue, "us        p50    p90    p99   p999    max      n");
+  if (perf->windowed) {
+    queue_emplace_literal(scr_queue, "  (last 10 s)");
+  } else {
+    queue_emplace_literal(scr_queue, "  (since start)");
+  }
+  for (size_t i = 0; i < PERF_HISTS; ++i) {
+    hist_t *h = &perf->hist[i];
+    queue_emplace_literal(scr_queue, "\r\n");
+    queue_emplace_literal(scr_queue, CLRLNE);
+    queue_emplace(scr_queue, PERF_HIST_NAMES[i], 3);
+    for (size_t j = 0; j < sizeof PERF_PERCENTILES / sizeof(PERF_PERCENTILES[0]); ++j) {
+      format_padded(hist_percentile(h, PERF_PERCENTILES[j]), num_buf, PERF_COLUMN - 1);
+      queue_emplace(scr_queue, num_buf, PERF_COLUMN);
+    }
+    format_padded(h->max, num_buf, PERF_COLUMN - 1);
+    queue_emplace(scr_queue, num_buf, PERF_COLUMN);
+    format_padded(h->total, num_buf, PERF_COLUMN - 1);
+    queue_emplace(scr_queue, num_buf, PERF_COLUMN);
+    if (i == PERF_AT) {
+      queue_emplace_literal(scr_queue, " ns");
+    }
+  }
+
+  queue_emplace_literal(scr_queue, "\r\n");
+  queue_emplace_literal(scr_queue, CLRLNE);
+}
+
+/**
+ * Share of time each core spends doing something rather than polling. Core 0 counts the loop
+ * iterations that drew a frame or moved a byte; the I/O core, in MULTICORE builds, counts its
+ * own. Shown over the last second.
+ */
+typedef struct {
+  unsigned long long busy[2], total[2];  // generic timer ticks, by core
+  unsigned long long last_busy[2], last_total[2];  // at the last sample
+  unsigned percent[2];
+  unsigned sampled_at;
+} core_load_t;
+
+static void core_load_sample(core_load_t *load, unsigned now) {
+  io_core_load(&load->busy[1], &load->total[1]);
   for (size_t i = 0; i < 2; ++i) {
-    queue_emplace_literal(scr_queue, " IT ");
-    size_t len = utoa(lst[i].it, num_buf);
-    queue_emplace(scr_queue, num_buf, len); 
-    queue_emplace_literal(scr_queue, " FB ");
-    len = utoa(lst[i].query_resp, num_buf);
-    queue_emplace(scr_queue, num_buf, len);
-    queue_emplace_literal(scr_queue, " FF ");
-    len = utoa(lst[i].query_resp_full, num_buf);
-    queue_emplace(scr_queue, num_buf, len);
-    queue_emplace_literal(scr_queue, " us");
+    unsigned long long busy = load->busy[i] - load->last_busy[i], total = load->total[i] - load->last_total[i];
+    load->percent[i] = total ? busy * 100 / total : 0;
+    load->last_busy[i] = load->busy[i];
+    load->last_total[i] = load->total[i];
+  }
+  load->sampled_at = now;
+}
+
+HOT static void draw_load(queue_t *scr_queue, core_load_t *load) {
+  char num_buf[12];
+  queue_emplace_literal(scr_queue, "\r\n");
+  queue_emplace_literal(scr_queue, CLRLNE);
+  queue_emplace_literal(scr_queue, "Load: core 0 ");
+  queue_emplace(scr_queue, num_buf, utoa(load->percent[0], num_buf));
+  queue_emplace_literal(scr_queue, "%");
+  if (load->total[1]) {
+    queue_emplace_literal(scr_queue, ", core 1 (I/O) ");
+    queue_emplace(scr_queue, num_buf, utoa(load->percent[1], num_buf));
+    queue_emplace_literal(scr_queue, "%");
+  }
+}
+
+// the system timer when boot.S started; the timer runs from reset, so this includes loading the image
+extern unsigned boot_clock;
+
+HOT static void draw_boot(queue_t *scr_queue, unsigned main_clock) {
+  char num_buf[12];
+  queue_emplace_literal(scr_queue, "\r\n");
+  queue_emplace_literal(scr_queue, CLRLNE);
+  queue_emplace_literal(scr_queue, "Boot: image started ");
+  queue_emplace(scr_queue, num_buf, utoa(tick2us(boot_clock) / 1000, num_buf));
+  queue_emplace_literal(scr_queue, " ms after reset, main ");
+  queue_emplace(scr_queue, num_buf, utoa(tick2us(main_clock - boot_clock), num_buf));
+  queue_emplace_literal(scr_queue, " us later");
+}
+
+static const unsigned TERMINAL_BAUD = 115200;  // what init_uart sets
+// how long a new terminal rate has to be confirmed with Enter before the old one comes back
+static const unsigned BAUD_CONFIRM_TIMEOUT = TIMER_FREQ * 10;
+static const size_t BENCH_LINES = 48;
+
+/**
+ * Rate of the terminal's uart. A new one is only kept once Enter arrives at it; otherwise the
+ * terminal probably is not following, and after BAUD_CONFIRM_TIMEOUT the old rate comes back.
+ */
+typedef struct {
+  unsigned rate, fallback;
+  unsigned since;  // when confirming started
+  char confirming;
+  unsigned throughput;  // bytes/s measured by the last bench, 0 before one
+} terminal_t;
+
+// drops the frame being sent, whose escape sequences would arrive cut, and clears the screen at
+// the new rate; the caller then has to redraw it in full
+COLD static void terminal_set_baud(queue_t *scr_queue, unsigned rate) {
+  queue_consume(scr_queue, scr_queue->capacity);
+  uart_set_baud(0, 0, rate);
+  uart_puts(0, 0, CLRSCR, sizeof CLRSCR / sizeof(CLRSCR[0]) - 1);
+}
+
+// announces the switch at the old rate, then makes it
+COLD static void terminal_switch(terminal_t *term, queue_t *scr_queue, unsigned rate, unsigned now) {
+  char num_buf[12];
+  static const char before[] = "\r\n\r\nSwitching the terminal to ";
+  static const char after[] = " baud. Press Enter once it is there, or wait 10 s to come back.\r\n";
+  uart_puts(0, 0, before, sizeof before - 1);
+  uart_puts(0, 0, num_buf, utoa(rate, num_buf));
+  uart_puts(0, 0, after, sizeof after - 1);
+  if (!term->confirming) {
+    term->fallback = term->rate;
+  }
+  term->rate = rate;
+  term->since = now;
+  term->confirming = 1;
+  term->throughput = 0;
+  terminal_set_baud(scr_queue, rate);
+}
+
+// fills the screen with text as fast as the uart takes it, and measures how fast that was; blocks
+// for about 0.3 s at 115200 baud
+COLD static void terminal_bench(terminal_t *term, queue_t *scr_queue) {
+  char line[80];
+  for (size_t i = 0; i < sizeof line - 2; ++i) {
+    line[i] = '!' + i % 94;
+  }
+  line[sizeof line - 2] = '\r';
+  line[sizeof line - 1] = '\n';
+  queue_consume(scr_queue, scr_queue->capacity);
+  uart_flush(0, 0);
+  unsigned start = timer_now();
+  for (size_t i = 0; i < BENCH_LINES; ++i) {
+    uart_puts(0, 0, line, sizeof line);
+  }
+  uart_flush(0, 0);
+  unsigned elapsed = timer_now() - start;
+  term->throughput = elapsed ? (unsigned long long)BENCH_LINES * sizeof line * TIMER_FREQ / elapsed : 0;
+  uart_puts(0, 0, CLRSCR, sizeof CLRSCR / sizeof(CLRSCR[0]) - 1);
+}
+
+HOT static void draw_terminal(queue_t *scr_queue, terminal_t *term) {
+  char num_buf[12];
+  queue_emplace_literal(scr_queue, "\r\n");
+  queue_emplace_literal(scr_queue, CLRLNE);
+  queue_emplace_literal(scr_queue, "Terminal: ");
+  queue_emplace(scr_queue, num_buf, utoa(term->rate, num_buf));
+  queue_emplace_literal(scr_queue, " baud");
+  if (term->throughput) {
+    // 10 bits a byte with the start and stop bits
+    queue_emplace_literal(scr_queue, ", bench ");
+    queue_emplace(scr_queue, num_buf, utoa(term->throughput, num_buf));
+    queue_emplace_literal(scr_queue, " B/s of ");
+    queue_emplace(scr_queue, num_buf, utoa(term->rate / 10, num_buf));
+  }
+}
 
-    if (i == 0) {
-      queue_emplace_literal(scr_queue, "\r\n");
+// the lines that changed are drawn, newest first while CONSOLE_FRAME_BYTES lasts; the others are
+// stepped over, and what they show stays on the screen
+HOT static void draw_console(queue_t *scr_queue, int full) {
+  char num_buf[12];
+  queue_emplace_literal(scr_queue, "\r\n");
+  queue_emplace_literal(scr_queue, CLRLNE);
+  queue_emplace_literal(scr_queue, "Log");
+  if (console.dropped) {
+    queue_emplace_literal(scr_queue, " (");
+    queue_emplace(scr_queue, num_buf, utoa(console.dropped, num_buf));
+    queue_emplace_literal(scr_queue, " dropped)");
+  }
+  if (full) {
+    console.dirty = (1u << CONSOLE_ROWS) - 1;
+  }
+  unsigned draw = 0;
+  size_t budget = CONSOLE_FRAME_BYTES;
+  for (size_t i = CONSOLE_ROWS; i-- > 0;) {
+    size_t cost = sizeof CLRLNE - 1 + console.lines[i].len;
+    if ((console.dirty & (1u << i)) && cost <= budget) {
+      draw |= 1u << i;
+      budget -= cost;
+    }
+  }
+  for (size_t i = 0; i < CONSOLE_ROWS; ++i) {
+    queue_emplace_literal(scr_queue, "\r\n");
+    if (draw & (1u << i)) {
+      console_line_t *line = &console.lines[i];
       queue_emplace_literal(scr_queue, CLRLNE);
-      queue_emplace_literal(scr_queue, "MX:");
+      queue_emplace(scr_queue, line->text, line->len);
+      line->shown = 1;
     }
   }
+  console.dirty &= ~draw;
+}
+
+static const char PROF_PHASE_NAMES[PROF_PHASES][5] = {"loop", "draw", "in  ", "fb  ", "out ", "spi "};
+
+static void draw_prof_value(queue_t *scr_queue, unsigned long long value) {
+  char num_buf[PERF_COLUMN + 1];
+  // clamped to fit format_padded, at a value that still saturates
+  format_padded(value > 1000000 ? 1000000 : value, num_buf, PERF_COLUMN - 1);
+  queue_emplace(scr_queue, num_buf, PERF_COLUMN);
+}
 
+// per phase: calls, cycles per call, longest call, share of the loop's cycles, and events per call
+static void draw_prof(queue_t *scr_queue) {
   queue_emplace_literal(scr_queue, "\r\n");
   queue_emplace_literal(scr_queue, CLRLNE);
-  if (perf->non_responding) {
-    queue_emplace_literal(scr_queue, "The connection is inconsistent; you may need to restart the program (use q).");
+  queue_emplace_literal(scr_queue, "cycles calls   /call    max  loop%  ins/c  l1d/c  brm/c");
+  unsigned long long loop_cycles = prof.phases[PROF_LOOP].cycles;
+  for (size_t i = 0; i < PROF_PHASES; ++i) {
+    prof_phase_t *p = &prof.phases[i];
+    unsigned calls = p->calls ? p->calls : 1;
+    queue_emplace_literal(scr_queue, "\r\n");
+    queue_emplace_literal(scr_queue, CLRLNE);
+    queue_emplace(scr_queue, PROF_PHASE_NAMES[i], 4);
+    queue_emplace_literal(scr_queue, "  ");
+    draw_prof_value(scr_queue, p->calls);
+    draw_prof_value(scr_queue, p->cycles / calls);
+    draw_prof_value(scr_queue, p->max_cycles);
+    draw_prof_value(scr_queue, loop_cycles ? p->cycles * 100 / loop_cycles : 0);
+    for (size_t j = 0; j < PROF_EVENTS; ++j) {
+      draw_prof_value(scr_queue, p->events[j] / calls);
+    }
+  }
+}
+
+// enqueue times of the commands waiting in the train queue, to measure how long they wait
+#define CMD_WAIT_SLOTS 32
+
+typedef struct {
+  unsigned time[CMD_WAIT_SLOTS];
+  unsigned end[CMD_WAIT_SLOTS];  // bytes_in right after the command was queued
+  size_t begin, count;
+  unsigned bytes_in, bytes_out;
+  unsigned sent_end;  // end of the last command sent in full
+} cmd_wait_t;
+
+static void queue_train_cmd(queue_t *train_queue, cmd_wait_t *wait, const char *cmd, size_t len, unsigned now) {
+  size_t before = queue_size(train_queue);
+  // whole or not at all: half a command would shift every command after it
+  if (before + len < train_queue->capacity) {
+    queue_emplace(train_queue, cmd, len);
+  }
+  size_t added = queue_size(train_queue) - before;
+  if (added < len) {
+    trace_event(TRACE_QUEUE_DROP, TRACE_QUEUE_TRAIN, len - added);
+    console_log(CONSOLE_WARN, "train queue full, %u bytes dropped", len - added, 0);
+  }
+  wait->bytes_in += added;
+  // when out of slots the command is timed together with the one before it
+  if (added && wait->count < CMD_WAIT_SLOTS) {
+    size_t slot = (wait->begin + wait->count++) % CMD_WAIT_SLOTS;
+    wait->time[slot] = now;
+    wait->end[slot] = wait->bytes_in;
+  } else if (added && wait->count) {
+    wait->end[(wait->begin + wait->count - 1) % CMD_WAIT_SLOTS] = wait->bytes_in;
+  }
+}
+
+HOT static void train_cmd_sent(cmd_wait_t *wait, size_t len, unsigned now, hist_t *hist) {
+  wait->bytes_out += len;
+  while (wait->count && (int)(wait->bytes_out - wait->end[wait->begin]) >= 0) {
+    hist_add(hist, tick2us(now - wait->time[wait->begin]));
+    wait->sent_end = wait->end[wait->begin];
+    wait->begin = (wait->begin + 1) % CMD_WAIT_SLOTS;
+    --wait->count;
+  }
+}
+
+// drops the rest of a command that was sent only in part, so that a controller that reset in the
+// middle of it does not read its tail as a new command; the commands after it are kept
+static void train_cmd_cut(queue_t *train_queue, cmd_wait_t *wait) {
+  if (wait->count && wait->bytes_out != wait->sent_end) {
+    unsigned rest = wait->end[wait->begin] - wait->bytes_out;
+    queue_consume(train_queue, rest);
+    trace_event(TRACE_QUEUE_DROP, TRACE_QUEUE_TRAIN, rest);
+    wait->bytes_out = wait->sent_end = wait->end[wait->begin];
+    wait->begin = (wait->begin + 1) % CMD_WAIT_SLOTS;
+    --wait->count;
+  }
+}
+
+// set by timer interrupts when a reversal or solenoid deadline passes
+static volatile int deadline_due;
+
+static void on_deadline(void *arg) {
+  (void)arg;
+  deadline_due = 1;
+}
+
+// makes sure the loop looks at its deadlines again at the given time
+static void schedule_deadline(unsigned at, int *poll) {
+  if (!timer_at(at, on_deadline, 0)) {
+    *poll = 1;
   }
 }
 
-int main() {
+HOT int main() {
+  unsigned main_clock = timer_now();
   init_gpio();
   init_spi(0);
   init_uart(0);
+  start_io_core();
+  irq_init(IDLE_POLL);
+  prof_init();
+  trace_init();
+  console_init(CONSOLE_INFO);
   //init_timer();
 
   char user_input_line[256];
   size_t user_input_line_end = 0;
+  cmd_parser_t parser;
+  cmd_parser_init(&parser);
+  enum { INPUT_OK, INPUT_INVALID, INPUT_NO_ROOM } input_status = INPUT_OK;
 
   char scrbuf[2048], trainbuf[256];
   queue_t scr_queue, train_queue;
   queue_init(&scr_queue, scrbuf, sizeof(scrbuf) / sizeof(scrbuf[0]));
   queue_init(&train_queue, trainbuf, sizeof(trainbuf) / sizeof(trainbuf[0]));
 
-  int train_cmd_paused = 0;
   unsigned last_train_cmd_timer = 0;
 
   display_clock_t clock;
   display_clock_init(&clock);
   unsigned last_redraw_timer = 0;
 
-  train_speed_elem_t train_speeds[MAX_TRAINS];
-  size_t train_speeds_end = 0;
-
-  struct {
-    char waiting, number, speed;
-    unsigned clock_from;
-  } reversal = {0, 0, 0, 0};
+  train_table_t trains;
+  train_table_init(&trains);
+  int full_redraw = 1;
 
-  switch_status_t switch_statuses[22]; // 1-18, 153-156
+  switch_status_t switch_statuses[SWITCH_COUNT];
   memset(switch_statuses, '?', sizeof switch_statuses);
 
   struct {
@@ -253,32 +672,64 @@ int main() {
     unsigned clock_from;
   } switch_halt = {0, 0};
 
-  sensor_elem_t sensors[MAX_SENSOR_OUT];
-  memset(sensors, 0, sizeof sensors);
-  size_t sensor_list_idx = 0;
+  sensor_log_t sensor_log;
+  sensor_log_init(&sensor_log, SENSOR_WINDOW);
 
-  // keeps track of incoming (5*16) feedback bytes
-  struct {
-    char current_alp, ith_byte;
-  } sensor_update = {'A', 0};
+  const track_t *track = track_find('A');
+  velocity_t velocity;
+  velocity_init(&velocity);
+  attrib_t attrib;
+  attrib_init(&attrib);
+
+  sensor_poll_t sensor_poll;
+  sensor_poll_init(&sensor_poll);
+  sensor_health_t feedback;
+  sensor_health_init(&feedback);
+  // the controller's reset mode has to be turned on again after it reset
+  int reset_mode_due = 0;
 
   perf_data_t perf;
   memset(&perf, 0, sizeof perf);
-  perf.last_it_timer = *TIMER_CLO;
+  perf.last_it_timer = perf.window_start = timer_now();
+  perf.windowed = 1;
+  int show_prof = 0;
+  // deadlines that could not get a timer are checked on every iteration instead
+  int deadline_poll = 0;
+  core_load_t load;
+  memset(&load, 0, sizeof load);
+  terminal_t term = {TERMINAL_BAUD, TERMINAL_BAUD, 0, 0, 0};
+
+  cmd_wait_t cmd_wait;
+  memset(&cmd_wait, 0, sizeof cmd_wait);
 
   uart_putc(0, 1, 192);
   uart_puts(0, 0, CLRSCR, sizeof CLRSCR / sizeof(CLRSCR[0]) - 1);
   uart_puts(0, 0, HIDCSR, sizeof HIDCSR / sizeof(HIDCSR[0]) - 1);
 
   while (1) {
-    int blocked = reversal.waiting || switch_halt.waiting;
+    prof_begin(PROF_LOOP);
+    unsigned long long iter_start = counter_now();
+    int busy = 0;
+    unsigned irqs = irq_count();
+    int blocked = switch_halt.waiting;
+    // a deadline interrupt after this point is seen by the next iteration, whose time is later
+    int due = irq_take(&deadline_due) || deadline_poll;
     // timer updates redraw the screen
-    unsigned curr_timer = *TIMER_CLO;
+    unsigned curr_timer = timer_now();
     if (curr_timer - last_redraw_timer >= TIMER_TICK) {
+      prof_begin(PROF_FRAME);
+      busy = 1;
+      trace_event(TRACE_TIMER, TRACE_TIMER_REDRAW, 0);
       last_redraw_timer = curr_timer > last_redraw_timer ? (curr_timer / TIMER_TICK * TIMER_TICK) : TIMER_TICK_NEAREST_ROUND;
       display_clock_advance(&clock);
       char clock_buf[10];
       int clen = display_clock_sprint(&clock, clock_buf);
+      // whatever is left of the last frame is dropped, and with it maybe some train updates
+      if (queue_size(&scr_queue)) {
+        trace_event(TRACE_QUEUE_DROP, TRACE_QUEUE_SCREEN, queue_size(&scr_queue));
+        console_log(CONSOLE_DEBUG, "frame cut short, %u bytes unsent", queue_size(&scr_queue), 0);
+        full_redraw = 1;
+      }
       queue_consume(&scr_queue, sizeof scrbuf / sizeof(scrbuf[0]));
       queue_emplace_literal(&scr_queue, MOVSCR);
       queue_emplace_literal(&scr_queue, "T R A I N S\r\nSystem uptime: ");
@@ -288,163 +739,410 @@ int main() {
       queue_emplace_literal(&scr_queue, CLRLNE);
       queue_emplace_literal(&scr_queue, "Command> ");
 
-      if (blocked) {
+      if (term.confirming) {
+        char num_buf[12];
+        queue_emplace_literal(&scr_queue, "(press Enter to keep ");
+        queue_emplace(&scr_queue, num_buf, utoa(term.rate, num_buf));
+        queue_emplace_literal(&scr_queue, " baud)");
+      } else if (blocked) {
         queue_emplace_literal(&scr_queue, "(in progress)");
       } else {
         queue_emplace(&scr_queue, user_input_line, user_input_line_end);
         queue_emplace_literal(&scr_queue, "_");
+        if (input_status == INPUT_INVALID) {
+          queue_emplace_literal(&scr_queue, "  (invalid)");
+        } else if (input_status == INPUT_NO_ROOM) {
+          queue_emplace_literal(&scr_queue, "  (train queue full, try again)");
+        }
       }
 
-      draw_speeds(&scr_queue, train_speeds, train_speeds_end);
+      draw_trains(&scr_queue, &trains, &velocity, full_redraw);
       draw_switches(&scr_queue, switch_statuses);
-      draw_sensors(&scr_queue, sensors, sensor_list_idx);
+      sensor_log_expire(&sensor_log, curr_timer);
+      draw_sensors(&scr_queue, &sensor_log, &attrib);
+      unsigned refresh = 0;
+      for (size_t i = 0; i < SENSOR_BANKS; ++i) {
+        refresh = umax(refresh, curr_timer - sensor_poll.last_read[i]);
+      }
+      hist_add(&perf.hist[PERF_RF], perf.rt.refresh = tick2us(refresh));
       draw_perf(&scr_queue, &perf);
+      perf_window(&perf, curr_timer);
+      if (curr_timer - load.sampled_at >= TIMER_FREQ) {
+        core_load_sample(&load, curr_timer);
+      }
+      draw_load(&scr_queue, &load);
+      draw_boot(&scr_queue, main_clock);
+      draw_terminal(&scr_queue, &term);
+      console_update(counter_freq());
+      draw_console(&scr_queue, full_redraw);
+      full_redraw = 0;
+      if (show_prof) {
+        draw_prof(&scr_queue);
+      }
 
       queue_emplace_literal(&scr_queue, "\r\n");
       queue_emplace_literal(&scr_queue, CLRLNE);
+      prof_end(PROF_FRAME);
     }
 
-    // submit pending re-acceleration if applicable
-    if (reversal.waiting == 1 && curr_timer - reversal.clock_from >= TRAIN_ACCELERATION[(size_t)reversal.speed % 16]) {
-      reversal.waiting = 2;
-      char cmd_buf[2];
-      cmd_buf[0] = 15;
-      cmd_buf[1] = reversal.number;
-      queue_emplace(&train_queue, cmd_buf, 2);
-      reversal.clock_from = curr_timer;
-    } else if (reversal.waiting == 2 && curr_timer - reversal.clock_from >= TRAIN_ACCELERATION[0]) {
-      reversal.waiting = 0;
-      update_train_speed(reversal.number, reversal.speed, train_speeds, &train_speeds_end);
-      char cmd_buf[2];
-      cmd_buf[0] = reversal.speed;
-      cmd_buf[1] = reversal.number;
-      queue_emplace(&train_queue, cmd_buf, 2);
+    // submit pending reversals and re-accelerations if applicable
+    for (size_t i = 0; due && trains.reversing_count && i < trains.active_count; ++i) {
+      unsigned char number = trains.active[i];
+      train_state_t *s = &trains.trains[number];
+      if (s->reversing == 1 && curr_timer - s->reverse_from >= s->reverse_wait) {
+        trace_event(TRACE_TIMER, TRACE_TIMER_REVERSE, number);
+        s->reversing = 2;
+        s->reversed ^= 1;
+        s->reverse_from = curr_timer;
+        schedule_deadline(curr_timer + TRAIN_ACCELERATION[0], &deadline_poll);
+        // it kept going forward until now, and may have passed more sensors doing so
+        velocity_reverse(&velocity, number);
+        attrib_reverse(&attrib, track, &velocity, number);
+        char cmd_buf[2] = {15, number};
+        queue_train_cmd(&train_queue, &cmd_wait, cmd_buf, 2, curr_timer);
+      } else if (s->reversing == 2 && curr_timer - s->reverse_from >= TRAIN_ACCELERATION[0]) {
+        trace_event(TRACE_TIMER, TRACE_TIMER_RESUME, number);
+        s->reversing = 0;
+        --trains.reversing_count;
+        set_train_speed(&trains, number, s->resume_speed, &velocity, &attrib, curr_timer);
+        char cmd_buf[2] = {s->resume_speed, number};
+        queue_train_cmd(&train_queue, &cmd_wait, cmd_buf, 2, curr_timer);
+      }
     }
 
     // cancel solenoids after turnouts if applicable
-    if (switch_halt.waiting && curr_timer - switch_halt.clock_from >= SWITCH_TIMEOUT) {
+    if (due && switch_halt.waiting && curr_timer - switch_halt.clock_from >= SWITCH_TIMEOUT) {
+      trace_event(TRACE_TIMER, TRACE_TIMER_SOLENOID, 0);
       switch_halt.waiting = 0;
       char cmd_buf[1] = {32};
-      queue_emplace(&train_queue, cmd_buf, 1);
+      queue_train_cmd(&train_queue, &cmd_wait, cmd_buf, 1, curr_timer);
+    }
+
+    // no Enter at the new terminal rate in time, so go back to the old one
+    if (term.confirming && curr_timer - term.since >= BAUD_CONFIRM_TIMEOUT) {
+      console_log(CONSOLE_WARN, "no Enter at %u baud, back to %u", term.rate, term.fallback);
+      term.confirming = 0;
+      term.rate = term.fallback;
+      terminal_set_baud(&scr_queue, term.rate);
+      full_redraw = 1;
     }
 
     // try getting something from screen
     // (ignore chars when waiting for command to finish)
+    prof_begin(PROF_INPUT);
     char new_char[1];
     if (uart_try_getc(0, 0, new_char) && !blocked) {
-      if (new_char[0] == '\r') {
-        // do commands
-        train_command_t c = try_parse_train_command(user_input_line, user_input_line_end);
-        char cmd_buf[2];
-
-        switch (c.kind) {
-        case TRAIN_COMMAND_TR:
-          update_train_speed(c.cmd.tr.train_num, c.cmd.tr.speed, train_speeds, &train_speeds_end);
-          cmd_buf[0] = c.cmd.tr.speed;
-          cmd_buf[1] = c.cmd.tr.train_num;
-          queue_emplace(&train_queue, cmd_buf, 2);
-          break;
-        case TRAIN_COMMAND_RV: {
-          train_speed_elem_t *sp = find_train_speed(c.cmd.rv.train_num, train_speeds, train_speeds_end);
-          if (sp) {
-            reversal.waiting = 1;
-            reversal.speed = sp->speed;
-            reversal.clock_from = curr_timer;
-            sp->speed = cmd_buf[0] = (sp->speed >= 16 ? 16 : 0);
-            cmd_buf[1] = reversal.number = c.cmd.rv.train_num;
-            queue_emplace(&train_queue, cmd_buf, 2);
-          }
-          break;
+      busy = 1;
+      if (term.confirming) {
+        // anything else may be garbage from a terminal still on the old rate
+        term.confirming = new_char[0] != '\r';
+        if (!term.confirming) {
+          console_log(CONSOLE_INFO, "terminal at %u baud", term.rate, 0);
         }
-        case TRAIN_COMMAND_SW:
-          switch_statuses[switch2idx(c.cmd.sw.switch_num)] = c.cmd.sw.straight ? 'S' : 'C';
-          switch_halt.waiting = 1;
-          switch_halt.clock_from = curr_timer;
-          cmd_buf[0] = c.cmd.sw.straight ? 33 : 34;
-          cmd_buf[1] = c.cmd.sw.switch_num;
-          queue_emplace(&train_queue, cmd_buf, 2);
-          break;
-        case TRAIN_COMMAND_Q:
-          goto end;
-          break;
-        default:
-          break;
+      } else if (new_char[0] == '\r') {
+        // a line is run only as a whole, so make sure all of it fits in the train queue first
+        int count = cmd_parser_end(&parser);
+        size_t needed = 0;
+        const track_t *batch_track = track;
+        for (int k = 0; k < count; ++k) {
+          train_command_t *c = &parser.cmds[k];
+          if (c->kind == TRAIN_COMMAND_ROUTE) {
+            track_switch_t route[32];
+            int switches = track_route(batch_track, c->cmd.route.from, c->cmd.route.to, route, sizeof route / sizeof(route[0]), 0);
+            needed += switches > 0 ? 2 * switches : 0;
+          } else if (c->kind == TRAIN_COMMAND_TRACK) {
+            batch_track = track_find(c->cmd.track.name) ? track_find(c->cmd.track.name) : batch_track;
+          }
+          needed += cmd_train_bytes(c);
         }
+        if (needed > train_queue.capacity - 1 - queue_size(&train_queue)) {
+          // keep the line, so it can be submitted again once the queue drained
+          input_status = INPUT_NO_ROOM;
+          cmd_parser_init(&parser);
+          for (size_t k = 0; k < user_input_line_end; ++k) {
+            cmd_parser_feed(&parser, user_input_line[k]);
+          }
+        } else {
+          char cmd_buf[2];
+          for (int k = 0; k < count; ++k) {
+            train_command_t c = parser.cmds[k];
+            trace_event(TRACE_COMMAND, c.kind, c.cmd.tr.train_num);
+            switch (c.kind) {
+            case TRAIN_COMMAND_TR: {
+              train_state_t *s = train_get(&trains, c.cmd.tr.train_num);
+              if (s->reversing) {
+                // the new speed replaces the one the reversal would resume
+                s->reversing = 0;
+                --trains.reversing_count;
+              }
+              set_train_speed(&trains, c.cmd.tr.train_num, c.cmd.tr.speed, &velocity, &attrib, curr_timer);
+              cmd_buf[0] = c.cmd.tr.speed;
+              cmd_buf[1] = c.cmd.tr.train_num;
+              queue_train_cmd(&train_queue, &cmd_wait, cmd_buf, 2, curr_timer);
+              break;
+            }
+            case TRAIN_COMMAND_RV: {
+              unsigned char number = c.cmd.rv.train_num;
+              train_state_t *s = train_find(&trains, number);
+              if (s && !s->reversing) {
+                s->reversing = 1;
+                ++trains.reversing_count;
+                s->resume_speed = s->speed;
+                s->reverse_from = s->last_cmd_time = curr_timer;
+                s->reverse_wait = velocity_reverse_wait(&velocity, number, s->resume_speed, TRAIN_ACCELERATION[s->resume_speed % 16]);
+                console_log(CONSOLE_DEBUG, "train %u stops for %u ms before reversing", number, tick2us(s->reverse_wait) / 1000);
+                schedule_deadline(curr_timer + s->reverse_wait, &deadline_poll);
+                s->speed = cmd_buf[0] = (s->speed >= 16 ? 16 : 0);
+                cmd_buf[1] = number;
+                train_touch(&trains, number);
+                velocity_set_speed(&velocity, number, s->speed, curr_timer, 0);
+                attrib_set_speed(&attrib, number, s->speed);
+                queue_train_cmd(&train_queue, &cmd_wait, cmd_buf, 2, curr_timer);
+              }
+              break;
+            }
+            case TRAIN_COMMAND_SW:
+              switch_statuses[SWITCH_INDEX[c.cmd.sw.switch_num]] = c.cmd.sw.straight ? 'S' : 'C';
+              attrib_switch(&attrib, track, &velocity, c.cmd.sw.switch_num, !c.cmd.sw.straight);
+              switch_halt.waiting = 1;
+              switch_halt.clock_from = curr_timer;
+              schedule_deadline(curr_timer + SWITCH_TIMEOUT, &deadline_poll);
+              cmd_buf[0] = c.cmd.sw.straight ? 33 : 34;
+              cmd_buf[1] = c.cmd.sw.switch_num;
+              queue_train_cmd(&train_queue, &cmd_wait, cmd_buf, 2, curr_timer);
+              break;
+            case TRAIN_COMMAND_ROUTE: {
+              track_switch_t route[32];
+              int switches = track_route(track, c.cmd.route.from, c.cmd.route.to, route, sizeof route / sizeof(route[0]), 0);
+              for (int i = 0; i < switches; ++i) {
+                switch_statuses[SWITCH_INDEX[route[i].id]] = route[i].curved ? 'C' : 'S';
+                attrib_switch(&attrib, track, &velocity, route[i].id, route[i].curved);
+                cmd_buf[0] = route[i].curved ? 34 : 33;
+                cmd_buf[1] = route[i].id;
+                queue_train_cmd(&train_queue, &cmd_wait, cmd_buf, 2, curr_timer);
+              }
+              if (switches > 0) {
+                switch_halt.waiting = 1;
+                switch_halt.clock_from = curr_timer;
+                schedule_deadline(curr_timer + SWITCH_TIMEOUT, &deadline_poll);
+              }
+              break;
+            }
+            case TRAIN_COMMAND_TRACK:
+              if (track_find(c.cmd.track.name)) {
+                track = track_find(c.cmd.track.name);
+                attrib_unlocate(&attrib);
+              }
+              break;
+            case TRAIN_COMMAND_PROF:
+              if (c.cmd.prof.action == 'r') {
+                prof_reset();
+              } else {
+                show_prof = c.cmd.prof.action == 's';
+              }
+              break;
+            case TRAIN_COMMAND_TRACE:
+              if (c.cmd.trace.action == 'd') {
+                dump_trace();
+                // the frame is binary, so the screen has to be redrawn
+                uart_puts(0, 0, CLRSCR, sizeof CLRSCR / sizeof(CLRSCR[0]) - 1);
+                full_redraw = 1;
+              } else {
+                trace.mask ^= 1u << TRACE_SPI;
+              }
+              break;
+            case TRAIN_COMMAND_CAPTURE:
+              if (c.cmd.capture.action == 'd') {
+                dump_capture();
+                uart_puts(0, 0, CLRSCR, sizeof CLRSCR / sizeof(CLRSCR[0]) - 1);
+                full_redraw = 1;
+              } else if (capture.on) {
+                capture_stop();
+                console_log(CONSOLE_INFO, "capture stopped, %u bytes", capture.len, 0);
+              } else {
+                capture_start();
+                console_log(CONSOLE_INFO, "capture started", 0, 0);
+              }
+              break;
+            case TRAIN_COMMAND_LOG:
+              for (unsigned char level = 0; level < CONSOLE_LEVELS; ++level) {
+                if ("diwe"[level] == c.cmd.log.level) {
+                  console.level = level;
+                }
+              }
+              break;
+            case TRAIN_COMMAND_BAUD:
+              terminal_switch(&term, &scr_queue, c.cmd.baud.rate, curr_timer);
+              full_redraw = 1;
+              break;
+            case TRAIN_COMMAND_BENCH:
+              terminal_bench(&term, &scr_queue);
+              full_redraw = 1;
+              break;
+            case TRAIN_COMMAND_PERF:
+              perf.windowed = c.cmd.perf.windowed;
+              perf.window_start = curr_timer - PERF_WINDOW;  // restart now
+              perf_window(&perf, curr_timer);
+              break;
+            case TRAIN_COMMAND_Q:
+              goto end;
+              break;
+            default:
+              break;
+            }
+          }
 
-        user_input_line_end = 0;
+          user_input_line_end = 0;
+          input_status = INPUT_OK;
+          cmd_parser_init(&parser);
+        }
       } else if (new_char[0] == '\b') {
         user_input_line_end = user_input_line_end == 0 ? 0 : user_input_line_end - 1;
-      } else {
+        // the parser only goes forward, so replay what is left of the line
+        cmd_parser_init(&parser);
+        input_status = INPUT_OK;
+        for (size_t k = 0; k < user_input_line_end; ++k) {
+          if (!cmd_parser_feed(&parser, user_input_line[k])) {
+            input_status = INPUT_INVALID;
+          }
+        }
+      } else if (user_input_line_end < sizeof user_input_line) {
         user_input_line[user_input_line_end] = new_char[0];
         ++user_input_line_end;
+        if (!cmd_parser_feed(&parser, new_char[0])) {
+          input_status = INPUT_INVALID;
+        }
       }
     }
 
+    prof_end(PROF_INPUT);
+
     // try getting something from trainset feedback
+    prof_begin(PROF_FEEDBACK);
     if (uart_try_getc(0, 1, new_char)) {
-      if (sensor_update.ith_byte == 0) {
-        perf.non_responding = 0;
-        add_active_sensors_from_data(new_char[0], 0, sensor_update.current_alp, sensors, &sensor_list_idx);
-        ++sensor_update.ith_byte;
-        if (sensor_update.current_alp == 'A') {
-            perf.max.query_resp = umax(perf.max.query_resp, perf.rt.query_resp = tick2us(curr_timer - perf.last_query_timer));
+      busy = 1;
+      sensor_health_byte(&feedback, &sensor_poll, curr_timer);
+      // bytes we did not ask for are dropped
+      if (sensor_poll.waiting) {
+        if (sensor_poll.received == 0) {
+          hist_add(&perf.hist[PERF_FB], perf.rt.query_resp = tick2us(curr_timer - sensor_poll.request_time));
         }
-      } else {
-        add_active_sensors_from_data(new_char[0], 8, sensor_update.current_alp, sensors, &sensor_list_idx);
-        sensor_update.ith_byte = 0;
-        sensor_update.current_alp += 1;
-        if (sensor_update.current_alp == 'F') {
-          sensor_update.current_alp = 'A';
-          train_cmd_paused = 0;
-          perf.max.query_resp_full = umax(perf.max.query_resp_full, perf.rt.query_resp_full = tick2us(curr_timer - perf.last_query_timer));
+        size_t ith;
+        int done = sensor_poll_feed(&sensor_poll, &ith, curr_timer);
+        trace_event(TRACE_SENSOR_RX, ith, (unsigned char)new_char[0]);
+        unsigned char triggered[8];
+        int triggered_len = sensor_log_feed(&sensor_log, ith, new_char[0], curr_timer, triggered);
+        for (int i = 0; i < triggered_len; ++i) {
+          sensor_poll_hit(&sensor_poll, triggered[i]);
+          unsigned long long at_start = counter_now();
+          unsigned char train = attrib_sensor(&attrib, track, &velocity, triggered[i], curr_timer);
+          hist_add(&perf.hist[PERF_AT], counter2ns(counter_now() - at_start));
+          if (train) {
+            velocity_sensor(&velocity, track, train, triggered[i], curr_timer);
+            train_get(&trains, train)->last_sensor = triggered[i];
+            train_touch(&trains, train);
+          }
+        }
+        if (done) {
+          hist_add(&perf.hist[PERF_FF], perf.rt.query_resp_full = tick2us(curr_timer - sensor_poll.request_time));
+          if (feedback.failures >= SENSOR_HEALTH_DOWN_AFTER) {
+            console_log(CONSOLE_INFO, "track controller answering again", 0, 0);
+          }
+          sensor_health_done(&feedback, &sensor_poll, curr_timer);
         }
       }
-    } else if (train_cmd_paused && curr_timer - perf.last_query_timer >= MAX_FEEDBACK_WAIT) {
-      // if we do not receive feedback we are expecting, assume track is reset, and we reset the feeback
-      perf.non_responding = 1;
-      char cmd_buf[1] = {192};
-      if (uart_try_puts(0, 1, cmd_buf, 1)) {
-        last_train_cmd_timer = curr_timer;
-        queue_consume(&train_queue, train_queue.capacity);
-        train_cmd_paused = 0;
-        sensor_update.current_alp = 'A';
-        sensor_update.ith_byte = 0;
+    } else if (sensor_poll.waiting) {
+      // a lost or cut off reply only costs a retry of the banks it missed
+      int lost = sensor_health_check(&feedback, &sensor_poll, curr_timer);
+      if (lost != SENSOR_HEALTH_OK) {
+        if (feedback.failures <= SENSOR_HEALTH_DOWN_AFTER) {
+          trace_event(TRACE_FEEDBACK_TIMEOUT, lost == SENSOR_HEALTH_PARTIAL, sensor_poll.received);
+          if (lost == SENSOR_HEALTH_PARTIAL) {
+            console_log(CONSOLE_WARN, "feedback reply cut off after %u of %u bytes", sensor_poll.received,
+                        sensor_poll.expect);
+          } else {
+            console_log(CONSOLE_WARN, "feedback reply lost after %u ms", tick2us(curr_timer - sensor_poll.request_time) / 1000, 0);
+          }
+        }
+        sensor_poll_resync(&sensor_poll);
+        if (feedback.failures == SENSOR_HEALTH_DOWN_AFTER) {
+          // several in a row: assume the controller reset
+          console_log(CONSOLE_ERROR, "track controller not answering, turning its reset mode on again", 0, 0);
+          reset_mode_due = 1;
+          train_cmd_cut(&train_queue, &cmd_wait);
+        }
       }
     }
 
+    prof_end(PROF_FEEDBACK);
+
     // try putting something to screen
+    prof_begin(PROF_OUTPUT);
     size_t buf_len;
     char *buf_start = queue_longest_data(&scr_queue, &buf_len);
     if (buf_len) {
       buf_len = uart_try_puts(0, 0, buf_start, buf_len);
       queue_consume(&scr_queue, buf_len);
+      busy |= buf_len != 0;
     }
 
-    // try putting something to train
-    if (!train_cmd_paused && curr_timer - last_train_cmd_timer >= TRAIN_CMD_TIMEOUT) {
+    // try putting something to train; commands go out between feedback replies, and when there
+    // is none to send (or it is too early to send one) we ask for more feedback
+    if (!sensor_poll.waiting) {
       buf_start = queue_longest_data(&train_queue, &buf_len);
-      if (buf_len) {
+      // the rest of a command the uart took only in part goes first, or the controller would read
+      // whatever came in between as its tail
+      int mid_cmd = cmd_wait.bytes_out != cmd_wait.sent_end;
+      if (reset_mode_due) {
+        char cmd_buf[1] = {192};
+        if (uart_try_puts(0, 1, cmd_buf, 1)) {
+          trace_event(TRACE_TRAIN_TX, cmd_buf[0], 0);
+          reset_mode_due = 0;
+          last_train_cmd_timer = curr_timer;
+          busy = 1;
+        }
+      } else if (buf_len && (mid_cmd || curr_timer - last_train_cmd_timer >= TRAIN_CMD_TIMEOUT)) {
         // this is a design mistake: some commands need to wait for some time and then fire another
         // command, but their timers are initialized when the command is pushed to the local queue,
         // not when pushed to uart, and there is time diff between the two. ideally we want to use
         // a generic queue to contain commands, and init the timer when the command is actually
         // submitted here.
         buf_len = uart_try_puts(0, 1, buf_start, buf_len);
+        for (size_t i = 0; i < buf_len; ++i) {
+          trace_event(TRACE_TRAIN_TX, buf_start[i], 0);
+        }
         queue_consume(&train_queue, buf_len);
+        train_cmd_sent(&cmd_wait, buf_len, curr_timer, &perf.hist[PERF_QW]);
+        busy |= buf_len != 0;
         last_train_cmd_timer = curr_timer;
-      } else if (sensor_update.current_alp == 'A' && sensor_update.ith_byte == 0) {
-        // if there is no command to send and feedback is done, request feedback
-        char cmd_buf[1] = {128+5};
+      } else if (!mid_cmd && sensor_health_ready(&feedback, curr_timer)) {
+        char cmd_buf[1];
+        cmd_buf[0] = sensor_poll_next(&sensor_poll);
         if (uart_try_puts(0, 1, cmd_buf, 1)) {
-          train_cmd_paused = 1;
-          last_train_cmd_timer = curr_timer;
-          perf.last_query_timer = curr_timer;
+          trace_event(TRACE_TRAIN_TX, cmd_buf[0], 0);
+          sensor_poll_sent(&sensor_poll, curr_timer);
+          busy = 1;
         }
       }
     }
 
-    perf.max.it = umax(perf.max.it, perf.rt.it = tick2us(curr_timer - perf.last_it_timer));
+    prof_end(PROF_OUTPUT);
+
+    hist_add(&perf.hist[PERF_IT], perf.rt.it = tick2us(curr_timer - perf.last_it_timer));
     perf.last_it_timer = curr_timer;
+    prof_end(PROF_LOOP);
+    // nothing moved: sleep until a deadline or the next poll tick
+    if (!busy) {
+      irq_idle(irqs);
+    }
+    unsigned long long iter_ticks = counter_now() - iter_start;
+    load.total[0] += iter_ticks;
+    if (busy) {
+      load.busy[0] += iter_ticks;
+    }
+    if (!trains.reversing_count && !switch_halt.waiting) {
+      deadline_poll = 0;
+    }
   }
 
 end:
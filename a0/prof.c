@@ -0,0 +1,93 @@
+#include "prof.h"
+#include "util.h"
+
+#define ASSERT(x)  // TODO
+
+prof_t prof;
+
+// ARMv8 PMU event numbers
+static const unsigned PROF_EVENT_TYPES[PROF_EVENTS] = {
+  0x08,  // INST_RETIRED
+  0x03,  // L1D_CACHE_REFILL
+  0x10,  // BR_MIS_PRED
+};
+
+#ifdef __aarch64__
+#define READ_SYSREG(name, out) asm volatile("mrs %0, " #name : "=r"(out))
+#define WRITE_SYSREG(name, in) asm volatile("msr " #name ", %0" : : "r"(in))
+#define ISB() asm volatile("isb")
+#else
+// host builds (tests) have no PMU; everything reads as zero
+#define READ_SYSREG(name, out) ((out) = 0)
+#define WRITE_SYSREG(name, in) ((void)(in))
+#define ISB()
+#endif
+
+static const unsigned long PMCR_E = 1 << 0;  // enable
+static const unsigned long PMCR_P = 1 << 1;  // reset event counters
+static const unsigned long PMCR_C = 1 << 2;  // reset cycle counter
+static const unsigned long PMCR_LC = 1 << 6;  // 64 bit cycle counter
+static const unsigned long PMCNTEN_CYCLES = 1ul << 31;
+
+void prof_init(void) {
+  // select each event counter and give it its event
+  for (unsigned long i = 0; i < PROF_EVENTS; ++i) {
+    WRITE_SYSREG(pmselr_el0, i);
+    ISB();
+    WRITE_SYSREG(pmxevtyper_el0, (unsigned long)PROF_EVENT_TYPES[i]);
+  }
+  WRITE_SYSREG(pmccfiltr_el0, 0ul);  // count cycles at every exception level
+  WRITE_SYSREG(pmcntenset_el0, PMCNTEN_CYCLES | ((1ul << PROF_EVENTS) - 1));
+  WRITE_SYSREG(pmcr_el0, PMCR_E | PMCR_P | PMCR_C | PMCR_LC);
+  ISB();
+  memset(&prof, 0, sizeof prof);
+}
+
+void prof_reset(void) {
+  // the begin counters stay: a phase that is open now still ends with prof_end
+  for (size_t i = 0; i < PROF_PHASES; ++i) {
+    prof_phase_t *p = &prof.phases[i];
+    p->calls = 0;
+    p->cycles = p->max_cycles = 0;
+    memset(p->events, 0, sizeof p->events);
+  }
+}
+
+static unsigned long long read_cycles(void) {
+  unsigned long long v;
+  READ_SYSREG(pmccntr_el0, v);
+  return v;
+}
+
+static void read_events(unsigned *out) {
+  unsigned long v;
+  READ_SYSREG(pmevcntr0_el0, v);
+  out[0] = v;
+  READ_SYSREG(pmevcntr1_el0, v);
+  out[1] = v;
+  READ_SYSREG(pmevcntr2_el0, v);
+  out[2] = v;
+}
+
+void prof_begin(size_t phase) {
+  ASSERT(phase < PROF_PHASES);
+  prof_phase_t *p = &prof.phases[phase];
+  read_events(p->begin_events);
+  p->begin_cycles = read_cycles();
+}
+
+void prof_end(size_t phase) {
+  ASSERT(phase < PROF_PHASES);
+  unsigned long long cycles = read_cycles();
+  unsigned events[PROF_EVENTS];
+  read_events(events);
+  prof_phase_t *p = &prof.phases[phase];
+  cycles -= p->begin_cycles;
+  ++p->calls;
+  p->cycles += cycles;
+  p->max_cycles = cycles > p->max_cycles ? cycles : p->max_cycles;
+  // event counters are 32 bits; unsigned subtraction survives one wrap
+  for (size_t i = 0; i < PROF_EVENTS; ++i) {
+    p->events[i] += events[i] - p->begin_events[i];
+  }
+}
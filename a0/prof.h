@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stddef.h>
+
+// phases of the main loop; they may nest (SPI transfers happen inside most of the others)
+enum {
+  PROF_LOOP,  // a whole main loop iteration
+  PROF_FRAME,  // composing a screen frame
+  PROF_INPUT,  // terminal input, parsing and running commands
+  PROF_FEEDBACK,  // track controller input, sensor decoding and attribution
+  PROF_OUTPUT,  // writing the screen and train queues out
+  PROF_SPI,  // spi_send_recv, mostly waiting for the bus
+  PROF_PHASES,
+};
+
+// PMU events counted next to cycles: instructions retired, L1 data cache refills, mispredicted
+// branches
+#define PROF_EVENTS 3
+
+typedef struct {
+  unsigned calls;
+  unsigned long long cycles;
+  unsigned long long max_cycles;  // longest single call
+  unsigned long long events[PROF_EVENTS];
+  // counters when the phase was entered
+  unsigned long long begin_cycles;
+  unsigned begin_events[PROF_EVENTS];
+} prof_phase_t;
+
+/**
+ * Cycle accounting with the Cortex-A72 performance monitors.
+ *
+ * prof_begin and prof_end bracket a phase and add what the counters moved by in between to its
+ * totals. Each costs a handful of system register reads, so they can stay in the hot path.
+ * Counts are since prof_init or the last prof_reset.
+ */
+typedef struct {
+  prof_phase_t phases[PROF_PHASES];
+} prof_t;
+
+extern prof_t prof;
+
+// enables the cycle counter and event counters, and clears all totals
+void prof_init(void);
+// clears all totals; phases open at the time are still counted from when they were entered
+void prof_reset(void);
+
+void prof_begin(size_t phase);
+void prof_end(size_t phase);
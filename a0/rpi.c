@@ -1,4 +1,9 @@
 #include "rpi.h"
+#include "capture.h"
+#include "prof.h"
+#include "section.h"
+#include "spsc.h"
+#include "trace.h"
 
 struct GPIO {
   uint32_t GPFSEL[6];
@@ -60,6 +65,7 @@ struct SPI {
 static char* const MMIO_BASE = (char*)           0xFE000000;
 static char* const GPIO_BASE = (char*)(MMIO_BASE + 0x200000);
 static char* const  AUX_BASE = (char*)(GPIO_BASE +  0x15000);
+static volatile uint32_t* const TIMER_CLO = (uint32_t*)(MMIO_BASE + 0x3004);
 
 static volatile struct GPIO* const gpio  =  (struct GPIO*)(GPIO_BASE);
 static volatile struct AUX*  const aux   =   (struct AUX*)(AUX_BASE);
@@ -80,7 +86,7 @@ static const uint32_t GPIO_NONE = 0x00;
 static const uint32_t GPIO_PUP  = 0x01;
 static const uint32_t GPIO_PDP  = 0x02;
 
-static void setup_gpio(uint32_t pin, uint32_t setting, uint32_t resistor) {
+COLD static void setup_gpio(uint32_t pin, uint32_t setting, uint32_t resistor) {
   uint32_t reg   =  pin / 10;
   uint32_t shift = (pin % 10) * 3;
   uint32_t status = gpio->GPFSEL[reg];   // read status
@@ -96,11 +102,14 @@ static void setup_gpio(uint32_t pin, uint32_t setting, uint32_t resistor) {
   gpio->PUP_PDN_CNTRL_REG[reg] = status; // write back
 }
 
-void init_gpio() {
+COLD void init_gpio() {
   setup_gpio(18, GPIO_ALTFN4, GPIO_NONE);
   setup_gpio(19, GPIO_ALTFN4, GPIO_NONE);
   setup_gpio(20, GPIO_ALTFN4, GPIO_NONE);
   setup_gpio(21, GPIO_ALTFN4, GPIO_NONE);
+  // device-nGnRE lets writes complete early, and the order between two peripherals is not kept:
+  // finish the pin setup before the SPI is touched
+  asm volatile("dsb sy");
 }
 
 static const uint32_t SPI_CNTL0_DOUT_HOLD_SHIFT = 12;
@@ -135,7 +144,7 @@ static const uint32_t SPI_STAT_BUSY         = 0x00000040;
 static const uint32_t SPI_STAT_BIT_CNT_MASK = 0x0000003F;
 
 
-void init_spi(uint32_t channel) {
+COLD void init_spi(uint32_t channel) {
   uint32_t reg = aux->ENABLES;
   reg |= (2 << channel);
   aux->ENABLES = reg;
@@ -149,7 +158,12 @@ void init_spi(uint32_t channel) {
   spi[channel]->CNTL1 = SPI_CNTL1_SI_MSB_FST;
 }
 
-static void spi_send_recv(uint32_t channel, const char* sendbuf, size_t sendlen, char* recvbuf, size_t recvlen) {
+HOT static void spi_send_recv(uint32_t channel, const char* sendbuf, size_t sendlen, char* recvbuf, size_t recvlen) {
+#ifndef MULTICORE
+  // the profile and the trace ring belong to the control core
+  prof_begin(PROF_SPI);
+  trace_event(TRACE_SPI, channel, sendlen << 8 | recvlen);
+#endif
   size_t sendidx = 0;
   size_t recvidx = 0;
   while (sendidx < sendlen || recvidx < recvlen) {
@@ -181,6 +195,9 @@ static void spi_send_recv(uint32_t channel, const char* sendbuf, size_t sendlen,
       recvbuf[recvidx] = (data >> (count - 8)) & 0xFF;
     }
   }
+#ifndef MULTICORE
+  prof_end(PROF_SPI);
+#endif
 }
 
 /*************** SPI ***************/
@@ -218,17 +235,18 @@ static const char UART_FCR_TX_FIFO_RESET       = 0x04;
 static const char UART_FCR_RX_FIFO_RESET       = 0x02;
 static const char UART_FCR_FIFO_EN             = 0x01;
 static const char UART_LCR_DIV_LATCH_EN        = 0x80;
+static const char UART_LSR_TX_EMPTY            = 0x40; // THR and shift register both empty
 static const char UART_EFR_ENABLE_ENHANCED_FNS = 0x10;
 static const char UART_IOControl_RESET         = 0x08;
 
-static void uart_write_register(size_t spiChannel, size_t uartChannel, char reg, char data) {
+COLD static void uart_write_register(size_t spiChannel, size_t uartChannel, char reg, char data) {
   char req[2] = {0};
   req[0] = (uartChannel << UART_CHANNEL_SHIFT) | (reg << UART_ADDR_SHIFT);
   req[1] = data;
   spi_send_recv(spiChannel, req, 2, NULL, 0);
 }
 
-static char uart_read_register( size_t spiChannel, size_t uartChannel, char reg) {
+HOT static char uart_read_register( size_t spiChannel, size_t uartChannel, char reg) {
   char req[2] = {0};
   char res[2] = {0};
   req[0] = (uartChannel << UART_CHANNEL_SHIFT) | (reg << UART_ADDR_SHIFT) | UART_READ_ENABLE;
@@ -236,10 +254,10 @@ static char uart_read_register( size_t spiChannel, size_t uartChannel, char reg)
   return res[1];
 }
 
-static void uart_init_channel(size_t spiChannel, size_t uartChannel, size_t baudRate, int LCR) {
+COLD static void uart_init_channel(size_t spiChannel, size_t uartChannel, size_t baudRate, int LCR) {
   // set baud rate
   uart_write_register(spiChannel, uartChannel, UART_LCR, UART_LCR_DIV_LATCH_EN);
-  uint32_t bauddiv = 14745600 / (baudRate * 16);
+  uint32_t bauddiv = uart_baud_divisor(baudRate);
   uart_write_register(spiChannel, uartChannel, UART_DLH, (bauddiv & 0xFF00) >> 8);
   uart_write_register(spiChannel, uartChannel, UART_DLL, (bauddiv & 0x00FF));
 
@@ -251,14 +269,14 @@ static void uart_init_channel(size_t spiChannel, size_t uartChannel, size_t baud
   for (int i = 0; i < 65535; ++i) asm volatile("yield");
 }
 
-void init_uart(uint32_t spiChannel) {
+COLD void init_uart(uint32_t spiChannel) {
   uart_write_register(spiChannel, 0, UART_IOControl, UART_IOControl_RESET); // resets both channels
   uart_write_register(spiChannel, 1, UART_IOControl, UART_IOControl_RESET);
   uart_init_channel(spiChannel, 0, 115200, 3/*0b 11*/);
   uart_init_channel(spiChannel, 1,   2400, 7/*0b111*/);
 }
 
-int uart_try_getc(size_t spiChannel, size_t uartChannel, char *out) {
+HOT static int hw_try_getc(size_t spiChannel, size_t uartChannel, char *out) {
   if (uart_read_register(spiChannel, uartChannel, UART_RXLVL)) {
     *out = uart_read_register(spiChannel, uartChannel, UART_RHR);
     return 1;
@@ -266,7 +284,7 @@ int uart_try_getc(size_t spiChannel, size_t uartChannel, char *out) {
   return 0;
 }
 
-int uart_try_puts(size_t spiChannel, size_t uartChannel, const char* buf, size_t blen) {
+HOT static int hw_try_puts(size_t spiChannel, size_t uartChannel, const char* buf, size_t blen) {
   static const size_t max = 32;
   char temp[max];
   temp[0] = (uartChannel << UART_CHANNEL_SHIFT) | (UART_THR << UART_ADDR_SHIFT);
@@ -284,17 +302,17 @@ int uart_try_puts(size_t spiChannel, size_t uartChannel, const char* buf, size_t
   return bidx;
 }
 
-char uart_getc(size_t spiChannel, size_t uartChannel) {
+COLD static char hw_getc(size_t spiChannel, size_t uartChannel) {
   while (uart_read_register(spiChannel, uartChannel, UART_RXLVL) == 0) asm volatile("yield");
   return uart_read_register(spiChannel, uartChannel, UART_RHR);
 }
 
-void uart_putc(size_t spiChannel, size_t uartChannel, char c) {
+COLD static void hw_putc(size_t spiChannel, size_t uartChannel, char c) {
   while (uart_read_register(spiChannel, uartChannel, UART_TXLVL) == 0) asm volatile("yield");
   uart_write_register(spiChannel, uartChannel, UART_THR, c);
 }
 
-void uart_puts(size_t spiChannel, size_t uartChannel, const char* buf, size_t blen) {
+COLD static void hw_puts(size_t spiChannel, size_t uartChannel, const char* buf, size_t blen) {
   static const size_t max = 32;
   char temp[max];
   temp[0] = (uartChannel << UART_CHANNEL_SHIFT) | (UART_THR << UART_ADDR_SHIFT);
@@ -315,6 +333,252 @@ void uart_puts(size_t spiChannel, size_t uartChannel, const char* buf, size_t bl
   }
 }
 
+COLD static void hw_flush(size_t spiChannel, size_t uartChannel) {
+  while (!(uart_read_register(spiChannel, uartChannel, UART_LSR) & UART_LSR_TX_EMPTY)) asm volatile("yield");
+}
+
+// only once the transmitter is empty, since a byte half sent would be garbled
+COLD static void hw_set_divisor(size_t spiChannel, size_t uartChannel, unsigned div) {
+  hw_flush(spiChannel, uartChannel);
+  char lcr = uart_read_register(spiChannel, uartChannel, UART_LCR);
+  uart_write_register(spiChannel, uartChannel, UART_LCR, lcr | UART_LCR_DIV_LATCH_EN);
+  uart_write_register(spiChannel, uartChannel, UART_DLH, (div & 0xFF00) >> 8);
+  uart_write_register(spiChannel, uartChannel, UART_DLL, (div & 0x00FF));
+  uart_write_register(spiChannel, uartChannel, UART_LCR, lcr);
+}
+
+#ifdef MULTICORE
+static const size_t IO_SPI = 0;  // the one spi channel served by the I/O core
+
+// shared with the I/O core, see start_io_core
+static struct {
+  spsc_t rx[2], tx[2];  // by uart channel; the I/O core fills rx and drains tx
+  int running;
+  unsigned long long busy, total;  // generic timer ticks, written by the I/O core
+  // one request at a time to drain a tx ring and wait for the uart to send it, then set the
+  // divisor unless it is 0; served once done catches up with requested
+  unsigned requested, done;
+  size_t request_channel;
+  unsigned request_div;
+} io;
+
+HOT static unsigned long long io_clock() {
+  unsigned long long v;
+  asm volatile("isb; mrs %0, cntpct_el0" : "=r"(v));
+  return v;
+}
+
+COLD void start_io_core() {
+  extern char secondary_start[];
+  for (size_t i = 0; i < 2; ++i) {
+    spsc_init(&io.rx[i]);
+    spsc_init(&io.tx[i]);
+  }
+  io.busy = io.total = 0;
+  // core 1 spins in the firmware on its spin table entry at 0xE0 with the caches off, so the
+  // address has to reach memory before the event wakes it up
+  asm volatile("str %1, [%0]; dc civac, %0; dsb sy; sev" :: "r"(0xE0ul), "r"(secondary_start) : "memory");
+  while (!__atomic_load_n(&io.running, __ATOMIC_ACQUIRE)) asm volatile("yield");
+}
+
+// core 1 enters here from boot.S, and shuttles bytes between the rings and the SC16IS752
+HOT void io_core_main() {
+  __atomic_store_n(&io.running, 1, __ATOMIC_RELEASE);
+  unsigned long long last = io_clock();
+  for (;;) {
+    int moved = 0;
+    for (size_t ch = 0; ch < 2; ++ch) {
+      char c;
+      if (spsc_room(&io.rx[ch]) && hw_try_getc(IO_SPI, ch, &c)) {
+        spsc_push(&io.rx[ch], &c, 1);
+        moved = 1;
+      }
+      size_t len;
+      const char *front = spsc_front(&io.tx[ch], &len);
+      if (len) {
+        len = hw_try_puts(IO_SPI, ch, front, len);
+        spsc_consume(&io.tx[ch], len);
+        moved |= len != 0;
+      }
+    }
+    if (__atomic_load_n(&io.requested, __ATOMIC_ACQUIRE) != io.done) {
+      size_t ch = io.request_channel, len;
+      for (const char *front; (front = spsc_front(&io.tx[ch], &len), len);) {
+        spsc_consume(&io.tx[ch], hw_try_puts(IO_SPI, ch, front, len));
+      }
+      hw_flush(IO_SPI, ch);
+      if (io.request_div) {
+        hw_set_divisor(IO_SPI, ch, io.request_div);
+      }
+      __atomic_store_n(&io.done, io.done + 1, __ATOMIC_RELEASE);
+      moved = 1;
+    }
+    unsigned long long now = io_clock();
+    __atomic_store_n(&io.total, io.total + (now - last), __ATOMIC_RELAXED);
+    if (moved) {
+      __atomic_store_n(&io.busy, io.busy + (now - last), __ATOMIC_RELAXED);
+    }
+    last = now;
+  }
+}
+
+void io_core_load(unsigned long long *busy, unsigned long long *total) {
+  *busy = __atomic_load_n(&io.busy, __ATOMIC_RELAXED);
+  *total = __atomic_load_n(&io.total, __ATOMIC_RELAXED);
+}
+
+HOT static int port_try_getc(size_t spiChannel, size_t uartChannel, char *out) {
+  if (io.running) {
+    return spsc_pop(&io.rx[uartChannel], out);
+  }
+  return hw_try_getc(spiChannel, uartChannel, out);
+}
+
+// bytes the ring to the train controller may hold: one command. main.c paces train commands by
+// when they were taken here, so a deeper ring would count them sent seconds before they are
+static const size_t IO_TRAIN_DEPTH = 2;
+
+HOT static int port_try_puts(size_t spiChannel, size_t uartChannel, const char* buf, size_t blen) {
+  if (io.running) {
+    if (uartChannel == 1) {
+      size_t held = SPSC_SIZE - spsc_room(&io.tx[1]);
+      size_t room = held < IO_TRAIN_DEPTH ? IO_TRAIN_DEPTH - held : 0;
+      blen = blen < room ? blen : room;
+    }
+    return spsc_push(&io.tx[uartChannel], buf, blen);
+  }
+  return hw_try_puts(spiChannel, uartChannel, buf, blen);
+}
+
+COLD static char port_getc(size_t spiChannel, size_t uartChannel) {
+  char c;
+  if (io.running) {
+    while (!spsc_pop(&io.rx[uartChannel], &c)) asm volatile("yield");
+    return c;
+  }
+  return hw_getc(spiChannel, uartChannel);
+}
+
+COLD static void port_puts(size_t spiChannel, size_t uartChannel, const char* buf, size_t blen) {
+  if (io.running) {
+    for (size_t sent = 0; sent < blen;) {
+      sent += spsc_push(&io.tx[uartChannel], buf + sent, blen - sent);
+    }
+    return;
+  }
+  hw_puts(spiChannel, uartChannel, buf, blen);
+}
+
+COLD static void port_putc(size_t spiChannel, size_t uartChannel, char c) {
+  if (io.running) {
+    port_puts(spiChannel, uartChannel, &c, 1);
+    return;
+  }
+  hw_putc(spiChannel, uartChannel, c);
+}
+
+COLD static void io_request(size_t spiChannel, size_t uartChannel, unsigned div) {
+  if (!io.running) {
+    if (div) {
+      hw_set_divisor(spiChannel, uartChannel, div);
+    } else {
+      hw_flush(spiChannel, uartChannel);
+    }
+    return;
+  }
+  io.request_channel = uartChannel;
+  io.request_div = div;
+  unsigned seq = io.requested + 1;
+  __atomic_store_n(&io.requested, seq, __ATOMIC_RELEASE);
+  while (__atomic_load_n(&io.done, __ATOMIC_ACQUIRE) != seq) asm volatile("yield");
+}
+
+COLD void uart_flush(size_t spiChannel, size_t uartChannel) {
+  io_request(spiChannel, uartChannel, 0);
+}
+
+COLD int uart_set_baud(size_t spiChannel, size_t uartChannel, unsigned baud) {
+  unsigned div = uart_baud_divisor(baud);
+  if (div) {
+    io_request(spiChannel, uartChannel, div);
+  }
+  return div != 0;
+}
+#else
+COLD void start_io_core() {}
+
+void io_core_load(unsigned long long *busy, unsigned long long *total) {
+  *busy = *total = 0;
+}
+
+HOT static int port_try_getc(size_t spiChannel, size_t uartChannel, char *out) {
+  return hw_try_getc(spiChannel, uartChannel, out);
+}
+
+HOT static int port_try_puts(size_t spiChannel, size_t uartChannel, const char* buf, size_t blen) {
+  return hw_try_puts(spiChannel, uartChannel, buf, blen);
+}
+
+COLD static char port_getc(size_t spiChannel, size_t uartChannel) {
+  return hw_getc(spiChannel, uartChannel);
+}
+
+COLD static void port_putc(size_t spiChannel, size_t uartChannel, char c) {
+  hw_putc(spiChannel, uartChannel, c);
+}
+
+COLD static void port_puts(size_t spiChannel, size_t uartChannel, const char* buf, size_t blen) {
+  hw_puts(spiChannel, uartChannel, buf, blen);
+}
+
+COLD void uart_flush(size_t spiChannel, size_t uartChannel) {
+  hw_flush(spiChannel, uartChannel);
+}
+
+COLD int uart_set_baud(size_t spiChannel, size_t uartChannel, unsigned baud) {
+  unsigned div = uart_baud_divisor(baud);
+  if (div) {
+    hw_set_divisor(spiChannel, uartChannel, div);
+  }
+  return div != 0;
+}
+#endif
+
+HOT unsigned timer_now(void) {
+  return *TIMER_CLO;
+}
+
+// what crosses these is recorded while capture is on, see capture.h
+HOT int uart_try_getc(size_t spiChannel, size_t uartChannel, char *out) {
+  int got = port_try_getc(spiChannel, uartChannel, out);
+  if (got) {
+    capture_bytes(CAPTURE_KIND(uartChannel, CAPTURE_IN), out, 1);
+  }
+  return got;
+}
+
+HOT int uart_try_puts(size_t spiChannel, size_t uartChannel, const char* buf, size_t blen) {
+  int sent = port_try_puts(spiChannel, uartChannel, buf, blen);
+  capture_bytes(CAPTURE_KIND(uartChannel, CAPTURE_OUT), buf, sent);
+  return sent;
+}
+
+COLD char uart_getc(size_t spiChannel, size_t uartChannel) {
+  char c = port_getc(spiChannel, uartChannel);
+  capture_bytes(CAPTURE_KIND(uartChannel, CAPTURE_IN), &c, 1);
+  return c;
+}
+
+COLD void uart_putc(size_t spiChannel, size_t uartChannel, char c) {
+  port_putc(spiChannel, uartChannel, c);
+  capture_bytes(CAPTURE_KIND(uartChannel, CAPTURE_OUT), &c, 1);
+}
+
+COLD void uart_puts(size_t spiChannel, size_t uartChannel, const char* buf, size_t blen) {
+  port_puts(spiChannel, uartChannel, buf, blen);
+  capture_bytes(CAPTURE_KIND(uartChannel, CAPTURE_OUT), buf, blen);
+}
+
 /*************** TIMER ***************
 
 void init_timer() {
@@ -6,6 +6,8 @@
 void init_gpio();
 void init_spi(uint32_t channel);
 void init_uart(uint32_t spiChannel);
+// low word of the system timer, in us
+unsigned timer_now(void);
 // check if we can get a char; if yes, then write it to out
 int uart_try_getc(size_t spiChannel, size_t uartChannel, char *out);
 // try writing, returns chars actually written
@@ -13,4 +15,36 @@ int uart_try_puts(size_t spiChannel, size_t uartChannel, const char* buf, size_t
 char uart_getc(size_t spiChannel, size_t uartChannel);
 void uart_putc(size_t spiChannel, size_t uartChannel, char c);
 void uart_puts(size_t spiChannel, size_t uartChannel, const char* buf, size_t blen);
+// waits until everything written to the channel has left the uart
+void uart_flush(size_t spiChannel, size_t uartChannel);
+// changes the baud rate once everything written so far has been sent; returns 0, and keeps the
+// old rate, if uart_baud_divisor rejects the new one
+int uart_set_baud(size_t spiChannel, size_t uartChannel, unsigned baud);
+
+#define UART_CLOCK 14745600  // crystal of the SC16IS752
+
+// divisor for a baud rate, or 0 if the clock cannot make it within 1%
+static inline unsigned uart_baud_divisor(unsigned baud) {
+  if (baud == 0 || baud > UART_CLOCK / 16) {
+    return 0;
+  }
+  unsigned div = (UART_CLOCK / 16 + baud / 2) / baud;
+  if (div > 0xFFFF) {
+    return 0;
+  }
+  unsigned actual = UART_CLOCK / 16 / div;
+  unsigned error = actual > baud ? actual - baud : baud - actual;
+  return error * 100 <= baud ? div : 0;
+}
+
 //void init_timer();
+
+// Releases core 1, which from then on does all transfers on spi channel 0; the uart_* functions
+// above then only exchange bytes with it through lock-free rings. Does nothing unless built with
+// MULTICORE.
+void start_io_core();
+// generic timer ticks the I/O core spent moving bytes, and in total; both 0 without it.
+// With the I/O core, uart_try_puts returns once bytes are in its ring rather than in the uart. The
+// terminal ring is deep, but the one to the train controller holds a single command, so a train
+// command is taken at most one command before it would be without the I/O core.
+void io_core_load(unsigned long long *busy, unsigned long long *total);
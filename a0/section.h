@@ -0,0 +1,7 @@
+#pragma once
+
+// Code on the steady-state path of the main loop goes to .text.hot, which linker.ld packs at the
+// start of .text, aligned to cache lines. Code that runs once or rarely goes to .text.cold, after
+// everything else, so that it does not sit between hot functions.
+#define HOT __attribute__((section(".text.hot")))
+#define COLD __attribute__((section(".text.cold"), cold))
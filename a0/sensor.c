@@ -0,0 +1,267 @@
+#include "sensor.h"
+#include "util.h"
+
+#define ASSERT(x)  // TODO
+
+void sensor_log_init(sensor_log_t *log, unsigned window) {
+  ASSERT(log);
+  memset(log, 0, sizeof *log);
+  log->window = window;
+  log->last = SENSOR_NONE;
+  for (unsigned char i = 0; i < SENSOR_COUNT; ++i) {
+    log->order[i] = log->rank[i] = i;
+  }
+}
+
+static void swap_rank(sensor_log_t *log, unsigned char sensor, size_t pos) {
+  unsigned char other = log->order[pos];
+  size_t old_pos = log->rank[sensor];
+  log->order[old_pos] = other;
+  log->rank[other] = old_pos;
+  log->order[pos] = sensor;
+  log->rank[sensor] = pos;
+}
+
+static void window_add(sensor_log_t *log, unsigned char sensor) {
+  unsigned c = log->window_hits[sensor];
+  // first position of the run with c hits
+  swap_rank(log, sensor, log->above[c]);
+  ++log->above[c];
+  ++log->window_hits[sensor];
+}
+
+static void window_remove(sensor_log_t *log, unsigned char sensor) {
+  unsigned c = log->window_hits[sensor];
+  ASSERT(c);
+  // last position of the run with c hits
+  swap_rank(log, sensor, log->above[c - 1] - 1);
+  --log->above[c - 1];
+  --log->window_hits[sensor];
+}
+
+void sensor_log_record(sensor_log_t *log, unsigned char sensor, unsigned time) {
+  ASSERT(log);
+  ASSERT(sensor < SENSOR_COUNT);
+  if (log->head - log->window_tail == SENSOR_LOG_SIZE) {
+    // ring is full; the oldest event is about to be overwritten
+    window_remove(log, log->events[log->window_tail++ % SENSOR_LOG_SIZE].sensor);
+  }
+  sensor_event_t *ev = &log->events[log->head++ % SENSOR_LOG_SIZE];
+  ev->time = time;
+  ev->sensor = sensor;
+  window_add(log, sensor);
+
+  log->interval[sensor] = log->hits[sensor] ? time - log->last_time[sensor] : 0;
+  log->last_time[sensor] = time;
+  ++log->hits[sensor];
+  log->last = sensor;
+}
+
+void sensor_log_expire(sensor_log_t *log, unsigned now) {
+  ASSERT(log);
+  while (log->window_tail != log->head) {
+    sensor_event_t *ev = &log->events[log->window_tail % SENSOR_LOG_SIZE];
+    if (now - ev->time < log->window) {
+      break;
+    }
+    window_remove(log, ev->sensor);
+    ++log->window_tail;
+  }
+}
+
+int sensor_log_feed(sensor_log_t *log, size_t ith, char data, unsigned now, unsigned char *triggered) {
+  ASSERT(log);
+  ASSERT(ith < SENSOR_BYTES);
+  unsigned char rising = (unsigned char)data & ~log->state[ith];
+  log->state[ith] = data;
+  int count = 0;
+  // note: the track manual seems to use big endian, but the data from pi is little endian
+  // to both bytes and bits
+  for (unsigned i = 0; rising; ++i, rising <<= 1) {
+    if (rising & 0x80) {
+      unsigned char sensor = ith * 8 + i;
+      sensor_log_record(log, sensor, now);
+      if (triggered) {
+        triggered[count] = sensor;
+      }
+      ++count;
+    }
+  }
+  return count;
+}
+
+size_t sensor_log_active(sensor_log_t *log) {
+  ASSERT(log);
+  return log->above[0];
+}
+
+void sensor_poll_init(sensor_poll_t *poll) {
+  ASSERT(poll);
+  memset(poll, 0, sizeof *poll);
+}
+
+void sensor_poll_reset(sensor_poll_t *poll) {
+  ASSERT(poll);
+  poll->waiting = 0;
+  poll->plan_begin = poll->plan_end = 0;
+}
+
+void sensor_poll_resync(sensor_poll_t *poll) {
+  ASSERT(poll);
+  ASSERT(poll->waiting);
+  poll->waiting = 0;
+  if (poll->received == 0) {
+    --poll->plan_begin;  // the same request again
+    return;
+  }
+  unsigned char rest[SENSOR_BANKS];
+  size_t rest_len = poll->plan_end - poll->plan_begin;
+  memcpy(rest, poll->plan + poll->plan_begin, rest_len);
+  // a bank whose first byte arrived is asked for again as a whole
+  size_t len = 0;
+  for (size_t bank = (poll->first + poll->received) / 2; bank < (poll->first + poll->expect) / 2; ++bank) {
+    poll->plan[len++] = bank;
+  }
+  ASSERT(len + rest_len <= SENSOR_BANKS);
+  memcpy(poll->plan + len, rest, rest_len);
+  poll->plan_begin = 0;
+  poll->plan_end = len + rest_len;
+}
+
+static void plan_cycle(sensor_poll_t *poll) {
+  size_t hot = 0;
+  unsigned hot_mask = 0;
+  for (size_t i = 0; i < SENSOR_BANKS; ++i) {
+    if (poll->activity[i]) {
+      --poll->activity[i];
+      poll->plan[hot++] = i;
+      hot_mask |= 1u << i;
+    }
+  }
+  // a single bank request costs 1 + 2 bytes, a full dump costs 1 + 10 bytes
+  if (hot == 0 || (hot + 1) * 3 >= 1 + SENSOR_BYTES) {
+    poll->plan[0] = SENSOR_BANKS;  // full dump
+    poll->plan_end = 1;
+  } else {
+    // add the next cold bank so that quiet banks are still read every few cycles
+    while (hot_mask & (1u << poll->cold_cursor)) {
+      poll->cold_cursor = (poll->cold_cursor + 1) % SENSOR_BANKS;
+    }
+    poll->plan[hot++] = poll->cold_cursor;
+    poll->cold_cursor = (poll->cold_cursor + 1) % SENSOR_BANKS;
+    poll->plan_end = hot;
+  }
+  poll->plan_begin = 0;
+}
+
+char sensor_poll_next(sensor_poll_t *poll) {
+  ASSERT(poll);
+  ASSERT(!poll->waiting);
+  if (poll->plan_begin == poll->plan_end) {
+    plan_cycle(poll);
+  }
+  unsigned char bank = poll->plan[poll->plan_begin];
+  return bank == SENSOR_BANKS ? SENSOR_REQ_DUMP_ALL : SENSOR_REQ_BANK(bank);
+}
+
+void sensor_poll_sent(sensor_poll_t *poll, unsigned now) {
+  ASSERT(poll);
+  ASSERT(poll->plan_begin < poll->plan_end);
+  unsigned char bank = poll->plan[poll->plan_begin++];
+  poll->waiting = 1;
+  poll->received = 0;
+  poll->request_time = now;
+  poll->first = bank == SENSOR_BANKS ? 0 : bank * 2;
+  poll->expect = bank == SENSOR_BANKS ? SENSOR_BYTES : 2;
+}
+
+int sensor_poll_feed(sensor_poll_t *poll, size_t *ith, unsigned now) {
+  ASSERT(poll);
+  ASSERT(ith);
+  *ith = poll->first + poll->received;
+  ++poll->received;
+  if (poll->received % 2 == 0) {
+    poll->last_read[*ith / 2] = now;
+  }
+  if (poll->received == poll->expect) {
+    poll->waiting = 0;
+    return 1;
+  }
+  return 0;
+}
+
+void sensor_poll_hit(sensor_poll_t *poll, unsigned char sensor) {
+  ASSERT(poll);
+  poll->activity[sensor / SENSORS_PER_BANK] = SENSOR_POLL_HOT_CYCLES;
+}
+
+void sensor_health_init(sensor_health_t *h) {
+  ASSERT(h);
+  memset(h, 0, sizeof *h);
+  h->reply_timeout[0] = h->reply_timeout[1] = SENSOR_HEALTH_REPLY_INITIAL;
+  h->gap_timeout = SENSOR_HEALTH_GAP_INITIAL;
+}
+
+// adds a sample, and every SENSOR_HEALTH_SAMPLES of them returns the new timeout
+static unsigned health_learn(hist_t *hist, unsigned sample, unsigned timeout, unsigned min, unsigned max) {
+  hist_add(hist, sample);
+  if (hist->total % SENSOR_HEALTH_SAMPLES == 0) {
+    unsigned p99 = hist_percentile(hist, 9900);
+    timeout = p99 >= max / SENSOR_HEALTH_MULTIPLE ? max : p99 * SENSOR_HEALTH_MULTIPLE;
+    timeout = timeout < min ? min : timeout;
+    if (hist->total >= SENSOR_HEALTH_WINDOW) {
+      hist_reset(hist);
+    }
+  }
+  return timeout;
+}
+
+void sensor_health_byte(sensor_health_t *h, const sensor_poll_t *poll, unsigned now) {
+  ASSERT(h);
+  ASSERT(poll);
+  if (poll->waiting && poll->received) {
+    h->gap_timeout = health_learn(&h->gap, now - h->last_byte, h->gap_timeout, SENSOR_HEALTH_GAP_MIN, SENSOR_HEALTH_GAP_MAX);
+  }
+  h->last_byte = now;
+}
+
+void sensor_health_done(sensor_health_t *h, const sensor_poll_t *poll, unsigned now) {
+  ASSERT(h);
+  ASSERT(poll);
+  int dump = poll->expect == SENSOR_BYTES;
+  h->reply_timeout[dump] = health_learn(&h->reply[dump], now - poll->request_time, h->reply_timeout[dump],
+                                        SENSOR_HEALTH_REPLY_MIN, SENSOR_HEALTH_REPLY_MAX);
+  h->failures = 0;
+}
+
+int sensor_health_check(sensor_health_t *h, const sensor_poll_t *poll, unsigned now) {
+  ASSERT(h);
+  ASSERT(poll);
+  int result = SENSOR_HEALTH_OK;
+  if (!poll->waiting) {
+    return result;
+  } else if (poll->received == 0) {
+    if (now - poll->request_time >= h->reply_timeout[poll->expect == SENSOR_BYTES]) {
+      result = SENSOR_HEALTH_LOST;
+    }
+  } else if (now - h->last_byte >= h->gap_timeout) {
+    result = SENSOR_HEALTH_PARTIAL;
+  }
+  if (result != SENSOR_HEALTH_OK) {
+    if (h->failures < 255) {
+      ++h->failures;
+    }
+    h->draining = 1;
+    h->last_byte = now;
+  }
+  return result;
+}
+
+int sensor_health_ready(sensor_health_t *h, unsigned now) {
+  ASSERT(h);
+  if (h->draining && now - h->last_byte < h->gap_timeout) {
+    return 0;
+  }
+  h->draining = 0;
+  return 1;
+}
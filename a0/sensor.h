@@ -0,0 +1,170 @@
+#pragma once
+
+#include <stddef.h>
+
+#include "util.h"
+
+#define SENSOR_BANKS 5
+#define SENSORS_PER_BANK 16
+#define SENSOR_COUNT (SENSOR_BANKS * SENSORS_PER_BANK)
+#define SENSOR_BYTES (SENSOR_BANKS * 2)
+
+// sensors are identified by a dense id: bank * 16 + (number - 1), so A1 is 0 and E16 is 79
+#define SENSOR_ID(alp, num) (((alp) - 'A') * SENSORS_PER_BANK + (num) - 1)
+#define SENSOR_ALP(id) ('A' + (id) / SENSORS_PER_BANK)
+#define SENSOR_NUM(id) ((id) % SENSORS_PER_BANK + 1)
+#define SENSOR_NONE 0xFF
+
+// must be a power of two
+#define SENSOR_LOG_SIZE 256
+
+typedef struct {
+  unsigned time;
+  unsigned char sensor;
+} sensor_event_t;
+
+/**
+ * Fixed capacity log of sensor triggers, plus a per-sensor table.
+ *
+ * events is a ring indexed by free running counters: head is where the next event is written and
+ * window_tail is the oldest event still counted as "recent". Events leave the window either when
+ * they are older than window ticks, or when the ring wraps over them.
+ *
+ * order keeps all sensors sorted by window_hits, descending. above[c] is the number of sensors with
+ * more than c recent hits, which is also where the run of sensors with exactly c hits starts in
+ * order. Adding or removing one hit then only swaps a sensor with the edge of its run, so the
+ * ranking is kept up to date in constant time per event.
+ */
+typedef struct {
+  sensor_event_t events[SENSOR_LOG_SIZE];
+  unsigned head, window_tail;
+  unsigned window;
+
+  // per sensor statistics, kept as separate arrays
+  unsigned hits[SENSOR_COUNT];
+  unsigned last_time[SENSOR_COUNT];
+  unsigned interval[SENSOR_COUNT];  // between the last two triggers, 0 if triggered at most once
+  unsigned short window_hits[SENSOR_COUNT];
+
+  unsigned char order[SENSOR_COUNT];
+  unsigned char rank[SENSOR_COUNT];  // inverse of order
+  unsigned char above[SENSOR_LOG_SIZE + 1];
+
+  unsigned char state[SENSOR_BYTES];  // last raw feedback bytes, for edge detection
+  unsigned char last;  // most recently triggered sensor, or SENSOR_NONE
+} sensor_log_t;
+
+// window is the length of the "recent" window in timer ticks
+void sensor_log_init(sensor_log_t *, unsigned window);
+
+// records a trigger of the given sensor
+void sensor_log_record(sensor_log_t *, unsigned char sensor, unsigned time);
+
+// drops events that fell out of the window; amortized constant time
+void sensor_log_expire(sensor_log_t *, unsigned now);
+
+// feeds the ith byte (0-9) of a feedback dump and records rising edges; returns how many there
+// were, and if triggered is not null, writes their ids there (at most 8)
+int sensor_log_feed(sensor_log_t *, size_t ith, char data, unsigned now, unsigned char *triggered);
+
+// number of sensors with at least one recent hit; order[0..n) are these, most active first
+size_t sensor_log_active(sensor_log_t *);
+
+// requests understood by the track controller
+#define SENSOR_REQ_DUMP_ALL (128 + SENSOR_BANKS)
+#define SENSOR_REQ_BANK(bank) (192 + 1 + (bank))
+
+// a bank stays "hot" for this many poll cycles after one of its sensors was triggered
+#define SENSOR_POLL_HOT_CYCLES 8
+
+/**
+ * Decides which feedback requests to send.
+ *
+ * A cycle is either one dump of all banks, or single bank requests for every hot bank plus one
+ * cold bank (round robin), whichever is fewer bytes on the wire. One request is outstanding at a
+ * time; train commands can be sent between requests of a cycle.
+ */
+typedef struct {
+  unsigned char activity[SENSOR_BANKS];  // cycles left before a bank is considered cold
+  unsigned char plan[SENSOR_BANKS];  // banks still to request this cycle
+  unsigned char plan_begin, plan_end;
+  unsigned char cold_cursor;
+  unsigned char waiting;  // a request is outstanding
+  unsigned char first, expect, received;  // first byte index of the reply, reply length, bytes so far
+  unsigned request_time;
+  unsigned last_read[SENSOR_BANKS];  // time a bank was last fully received
+} sensor_poll_t;
+
+void sensor_poll_init(sensor_poll_t *);
+
+// drops any outstanding request and starts a new cycle
+void sensor_poll_reset(sensor_poll_t *);
+
+// gives up on the outstanding request: it is sent again if nothing of its reply arrived, and
+// otherwise the banks the reply did not complete are requested one by one, before the rest of the
+// cycle
+void sensor_poll_resync(sensor_poll_t *);
+
+// returns the next request byte to send; must not be called while waiting
+char sensor_poll_next(sensor_poll_t *);
+
+// marks the request returned by sensor_poll_next as sent
+void sensor_poll_sent(sensor_poll_t *, unsigned now);
+
+// accounts one reply byte; writes its byte index in the full dump (0-9) to ith, and returns
+// 1 if it completed the outstanding request
+int sensor_poll_feed(sensor_poll_t *, size_t *ith, unsigned now);
+
+// marks the bank of the sensor as hot
+void sensor_poll_hit(sensor_poll_t *, unsigned char sensor);
+
+// feedback timeouts, in system timer ticks (us)
+#define SENSOR_HEALTH_MULTIPLE 4  // of the p99 latency
+#define SENSOR_HEALTH_SAMPLES 32  // timeouts are recomputed every this many samples
+#define SENSOR_HEALTH_WINDOW 1024  // samples a distribution covers before it starts over
+#define SENSOR_HEALTH_REPLY_INITIAL 1000000
+#define SENSOR_HEALTH_REPLY_MIN 20000
+#define SENSOR_HEALTH_REPLY_MAX 5000000
+#define SENSOR_HEALTH_GAP_INITIAL 200000
+#define SENSOR_HEALTH_GAP_MIN 10000
+#define SENSOR_HEALTH_GAP_MAX 1000000
+#define SENSOR_HEALTH_DOWN_AFTER 3  // timeouts in a row before the controller is taken to have reset
+
+enum { SENSOR_HEALTH_OK, SENSOR_HEALTH_LOST, SENSOR_HEALTH_PARTIAL };
+
+/**
+ * Tells a lost feedback reply from a slow one, by how fast the controller has been answering.
+ *
+ * A request without any reply times out at SENSOR_HEALTH_MULTIPLE times the p99 of complete
+ * replies of its length (bank or full dump). Bytes of one reply follow each other at the line
+ * rate, so a reply that stops partway is caught sooner, by the time since its last byte against
+ * the p99 of those gaps. Until SENSOR_HEALTH_SAMPLES samples are in, the initial timeouts apply.
+ *
+ * After a timeout the next request waits until the line has been quiet for a gap timeout, so the
+ * rest of a late reply is not taken for the answer to it.
+ */
+typedef struct {
+  hist_t reply[2];  // request to last byte, of bank requests and full dumps
+  hist_t gap;  // between bytes of one reply
+  unsigned reply_timeout[2];
+  unsigned gap_timeout;
+  unsigned last_byte;  // time of the last byte received, asked for or not
+  unsigned char failures;  // timeouts in a row
+  unsigned char draining;  // waiting for the line to go quiet
+} sensor_health_t;
+
+void sensor_health_init(sensor_health_t *);
+
+// accounts a byte from the controller, before it is given to sensor_poll_feed
+void sensor_health_byte(sensor_health_t *, const sensor_poll_t *, unsigned now);
+
+// accounts the reply that sensor_poll_feed just completed
+void sensor_health_done(sensor_health_t *, const sensor_poll_t *, unsigned now);
+
+// SENSOR_HEALTH_LOST if the outstanding request got no reply in time, SENSOR_HEALTH_PARTIAL if
+// its reply stopped partway, SENSOR_HEALTH_OK otherwise; the poll should be resynced after a
+// timeout
+int sensor_health_check(sensor_health_t *, const sensor_poll_t *, unsigned now);
+
+// whether the next request may be sent
+int sensor_health_ready(sensor_health_t *, unsigned now);
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <stddef.h>
+
+#define SPSC_SIZE 1024  // bytes; must be a power of two
+#define SPSC_LINE 64  // cache line size of the A72
+
+/**
+ * Lock-free byte ring between one producer and one consumer, which may run on different cores.
+ *
+ * Each index is written by one side only. The producer fills the data, then publishes head with
+ * a release store; the consumer reads head with an acquire load, so it sees the data before it.
+ * tail goes back the same way, so the producer never overwrites bytes still being read. The two
+ * indices are on separate cache lines, so that each side does not keep stealing the other's.
+ * Indices run freely and are reduced modulo SPSC_SIZE on use.
+ */
+typedef struct {
+  unsigned head __attribute__((aligned(SPSC_LINE)));  // bytes ever pushed, written by the producer
+  unsigned tail __attribute__((aligned(SPSC_LINE)));  // bytes ever consumed, written by the consumer
+  char data[SPSC_SIZE] __attribute__((aligned(SPSC_LINE)));
+} spsc_t;
+
+static inline void spsc_init(spsc_t *r) {
+  r->head = r->tail = 0;
+}
+
+// producer: appends up to len bytes, returns how many fit
+static inline size_t spsc_push(spsc_t *r, const char *buf, size_t len) {
+  unsigned head = __atomic_load_n(&r->head, __ATOMIC_RELAXED);
+  unsigned tail = __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE);
+  size_t room = SPSC_SIZE - (head - tail);
+  if (len > room) {
+    len = room;
+  }
+  for (size_t i = 0; i < len; ++i) {
+    r->data[(head + i) % SPSC_SIZE] = buf[i];
+  }
+  __atomic_store_n(&r->head, head + len, __ATOMIC_RELEASE);
+  return len;
+}
+
+// producer: bytes that can be pushed right now
+static inline size_t spsc_room(spsc_t *r) {
+  return SPSC_SIZE - (__atomic_load_n(&r->head, __ATOMIC_RELAXED) - __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE));
+}
+
+// consumer: the longest run of bytes readable without wrapping; its length goes to len
+static inline const char *spsc_front(spsc_t *r, size_t *len) {
+  unsigned tail = __atomic_load_n(&r->tail, __ATOMIC_RELAXED);
+  unsigned head = __atomic_load_n(&r->head, __ATOMIC_ACQUIRE);
+  size_t start = tail % SPSC_SIZE;
+  size_t size = head - tail;
+  *len = size < SPSC_SIZE - start ? size : SPSC_SIZE - start;
+  return r->data + start;
+}
+
+// consumer: releases len bytes obtained from spsc_front
+static inline void spsc_consume(spsc_t *r, size_t len) {
+  unsigned tail = __atomic_load_n(&r->tail, __ATOMIC_RELAXED);
+  __atomic_store_n(&r->tail, tail + len, __ATOMIC_RELEASE);
+}
+
+// consumer: takes one byte if there is any
+static inline int spsc_pop(spsc_t *r, char *out) {
+  size_t len;
+  const char *front = spsc_front(r, &len);
+  if (!len) {
+    return 0;
+  }
+  *out = *front;
+  spsc_consume(r, 1);
+  return 1;
+}
@@ -0,0 +1,403 @@
+// Host benchmarks of the hot paths: queue operations, bulk copies, formatting, command parsing,
+// routing, fixed-point arithmetic, velocity updates, logging and composing a whole dashboard frame
+// with the draw_* functions of main.c.
+//
+// usage: bench.out [--rounds n] [--save baseline] [--compare baseline]
+//
+// Built with -DSIMD (SIMD=1 bench.sh), the same workloads run with the vector memcpy/memset;
+// --save with one build and --compare with the other to see the difference.
+//
+// Each benchmark is warmed up, then timed in batches sized to take about BATCH_NS each. The
+// benchmarks take turns, BATCHES batches each per round, so that a busy spell on the host does
+// not land on one of them only. ns/op is reported as the minimum and percentiles over all
+// batches. --save writes the minimums to a file, as they are the least disturbed by whatever
+// else runs; --compare checks them against one and fails if any got more than REGRESSION slower.
+// Numbers are only comparable on the same host.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// main.c is compiled in so that its static draw functions can be called
+#define main a0_main
+#include "../main.c"
+#undef main
+
+#define BATCHES 50
+#define MAX_ROUNDS 20
+#define MAX_BENCHES 32
+static const double BATCH_NS = 200000;
+static const double WARMUP_NS = 50000000;
+static const double REGRESSION = 1.15;
+static const double NOISE_NS = 1;  // differences below this are timer noise, however large relatively
+
+static double now_ns() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// keeps the compiler from dropping results
+static volatile unsigned sink;
+
+typedef struct {
+  const char *name;
+  void (*run)(unsigned n);  // runs n operations
+  unsigned n;  // operations per batch
+  size_t count;
+  double samples[MAX_ROUNDS * BATCHES];  // ns/op of each batch
+} bench_t;
+
+static bench_t benches[MAX_BENCHES];
+static size_t bench_count;
+
+static int cmp_double(const void *a, const void *b) {
+  double x = *(const double *)a, y = *(const double *)b;
+  return x < y ? -1 : x > y;
+}
+
+static double time_batch(void (*run)(unsigned), unsigned n) {
+  double start = now_ns();
+  run(n);
+  return now_ns() - start;
+}
+
+static void add(const char *name, void (*run)(unsigned)) {
+  bench_t *b = &benches[bench_count++];
+  b->name = name;
+  b->run = run;
+  b->n = 1;
+  while (time_batch(run, b->n) < BATCH_NS && b->n < 1u << 30) {
+    b->n *= 2;
+  }
+  for (double start = now_ns(); now_ns() - start < WARMUP_NS;) {
+    run(b->n);
+  }
+}
+
+static void measure_round(void) {
+  for (size_t i = 0; i < bench_count; ++i) {
+    bench_t *b = &benches[i];
+    for (size_t j = 0; j < BATCHES; ++j) {
+      b->samples[b->count++] = time_batch(b->run, b->n) / b->n;
+    }
+  }
+}
+
+static void report(void) {
+  printf("%-24s %10s %10s %10s %10s\n", "ns/op", "min", "p50", "p90", "p99");
+  for (size_t i = 0; i < bench_count; ++i) {
+    bench_t *b = &benches[i];
+    qsort(b->samples, b->count, sizeof b->samples[0], cmp_double);
+    printf("%-24s %10.1f %10.1f %10.1f %10.1f\n", b->name, b->samples[0], b->samples[b->count / 2],
+           b->samples[b->count * 9 / 10], b->samples[b->count * 99 / 100]);
+  }
+}
+
+static char qbuf[256];
+static queue_t q;
+
+static void run_queue_emplace_consume(unsigned n) {
+  static const char data[] = "\033[5;9H  24 ";
+  for (unsigned i = 0; i < n; ++i) {
+    queue_emplace(&q, data, sizeof data - 1);
+    queue_consume(&q, sizeof data - 1);
+  }
+}
+
+static void run_queue_longest_data(unsigned n) {
+  for (unsigned i = 0; i < n; ++i) {
+    size_t len;
+    sink += *queue_longest_data(&q, &len) + len;
+  }
+}
+
+// bulk paths that SIMD builds vectorize; sizes as in a frame and a histogram
+static char bulk_src[2048], bulk_dst[2048];
+
+static void run_memcpy_frame(unsigned n) {
+  for (unsigned i = 0; i < n; ++i) {
+    memcpy(bulk_dst + i % 8, bulk_src, 1500);
+    sink += bulk_dst[i % 1500];
+  }
+}
+
+static void run_memset_hist(unsigned n) {
+  static hist_t h;
+  for (unsigned i = 0; i < n; ++i) {
+    hist_reset(&h);
+    sink += h.counts[i % HIST_BUCKETS];
+  }
+}
+
+static void run_queue_emplace_line(unsigned n) {
+  static const char line[] = "\033[2K\rA01 B16 C13 D07 E01   24 at C13, next E07 in 1.2 s; 58 at B16 ";
+  for (unsigned i = 0; i < n; ++i) {
+    queue_emplace(&q, line, sizeof line - 1);
+    queue_consume(&q, sizeof line - 1);
+  }
+}
+
+static void run_utoa(unsigned n) {
+  char buf[12];
+  for (unsigned i = 0; i < n; ++i) {
+    sink += utoa(i * 2654435761u >> (i % 32), buf);
+  }
+}
+
+static void run_clock(unsigned n) {
+  static display_clock_t clock;
+  char buf[10];
+  for (unsigned i = 0; i < n; ++i) {
+    display_clock_advance(&clock);
+    sink += display_clock_sprint(&clock, buf);
+  }
+}
+
+static char *const LINES[] = {"tr 24 10", "sw 153 C", "route A1 E16", "rv 58", "tr 24 10; sw 5 C; sw 6 S"};
+static const size_t LINE_COUNT = sizeof LINES / sizeof(LINES[0]);
+
+static void run_parse(unsigned n) {
+  for (unsigned i = 0; i < n; ++i) {
+    char *line = LINES[i % LINE_COUNT];
+    cmd_parser_t p;
+    cmd_parser_init(&p);
+    for (char *c = line; *c; ++c) {
+      cmd_parser_feed(&p, *c);
+    }
+    sink += cmd_parser_end(&p);
+  }
+}
+
+static void run_track_route(unsigned n) {
+  track_switch_t sw[64];
+  for (unsigned i = 0; i < n; ++i) {
+    unsigned dist;
+    sink += track_route(&TRACKS[0], i % SENSOR_COUNT, i / SENSOR_COUNT % SENSOR_COUNT, sw, 64, &dist) + dist;
+  }
+}
+
+// operands cycle through a few values so that the branches and the divider see some variety
+static const q16_t Q16_OPS[] = {1 << 16, -(3 << 15), 12345678, 77, -987654, 1 << 24, 65, -1};
+#define Q16_OP(i) Q16_OPS[(i) % (sizeof Q16_OPS / sizeof(Q16_OPS[0]))]
+
+static void run_q16_mul(unsigned n) {
+  for (unsigned i = 0; i < n; ++i) {
+    q16_t q;
+    sink += q16_mul(Q16_OP(i), Q16_OP(i + 3), &q) + q;
+  }
+}
+
+static void run_q16_div(unsigned n) {
+  for (unsigned i = 0; i < n; ++i) {
+    q16_t q;
+    sink += q16_div(Q16_OP(i), Q16_OP(i + 3), &q) + q;
+  }
+}
+
+static void run_q32_mul(unsigned n) {
+  for (unsigned i = 0; i < n; ++i) {
+    q32_t w;
+    sink += q32_mul((q32_t)Q16_OP(i) << 20, (q32_t)Q16_OP(i + 3) << 12, &w) + w;
+  }
+}
+
+static void run_q32_div(unsigned n) {
+  for (unsigned i = 0; i < n; ++i) {
+    q32_t w;
+    sink += q32_div((q32_t)Q16_OP(i) << 20, (q32_t)Q16_OP(i + 3) << 12, &w) + w;
+  }
+}
+
+static void run_div_small(unsigned n) {
+  for (unsigned i = 0; i < n; ++i) {
+    sink += div_small(i * 2654435761u, i % FIXED_RECIP_MAX + 1);
+  }
+}
+
+static void run_isqrt(unsigned n) {
+  for (unsigned i = 0; i < n; ++i) {
+    sink += isqrt64((uint64_t)i * 2654435761u);
+  }
+}
+
+// what one sensor event costs the velocity estimate: a ratio, a mean or ema and the checks
+static void run_velocity_sensor(unsigned n) {
+  static velocity_t v;
+  static unsigned t;
+  const track_t *a = &TRACKS[0];
+  unsigned char from = SENSOR_ID('A', 1), to = SENSOR_ID('A', 3);
+  velocity_set_speed(&v, 24, 10, 0, 0);
+  for (unsigned i = 0; i < n; ++i) {
+    t += 700000 + i % 64;
+    sink += velocity_sensor(&v, a, 24, i % 2 ? to : from, t);
+  }
+}
+
+// state shown on the dashboard, filled with plausible data once
+static void run_console_log(unsigned n) {
+  for (unsigned i = 0; i < n; ++i) {
+    console_log(CONSOLE_WARN, "feedback reply cut off after %u of %u bytes", i, 10);
+  }
+  sink += console.head;
+}
+
+// a new line every frame: format it, scroll, and redraw the region within its budget
+static void run_console_frame(unsigned n) {
+  static char buf[1024];
+  static queue_t out;
+  queue_init(&out, buf, sizeof buf);
+  for (unsigned i = 0; i < n; ++i) {
+    console_log(CONSOLE_WARN, "feedback reply cut off after %u of %u bytes", i, 10);
+    console_update(54000000);
+    queue_consume(&out, sizeof buf);
+    draw_console(&out, 0);
+  }
+  sink += queue_size(&out);
+}
+
+static struct {
+  char scrbuf[2048];
+  queue_t scr;
+  train_table_t trains;
+  velocity_t velocity;
+  attrib_t attrib;
+  sensor_log_t log;
+  perf_data_t perf;
+  switch_status_t switches[SWITCH_COUNT];
+} dash;
+
+static void setup_dashboard(void) {
+  queue_init(&dash.scr, dash.scrbuf, sizeof dash.scrbuf);
+  train_table_init(&dash.trains);
+  velocity_init(&dash.velocity);
+  attrib_init(&dash.attrib);
+  sensor_log_init(&dash.log, SENSOR_WINDOW);
+  static const unsigned char numbers[] = {1, 24, 58, 74, 78, 79};
+  for (size_t i = 0; i < sizeof numbers; ++i) {
+    train_get(&dash.trains, numbers[i])->speed = 10;
+  }
+  for (unsigned i = 0; i < 200; ++i) {
+    sensor_log_record(&dash.log, i * 7 % SENSOR_COUNT, i * 1000);
+  }
+  for (unsigned i = 0; i < 10000; ++i) {
+    for (size_t h = 0; h < PERF_HISTS; ++h) {
+      hist_add(&dash.perf.hist[h], i * 37 % 5000);
+    }
+  }
+  memset(dash.switches, 'S', sizeof dash.switches);
+}
+
+static void compose_frame(int full) {
+  queue_consume(&dash.scr, sizeof dash.scrbuf);
+  queue_emplace_literal(&dash.scr, MOVSCR);
+  queue_emplace_literal(&dash.scr, "T R A I N S\r\nSystem uptime: 1:02.3\r\n");
+  queue_emplace_literal(&dash.scr, CLRLNE);
+  queue_emplace_literal(&dash.scr, "Command> tr 24_");
+  draw_trains(&dash.scr, &dash.trains, &dash.velocity, full);
+  draw_switches(&dash.scr, dash.switches);
+  draw_sensors(&dash.scr, &dash.log, &dash.attrib);
+  draw_perf(&dash.scr, &dash.perf);
+}
+
+static void run_frame_incremental(unsigned n) {
+  for (unsigned i = 0; i < n; ++i) {
+    train_touch(&dash.trains, 24);
+    compose_frame(0);
+  }
+}
+
+static void run_frame_full(unsigned n) {
+  for (unsigned i = 0; i < n; ++i) {
+    compose_frame(1);
+  }
+}
+
+static int save(const char *path) {
+  FILE *f = fopen(path, "w");
+  if (!f) {
+    perror(path);
+    return 1;
+  }
+  for (size_t i = 0; i < bench_count; ++i) {
+    fprintf(f, "%s %.2f\n", benches[i].name, benches[i].samples[0]);
+  }
+  fclose(f);
+  return 0;
+}
+
+static int compare(const char *path) {
+  FILE *f = fopen(path, "r");
+  if (!f) {
+    perror(path);
+    return 1;
+  }
+  int regressed = 0;
+  char name[64];
+  double base;
+  printf("\n%-24s %10s %10s %8s\n", "vs baseline", "before", "now", "ratio");
+  while (fscanf(f, "%63s %lf", name, &base) == 2) {
+    for (size_t i = 0; i < bench_count; ++i) {
+      if (strcmp(benches[i].name, name) == 0) {
+        double best = benches[i].samples[0], ratio = best / base;
+        int bad = ratio > REGRESSION && best - base > NOISE_NS;
+        printf("%-24s %10.1f %10.1f %8.2f%s\n", name, base, best, ratio, bad ? "  REGRESSED" : "");
+        regressed |= bad;
+      }
+    }
+  }
+  fclose(f);
+  return regressed;
+}
+
+int main(int argc, char **argv) {
+  queue_init(&q, qbuf, sizeof qbuf);
+  queue_emplace(&q, qbuf, 200);  // so that longest_data sees a wrapped queue
+  queue_consume(&q, 200);
+  queue_emplace(&q, qbuf, 100);
+  setup_dashboard();
+
+  int rounds = 4;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (strcmp(argv[i], "--rounds") == 0) {
+      rounds = atoi(argv[i + 1]);
+      rounds = rounds < 1 ? 1 : rounds > MAX_ROUNDS ? MAX_ROUNDS : rounds;
+    }
+  }
+
+  add("queue_emplace_consume", run_queue_emplace_consume);
+  add("queue_longest_data", run_queue_longest_data);
+  add("memcpy_frame", run_memcpy_frame);
+  add("memset_hist", run_memset_hist);
+  add("queue_emplace_line", run_queue_emplace_line);
+  add("utoa", run_utoa);
+  add("display_clock", run_clock);
+  add("cmd_parser", run_parse);
+  add("track_route", run_track_route);
+  add("q16_mul", run_q16_mul);
+  add("q16_div", run_q16_div);
+  add("q32_mul", run_q32_mul);
+  add("q32_div", run_q32_div);
+  add("div_small", run_div_small);
+  add("isqrt64", run_isqrt);
+  add("velocity_sensor", run_velocity_sensor);
+  add("console_log", run_console_log);
+  add("console_frame", run_console_frame);
+  add("frame_incremental", run_frame_incremental);
+  add("frame_full", run_frame_full);
+  for (int i = 0; i < rounds; ++i) {
+    measure_round();
+  }
+  report();
+
+  int status = 0;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (strcmp(argv[i], "--save") == 0) {
+      status |= save(argv[i + 1]);
+    } else if (strcmp(argv[i], "--compare") == 0) {
+      status |= compare(argv[i + 1]);
+    }
+  }
+  return status;
+}
@@ -0,0 +1,10 @@
+#/bin/bash
+# usage: [SIMD=1] bench.sh [--save baseline] [--compare baseline]
+# SIMD=1 builds the vector variants of the bulk paths, as make NEON=1 does for the kernel
+
+gcc -O2 -Wall -Wextra ../tools/trackgen.c -o trackgen.out && ./trackgen.out -p ../tracks/*.txt > track_data.out.c || exit 1
+mkdir -p gen.out && ./trackgen.out -p -h ../tracks/*.txt > gen.out/track_switches.h || exit 1
+# -fno-builtin as in the Makefile: otherwise the memset in util.c is compiled into a call to itself
+gcc -O2 -fno-builtin ${SIMD:+-DSIMD} -Wall -Wextra -I.. -Igen.out bench.c mock_rpi.c ../util.c ../command.c ../sensor.c ../track.c \
+  ../velocity.c ../fixed.c ../attrib.c ../train.c ../trace.c ../capture.c ../console.c ../prof.c track_data.out.c -o bench.out || exit 1
+./bench.out "$@"
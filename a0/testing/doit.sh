@@ -1,4 +1,7 @@
 #/bin/bash
+# -p: the tests check the code rather than the layouts, so placeholder layouts do too
 
-gcc -g -Wall -Wextra test.c ../util.c -o test.out
+gcc -O2 -Wall -Wextra ../tools/trackgen.c -o trackgen.out && ./trackgen.out -p ../tracks/*.txt > track_data.out.c || exit 1
+mkdir -p gen.out && ./trackgen.out -p -h ../tracks/*.txt > gen.out/track_switches.h || exit 1
+gcc -g ${SIMD:+-DSIMD} -Wall -Wextra -I.. -Igen.out test.c ../util.c ../command.c ../sensor.c ../track.c ../velocity.c ../fixed.c ../attrib.c ../train.c ../trace.c ../capture.c ../console.c ../prof.c track_data.out.c -o test.out
 ./test.out
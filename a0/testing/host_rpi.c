@@ -0,0 +1,193 @@
+#include "host_rpi.h"
+
+#include <setjmp.h>
+
+#include "../irq.h"
+#include "../rpi.h"
+
+#define FIFO_BYTES 64  // of each SC16IS752 channel
+#define TRY_PUTS_MAX 31  // bytes hw_try_puts sends in one transfer
+
+// main.c, renamed by the program that includes it
+int a0_main(void);
+
+host_t host = {0, 20, {115200, 2400}, 0, 0};
+
+static jmp_buf finished;
+
+static unsigned long long drained_ns[2];  // when everything written so far has left the uart
+
+static struct {
+  unsigned at;
+  timer_callback_t fn;
+  void *arg;
+} timers[TIMER_CALLBACKS];
+static size_t timer_count;
+static unsigned tick_us = 1000;
+
+unsigned boot_clock;
+
+void host_run(void) {
+  if (!setjmp(finished)) {
+    a0_main();
+  }
+}
+
+void init_gpio() {}
+void init_spi(uint32_t channel) {
+  (void)channel;
+}
+void init_uart(uint32_t spiChannel) {
+  (void)spiChannel;
+}
+void start_io_core() {}
+void io_core_load(unsigned long long *busy, unsigned long long *total) {
+  *busy = *total = 0;
+}
+
+unsigned timer_now(void) {
+  return host.now;
+}
+
+// host.now without the wrap every 71 minutes, for the uart model
+static unsigned long long now_us(void) {
+  static unsigned long long extended;
+  static unsigned last;
+  extended += host.now - last;
+  last = host.now;
+  return extended;
+}
+
+static unsigned long long byte_ns(size_t channel) {
+  return 10ull * 1000000000 / host.baud[channel];  // start, 8 data and a stop bit
+}
+
+int uart_try_getc(size_t spiChannel, size_t uartChannel, char *out) {
+  (void)spiChannel;
+  return host_input(uartChannel, out);
+}
+
+int uart_try_puts(size_t spiChannel, size_t uartChannel, const char *buf, size_t blen) {
+  (void)spiChannel;
+  unsigned long long now_ns = now_us() * 1000, per = byte_ns(uartChannel);
+  unsigned long long *drained = &drained_ns[uartChannel];
+  if (*drained < now_ns) {
+    *drained = now_ns;
+  }
+  size_t queued = (*drained - now_ns + per - 1) / per;
+  size_t n = queued < FIFO_BYTES ? FIFO_BYTES - queued : 0;
+  n = n < TRY_PUTS_MAX ? n : TRY_PUTS_MAX;
+  n = n < blen ? n : blen;
+  for (size_t i = 0; i < n; ++i) {
+    *drained += per;
+    host_output(uartChannel, buf[i], host.now, *drained / 1000);
+  }
+  return n;
+}
+
+void uart_puts(size_t spiChannel, size_t uartChannel, const char *buf, size_t blen) {
+  for (size_t sent = 0; sent < blen;) {
+    size_t n = uart_try_puts(spiChannel, uartChannel, buf + sent, blen - sent);
+    sent += n;
+    if (!n) {
+      // blocked until there is room for one more byte
+      host.now += (drained_ns[uartChannel] - (FIFO_BYTES - 1) * byte_ns(uartChannel)) / 1000 + 1 - now_us();
+    }
+  }
+}
+
+void uart_putc(size_t spiChannel, size_t uartChannel, char c) {
+  uart_puts(spiChannel, uartChannel, &c, 1);
+}
+
+char uart_getc(size_t spiChannel, size_t uartChannel) {
+  char c = 0;
+  while (!uart_try_getc(spiChannel, uartChannel, &c)) {
+    if (host_done()) {
+      longjmp(finished, 1);
+    }
+    unsigned at = host.now + 1000000;
+    host_next_input(&at);
+    host.now = (int)(at - host.now) > 0 ? at : host.now + 1;
+  }
+  return c;
+}
+
+void uart_flush(size_t spiChannel, size_t uartChannel) {
+  (void)spiChannel;
+  unsigned long long done = (drained_ns[uartChannel] + 999) / 1000, now = now_us();
+  if (done > now) {
+    host.now += done - now;
+  }
+}
+
+int uart_set_baud(size_t spiChannel, size_t uartChannel, unsigned baud) {
+  if (!uart_baud_divisor(baud)) {
+    return 0;
+  }
+  uart_flush(spiChannel, uartChannel);
+  host.baud[uartChannel] = baud;
+  return 1;
+}
+
+void irq_init(unsigned tick) {
+  tick_us = tick;
+}
+
+int timer_at(unsigned at, timer_callback_t fn, void *arg) {
+  if (timer_count == TIMER_CALLBACKS) {
+    return 0;
+  }
+  timers[timer_count].at = at;
+  timers[timer_count].fn = fn;
+  timers[timer_count].arg = arg;
+  ++timer_count;
+  return 1;
+}
+
+static void fire_timers(void) {
+  for (size_t i = 0; i < timer_count;) {
+    if ((int)(host.now - timers[i].at) >= 0) {
+      timer_callback_t fn = timers[i].fn;
+      void *arg = timers[i].arg;
+      timers[i] = timers[--timer_count];
+      fn(arg);
+    } else {
+      ++i;
+    }
+  }
+}
+
+// called once at the top of every loop iteration
+unsigned irq_count(void) {
+  ++host.iterations;
+  host.now += host.iter_us;
+  fire_timers();
+  if (host_done()) {
+    longjmp(finished, 1);
+  }
+  return 0;
+}
+
+// callbacks only run inside irq_count and irq_idle, so none can come between the read and the clear
+int irq_take(volatile int *flag) {
+  int value = *flag;
+  *flag = 0;
+  return value;
+}
+
+void irq_idle(unsigned since) {
+  (void)since;
+  unsigned wake = (host.now / tick_us + 1) * tick_us;
+  for (size_t i = 0; i < timer_count; ++i) {
+    if ((int)(timers[i].at - wake) < 0) {
+      wake = timers[i].at;
+    }
+  }
+  host_next_input(&wake);
+  if ((int)(wake - host.now) > 0) {
+    host.idle_us += wake - host.now;
+    host.now = wake;
+  }
+  fire_timers();
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+// Stand-in for rpi.c, irq.c and boot.S that runs main.c on a virtual clock, against a model of
+// the terminal and the track controller supplied by the program (replay.c, sim.c).
+//
+// Time only moves when main.c does something: every loop iteration costs host.iter_us, sleeping
+// in irq_idle skips ahead to the next tick, timer or input byte, and blocking calls wait for the
+// uart. Each channel takes bytes only as fast as its baud rate drains them out of a 64 byte FIFO.
+// The same model therefore always runs the same way.
+
+#include <stddef.h>
+
+typedef struct {
+  unsigned now;  // system timer, us
+  unsigned iter_us;  // cost of a loop iteration
+  unsigned baud[2];  // per uart channel; the terminal's follows uart_set_baud
+  unsigned long long iterations, idle_us;
+} host_t;
+
+extern host_t host;
+
+// supplied by the model: the next byte on a channel that has arrived by host.now, if any
+int host_input(size_t channel, char *out);
+
+// supplied by the model: lowers *at to the next time the model has something to deliver
+void host_next_input(unsigned *at);
+
+// supplied by the model: main.c wrote a byte, which the uart took at written and has sent out by
+// sent
+void host_output(size_t channel, unsigned char c, unsigned written, unsigned sent);
+
+// supplied by the model: checked at the top of every loop iteration, the run ends once it is
+// nonzero
+int host_done(void);
+
+// runs main.c from the start until host_done or until it returns
+void host_run(void);
@@ -0,0 +1,81 @@
+// Stand-in for rpi.c, irq.c and boot.S on the host: the terminal and the track controller are
+// never ready to send anything, and accept everything written to them; timers never fire.
+
+#include "../irq.h"
+#include "../rpi.h"
+
+unsigned boot_clock;
+
+void init_gpio() {}
+void init_spi(uint32_t channel) {
+  (void)channel;
+}
+void init_uart(uint32_t spiChannel) {
+  (void)spiChannel;
+}
+
+unsigned timer_now(void) {
+  return 0;
+}
+
+int uart_try_getc(size_t spiChannel, size_t uartChannel, char *out) {
+  (void)spiChannel, (void)uartChannel, (void)out;
+  return 0;
+}
+
+int uart_try_puts(size_t spiChannel, size_t uartChannel, const char *buf, size_t blen) {
+  (void)spiChannel, (void)uartChannel, (void)buf;
+  return blen;
+}
+
+char uart_getc(size_t spiChannel, size_t uartChannel) {
+  (void)spiChannel, (void)uartChannel;
+  return 0;
+}
+
+void uart_putc(size_t spiChannel, size_t uartChannel, char c) {
+  (void)spiChannel, (void)uartChannel, (void)c;
+}
+
+void uart_puts(size_t spiChannel, size_t uartChannel, const char *buf, size_t blen) {
+  (void)spiChannel, (void)uartChannel, (void)buf, (void)blen;
+}
+
+void uart_flush(size_t spiChannel, size_t uartChannel) {
+  (void)spiChannel, (void)uartChannel;
+}
+
+int uart_set_baud(size_t spiChannel, size_t uartChannel, unsigned baud) {
+  (void)spiChannel, (void)uartChannel;
+  return uart_baud_divisor(baud) != 0;
+}
+
+void start_io_core() {}
+
+void io_core_load(unsigned long long *busy, unsigned long long *total) {
+  *busy = *total = 0;
+}
+
+void irq_init(unsigned tick_us) {
+  (void)tick_us;
+}
+
+int timer_at(unsigned at, timer_callback_t fn, void *arg) {
+  (void)at, (void)fn, (void)arg;
+  return 1;
+}
+
+unsigned irq_count(void) {
+  return 0;
+}
+
+// no callback ever runs
+int irq_take(volatile int *flag) {
+  int value = *flag;
+  *flag = 0;
+  return value;
+}
+
+void irq_idle(unsigned since) {
+  (void)since;
+}
@@ -0,0 +1,292 @@
+// Replays a session recorded with "cap s" ... "cap d" (see capture.h) through main.c on the host,
+// and compares what it does with what was recorded.
+//
+// usage: replay.out [--iter-us n] capture
+//
+// The capture is whatever was read from the terminal around "cap d", e.g. with
+// `cat /dev/ttyUSB0 > capture`; everything before the frame is skipped. Start capturing right
+// after boot, so that the program starts out in the state the recording did.
+//
+// main.c runs on the virtual clock of host_rpi.c, with loop iterations costing --iter-us (default
+// 20), and gets the recorded input bytes at their recorded times. The same capture therefore
+// always replays the same way, which makes a recorded session a benchmark:
+// * iterations and host time per iteration;
+// * bytes written per channel, recorded against replayed;
+// * commands sent to the track controller (sensor requests aside), and the first one that differs;
+// * time from Enter on the terminal to the track command it caused.
+
+#include <err.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define main a0_main
+#include "../main.c"
+#undef main
+
+#include "host_rpi.h"
+
+#define MAX_RECORDS (CAPTURE_SIZE / CAPTURE_HEADER_BYTES)
+#define MAX_COMMANDS 65536
+#define TAIL_US 1000000  // replay continues this long after the last recorded byte
+
+typedef struct {
+  unsigned time;
+  unsigned char kind, len;
+  const unsigned char *data;
+} record_t;
+
+static record_t records[MAX_RECORDS];
+static size_t record_count;
+
+// a command to the track controller: its bytes and when the first one was written
+typedef struct {
+  unsigned time;
+  unsigned char len, bytes[2];
+} command_t;
+
+typedef struct {
+  command_t commands[MAX_COMMANDS];
+  size_t count;
+  size_t sensor_requests;
+  unsigned char pending[2];  // bytes of a command still being written
+  unsigned char pending_len, pending_need;
+  unsigned pending_time;
+  unsigned long long out_bytes[2];
+  unsigned enters[MAX_COMMANDS];  // times Enter arrived on the terminal
+  size_t enter_count;
+} session_t;
+
+static session_t recorded, replayed;
+
+// splits what was written to the track controller into commands, see the Marklin protocol
+static void train_byte(session_t *s, unsigned char b, unsigned time) {
+  if (s->pending_len == 0) {
+    s->pending_time = time;
+    s->pending_need = b < 32 || b == 33 || b == 34 ? 2 : 1;  // speed and switch commands take a number
+    if (b >= 128) {
+      ++s->sensor_requests;
+      return;
+    }
+  }
+  s->pending[s->pending_len++] = b;
+  if (s->pending_len == s->pending_need) {
+    if (s->count < MAX_COMMANDS) {
+      command_t *c = &s->commands[s->count++];
+      c->time = s->pending_time;
+      c->len = s->pending_len;
+      memcpy(c->bytes, s->pending, s->pending_len);
+    }
+    s->pending_len = 0;
+  }
+}
+
+static void session_bytes(session_t *s, size_t channel, int out, const unsigned char *data, size_t len,
+                          unsigned time) {
+  if (out) {
+    s->out_bytes[channel] += len;
+  }
+  for (size_t i = 0; data && i < len; ++i) {
+    if (out && channel == 1) {
+      train_byte(s, data[i], time);
+    } else if (!out && channel == 0 && data[i] == '\r' && s->enter_count < MAX_COMMANDS) {
+      s->enters[s->enter_count++] = time;
+    }
+  }
+}
+
+static unsigned get_word(const unsigned char *p) {
+  return p[0] | p[1] << 8 | p[2] << 16 | (unsigned)p[3] << 24;
+}
+
+static void load(const char *path) {
+  FILE *in = fopen(path, "rb");
+  if (!in) {
+    err(1, "%s", path);
+  }
+  static unsigned char data[CAPTURE_SIZE * 2];
+  size_t len = fread(data, 1, sizeof data, in);
+  fclose(in);
+
+  size_t at = 0;
+  while (at + 8 <= len && get_word(data + at) != 0x31504143) {  // "CAP1"
+    ++at;
+  }
+  if (at + 8 > len) {
+    errx(1, "no capture frame found");
+  }
+  size_t bytes = get_word(data + at + 4);
+  const unsigned char *p = data + at + 8, *end = p + bytes;
+  if (at + 8 + bytes + 4 > len) {
+    errx(1, "frame is cut short: %zu bytes announced", bytes);
+  }
+  unsigned sum = 0;
+  for (size_t i = 0; i < bytes; ++i) {
+    sum += p[i];
+  }
+  if (sum != get_word(end)) {
+    warnx("checksum mismatch, the frame is corrupted");
+  }
+  while (p + CAPTURE_HEADER_BYTES <= end && record_count < MAX_RECORDS) {
+    record_t *r = &records[record_count++];
+    r->time = get_word(p);
+    r->kind = p[4];
+    r->len = p[5];
+    // the screen's bytes are only counted
+    int counted = r->kind == CAPTURE_KIND(0, CAPTURE_OUT);
+    r->data = counted ? 0 : p + CAPTURE_HEADER_BYTES;
+    p += CAPTURE_HEADER_BYTES + (counted ? 0 : r->len);
+    session_bytes(&recorded, r->kind >> 1, r->kind & CAPTURE_OUT, r->data, r->len, r->time);
+  }
+  if (p != end) {
+    errx(1, "records do not add up to the frame");
+  }
+}
+
+/*************** the model for host_rpi.c ***************/
+
+static unsigned finish_at;
+
+static struct {
+  size_t record, byte;  // next input byte
+} input[2];
+
+// the next input byte of a channel, whether or not it has arrived yet
+static const record_t *next_input(size_t channel) {
+  while (input[channel].record < record_count) {
+    const record_t *r = &records[input[channel].record];
+    if (r->kind == CAPTURE_KIND(channel, CAPTURE_IN) && input[channel].byte < r->len) {
+      return r;
+    }
+    ++input[channel].record;
+    input[channel].byte = 0;
+  }
+  return 0;
+}
+
+int host_input(size_t channel, char *out) {
+  const record_t *r = next_input(channel);
+  if (!r || (int)(host.now - r->time) < 0) {
+    return 0;
+  }
+  *out = r->data[input[channel].byte++];
+  session_bytes(&replayed, channel, 0, (const unsigned char *)out, 1, host.now);
+  return 1;
+}
+
+void host_next_input(unsigned *at) {
+  for (size_t ch = 0; ch < 2; ++ch) {
+    const record_t *r = next_input(ch);
+    if (r && (int)(r->time - *at) < 0) {
+      *at = r->time;
+    }
+  }
+}
+
+void host_output(size_t channel, unsigned char c, unsigned written, unsigned sent) {
+  (void)sent;
+  session_bytes(&replayed, channel, 1, &c, 1, written);
+}
+
+int host_done(void) {
+  return !next_input(0) && !next_input(1) && (int)(host.now - finish_at) >= 0;
+}
+
+/*************** report ***************/
+
+static void command_latency(const session_t *s, const char *name) {
+  unsigned long long total = 0;
+  unsigned max = 0, count = 0;
+  size_t c = 0;
+  for (size_t i = 0; i < s->enter_count; ++i) {
+    unsigned at = s->enters[i];
+    while (c < s->count && (int)(s->commands[c].time - at) < 0) {
+      ++c;
+    }
+    // a line that sent nothing before the next Enter did not cause a command
+    int next = i + 1 < s->enter_count;
+    if (c < s->count && (!next || (int)(s->commands[c].time - s->enters[i + 1]) < 0)) {
+      unsigned latency = s->commands[c].time - at;
+      total += latency;
+      max = latency > max ? latency : max;
+      ++count;
+    }
+  }
+  printf("%-10s %6zu lines, %6u sent a command: Enter to command %8.0f us mean, %8u us max\n", name,
+         s->enter_count, count, count ? (double)total / count : 0.0, max);
+}
+
+static void print_command(const command_t *c) {
+  if (c->len == 2) {
+    printf("%3u %3u at %u us", c->bytes[0], c->bytes[1], c->time);
+  } else {
+    printf("%3u     at %u us", c->bytes[0], c->time);
+  }
+}
+
+int main(int argc, char **argv) {
+  const char *path = 0;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--iter-us") == 0 && i + 1 < argc) {
+      host.iter_us = atoi(argv[++i]);
+      host.iter_us = host.iter_us ? host.iter_us : 1;
+    } else {
+      path = argv[i];
+    }
+  }
+  if (!path) {
+    errx(2, "usage: replay.out [--iter-us n] capture");
+  }
+  load(path);
+  if (!record_count) {
+    errx(1, "the capture is empty");
+  }
+  // boot a moment before the first recorded byte
+  host.now = records[0].time - 100000;
+  finish_at = records[record_count - 1].time + TAIL_US;
+
+  struct timespec start, end;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  host_run();
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  double host_ns = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+
+  unsigned span = records[record_count - 1].time - records[0].time;
+  printf("%zu records over %.3f s; replayed %llu iterations at %u us each, idle %.1f%%, %.0f host ns/iteration\n",
+         record_count, span / 1e6, host.iterations, host.iter_us,
+         100.0 * host.idle_us / (host.now - records[0].time + 100000),
+         host.iterations ? host_ns / host.iterations : 0.0);
+  printf("%-10s %12s %12s %10s %10s\n", "", "screen B", "track B", "commands", "sensor rq");
+  printf("%-10s %12llu %12llu %10zu %10zu\n", "recorded", recorded.out_bytes[0], recorded.out_bytes[1],
+         recorded.count, recorded.sensor_requests);
+  printf("%-10s %12llu %12llu %10zu %10zu\n", "replayed", replayed.out_bytes[0], replayed.out_bytes[1],
+         replayed.count, replayed.sensor_requests);
+  command_latency(&recorded, "recorded");
+  command_latency(&replayed, "replayed");
+
+  size_t same = 0;
+  while (same < recorded.count && same < replayed.count
+         && recorded.commands[same].len == replayed.commands[same].len
+         && memcmp(recorded.commands[same].bytes, replayed.commands[same].bytes, recorded.commands[same].len) == 0) {
+    ++same;
+  }
+  if (same == recorded.count && same == replayed.count) {
+    printf("track commands match the recording\n");
+    return 0;
+  }
+  printf("track commands diverge at command %zu:\n  recorded ", same);
+  if (same < recorded.count) {
+    print_command(&recorded.commands[same]);
+  } else {
+    printf("(none)");
+  }
+  printf("\n  replayed ");
+  if (same < replayed.count) {
+    print_command(&replayed.commands[same]);
+  } else {
+    printf("(none)");
+  }
+  printf("\n");
+  return 1;
+}
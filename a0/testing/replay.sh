@@ -0,0 +1,10 @@
+#/bin/bash
+# usage: replay.sh [--iter-us n] capture
+# replays a session recorded with "cap s" and "cap d" through main.c, see replay.c
+
+gcc -O2 -Wall -Wextra ../tools/trackgen.c -o trackgen.out && ./trackgen.out -p ../tracks/*.txt > track_data.out.c || exit 1
+mkdir -p gen.out && ./trackgen.out -p -h ../tracks/*.txt > gen.out/track_switches.h || exit 1
+# -fno-builtin as in the Makefile: otherwise the memset in util.c is compiled into a call to itself
+gcc -O2 -fno-builtin -Wall -Wextra -I.. -Igen.out replay.c host_rpi.c ../util.c ../command.c ../sensor.c ../track.c \
+  ../velocity.c ../fixed.c ../attrib.c ../train.c ../trace.c ../capture.c ../console.c ../prof.c track_data.out.c -o replay.out || exit 1
+./replay.out "$@"
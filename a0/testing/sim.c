@@ -0,0 +1,575 @@
+// Simulates the track controller on uart channel 1, and a user typing on the terminal, to load
+// test main.c on the host with more trains than there are.
+//
+// usage: sim.out [--trains n] [--seconds n] [--track A] [--interval ms] [--iter-us n] [--seed n]
+//
+// main.c runs on the virtual clock of host_rpi.c. The controller takes the bytes main.c writes to
+// it as they come out of the uart at 2400 baud, and decodes them as the Marklin controller does:
+// speed and reverse (0-31, then a train), solenoid off (32), switches (33/34, then a switch),
+// reset mode (192), and sensor dumps of all banks up to n (128+n) or of bank n (192+n). Replies
+// go back at 2400 baud, after SENSOR_DELAY_US.
+//
+// Trains move over the layout from track_data, at SPEED_STEP_MM_S per speed level, and speed up
+// and slow down at between ACCEL_MIN_MM_S2 and ACCEL_MAX_MM_S2, depending on the train. They
+// follow the switches as the controller set them, and turn around at the ends of the track. A
+// train passing a sensor sets its bit until a dump reads it; in reset mode the dump clears it.
+// Trains start on sensors spread over the layout.
+//
+// The user sets the trains going one at a time, each once main.c has located the one before (or
+// START_US after it), and meanwhile types a random command every --interval ms (500 by default)
+// for the trains already located: mostly speed changes, some stops, reversals and switches. After
+// a switch they wait for the prompt to come back.
+//
+// The report gives:
+// * iterations, idle time and host time per iteration;
+// * what the controller received;
+// * reversals, how many were sent while the train still moved, and the time from "rv" to them;
+//   split by whether main.c waited a learned stop time, shorter than TRAIN_ACCELERATION, or that;
+// * sensor triggers, how many were merged into a bit already set, reported in replies, and read by
+//   main.c as rising edges;
+// * how many typed lines reached the controller, and the time from Enter until they did.
+
+#include <err.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define main a0_main
+#include "../main.c"
+#undef main
+
+#include "host_rpi.h"
+
+#define SIM_TRAINS_MAX 64
+#define SPEED_STEP_MM_S 40  // per speed level
+#define ACCEL_MIN_MM_S2 120
+#define ACCEL_MAX_MM_S2 400
+#define MOVING_MM_S 1  // reversing faster than this derails trains
+#define RV_MATCH_US 10000000  // an "rv" whose reversal takes longer was cancelled
+#define STEP_US 1000  // trains move at most this long in one go
+#define SENSOR_DELAY_US 1500  // from a request arriving to the first byte of its reply
+#define SOLENOID_MAX_US 500000  // longer than this burns solenoids
+#define RING 4096  // bytes in flight each way; must be a power of two
+#define MAX_LINES 65536
+#define START_US 6000000  // at most between starting trains, if the last one is still not located
+#define MATCH_US 5000000  // a typed line that takes longer counts as lost
+
+/*************** the track controller ***************/
+
+typedef struct {
+  unsigned char number;
+  unsigned char node, dir;  // on the edge out of node in dir
+  double pos;  // mm along the edge
+  double velocity;  // mm/s
+  unsigned char speed;  // 0-14
+  double accel;  // mm/s^2
+  unsigned rv_enter;  // when "rv" was typed for it, 0 if not reversing
+  unsigned rv_static;  // the static wait for the speed it had then
+  char located;  // passed a sensor since it was set going, so main.c knows where it is
+} sim_train_t;
+
+typedef struct {
+  unsigned time;
+  unsigned char byte, ith;  // ith: index in a full dump, for replies
+} timed_byte_t;
+
+static struct {
+  const track_t *track;
+  sim_train_t trains[SIM_TRAINS_MAX];
+  size_t train_count;
+  unsigned char curved[256];  // by switch id
+  unsigned solenoid_on;  // when a switch was last thrown, if the solenoid is still on
+  char solenoid;
+  unsigned now;  // how far the simulation got
+
+  unsigned char latched[SENSOR_BYTES];
+  char reset_mode;
+
+  timed_byte_t in[RING];  // from main.c, at the time they are through the uart
+  unsigned in_head, in_tail;
+  timed_byte_t out[RING];  // replies
+  unsigned out_head, out_tail;
+  unsigned out_free;  // when the controller is done sending what it has queued
+  unsigned char pending[2], pending_len;
+
+  unsigned long long received[8];
+  unsigned long long triggers, merged, reported, read;
+  unsigned long long end_turns, solenoid_burns, moving_reversals;
+  hist_t reversal;  // from "rv" to the reverse command
+  unsigned long long reversal_us;  // sum of those
+  unsigned long long learned_waits, learned_us, static_waits, static_us;  // the same, split
+  unsigned char read_state[SENSOR_BYTES];  // as main.c last read each byte
+} sim;
+
+enum { RX_SPEED, RX_REVERSE, RX_SWITCH, RX_SOLENOID_OFF, RX_DUMP, RX_BANK, RX_RESET_MODE, RX_OTHER };
+static const char *const RX_NAMES[] = {"speed", "reverse", "switch", "solenoid off", "dump", "bank", "reset mode", "other"};
+
+static unsigned byte_us(void) {
+  return 10 * 1000000 / host.baud[1];
+}
+
+static sim_train_t *find_train(unsigned char number) {
+  for (size_t i = 0; i < sim.train_count; ++i) {
+    if (sim.trains[i].number == number) {
+      return &sim.trains[i];
+    }
+  }
+  return 0;
+}
+
+// turns a train around where it is: onto the reverse of the edge it is on
+static void turn_around(sim_train_t *t) {
+  const track_t *tr = sim.track;
+  unsigned char to = tr->edge[t->node][t->dir];
+  unsigned char back = to ^ 1, target = t->node ^ 1;
+  for (unsigned char d = 0; d < 2; ++d) {
+    if (tr->edge[back][d] == target) {
+      t->pos = tr->edge_dist[back][d] - t->pos;
+      t->node = back;
+      t->dir = d;
+      return;
+    }
+  }
+}
+
+static void trigger(unsigned char sensor) {
+  unsigned char bit = 0x80 >> (sensor % 8);
+  ++sim.triggers;
+  if (sim.latched[sensor / 8] & bit) {
+    ++sim.merged;
+  }
+  sim.latched[sensor / 8] |= bit;
+}
+
+static void move_train(sim_train_t *t, double dt) {
+  const track_t *tr = sim.track;
+  double target = t->speed * SPEED_STEP_MM_S;
+  if (t->velocity < target) {
+    t->velocity = t->velocity + t->accel * dt < target ? t->velocity + t->accel * dt : target;
+  } else if (t->velocity > target) {
+    t->velocity = t->velocity - t->accel * dt > target ? t->velocity - t->accel * dt : target;
+  }
+  t->pos += t->velocity * dt;
+  while (t->pos >= tr->edge_dist[t->node][t->dir]) {
+    t->pos -= tr->edge_dist[t->node][t->dir];
+    t->node = tr->edge[t->node][t->dir];
+    t->dir = TRACK_AHEAD;
+    switch (tr->node_type[t->node]) {
+    case TRACK_NODE_SENSOR:
+      trigger(tr->node_num[t->node]);
+      t->located = 1;
+      break;
+    case TRACK_NODE_BRANCH:
+      t->dir = sim.curved[tr->node_num[t->node]] ? TRACK_CURVED : TRACK_STRAIGHT;
+      break;
+    case TRACK_NODE_EXIT:
+      // as if picked up and put back the other way
+      t->node ^= 1;
+      ++sim.end_turns;
+      break;
+    }
+  }
+}
+
+static void move_trains(unsigned to) {
+  while ((int)(to - sim.now) > 0) {
+    unsigned step = to - sim.now < STEP_US ? to - sim.now : STEP_US;
+    for (size_t i = 0; i < sim.train_count; ++i) {
+      move_train(&sim.trains[i], step / 1e6);
+    }
+    sim.now += step;
+  }
+}
+
+static void reply(unsigned char first_bank, unsigned char banks) {
+  unsigned at = (int)(sim.out_free - sim.now) > 0 ? sim.out_free : sim.now + SENSOR_DELAY_US;
+  for (unsigned char i = first_bank * 2; i < (first_bank + banks) * 2; ++i) {
+    at += byte_us();
+    timed_byte_t *b = &sim.out[sim.out_head++ % RING];
+    b->time = at;
+    b->byte = sim.latched[i];
+    b->ith = i;
+    sim.reported += __builtin_popcount(sim.latched[i]);
+    if (sim.reset_mode) {
+      sim.latched[i] = 0;
+    }
+  }
+  sim.out_free = at;
+}
+
+static void command(unsigned char *cmd, unsigned char len, unsigned time);
+
+static void receive(unsigned char c, unsigned time) {
+  if (sim.pending_len == 0) {
+    if (c >= 128) {
+      if (c == 192) {
+        ++sim.received[RX_RESET_MODE];
+        sim.reset_mode = 1;
+      } else if (c > 128 && c <= 128 + SENSOR_BANKS) {
+        ++sim.received[RX_DUMP];
+        reply(0, c - 128);
+      } else if (c > 192 && c <= 192 + SENSOR_BANKS) {
+        ++sim.received[RX_BANK];
+        reply(c - 193, 1);
+      } else {
+        ++sim.received[RX_OTHER];
+      }
+      return;
+    } else if (c == 32) {
+      ++sim.received[RX_SOLENOID_OFF];
+      sim.solenoid = 0;
+      return;
+    } else if (c > 34) {
+      ++sim.received[RX_OTHER];
+      return;
+    }
+  }
+  sim.pending[sim.pending_len++] = c;
+  if (sim.pending_len == 2) {
+    sim.pending_len = 0;
+    command(sim.pending, 2, time);
+  }
+}
+
+static void controller_advance(void) {
+  // bytes from main.c take effect in order, with the trains moved up to each
+  while (sim.in_tail != sim.in_head && (int)(sim.in[sim.in_tail % RING].time - host.now) <= 0) {
+    timed_byte_t *b = &sim.in[sim.in_tail++ % RING];
+    move_trains(b->time);
+    receive(b->byte, b->time);
+  }
+  move_trains(host.now);
+  if (sim.solenoid && sim.now - sim.solenoid_on > SOLENOID_MAX_US) {
+    ++sim.solenoid_burns;
+    sim.solenoid = 0;
+  }
+}
+
+/*************** the user ***************/
+
+typedef struct {
+  unsigned enter;  // when Enter was typed
+  unsigned char bytes[2];  // the command it should make main.c send
+  char done;
+} typed_line_t;
+
+static struct {
+  typed_line_t lines[MAX_LINES];
+  size_t count, matched;
+  char text[32];
+  size_t len, at;  // the line being typed, 0 until one is picked, and the next byte of it
+  unsigned next;  // when its next byte is typed
+  unsigned after;  // pause after it
+  char command;  // whether it makes main.c send a command; "track" does not
+  sim_train_t *reverses;  // the train if it is "rv"
+  unsigned interval;
+  unsigned long long seed;
+  unsigned started;  // trains set going so far
+  unsigned started_at;  // when the last of them was
+  unsigned last_rv[SIM_TRAINS_MAX];
+  hist_t latency;
+} user;
+
+static unsigned user_rand(unsigned n) {
+  // xorshift64, so that runs do not depend on the libc
+  user.seed ^= user.seed << 13;
+  user.seed ^= user.seed >> 7;
+  user.seed ^= user.seed << 17;
+  return user.seed % n;
+}
+
+// picks the next line and how long to pause after it; 0 if there is nothing to type yet
+static int next_line(void) {
+  typed_line_t *l = &user.lines[user.count < MAX_LINES ? user.count : MAX_LINES - 1];
+  // two trains moving before main.c has seen either would leave it unable to tell them apart
+  size_t located = user.started ? user.started - !sim.trains[user.started - 1].located : 0;
+  int start = user.started < sim.train_count && (located == user.started || sim.now - user.started_at >= START_US);
+  if (!start && !located) {
+    return 0;
+  }
+  size_t i = start ? user.started : user_rand(located);
+  sim_train_t *t = &sim.trains[i];
+  unsigned roll = start ? 0 : user_rand(10);
+  user.after = user.interval;
+  char *p = user.text;
+  user.reverses = 0;
+  if (roll == 8 && sim.now - user.last_rv[i] > 8000000) {
+    user.last_rv[i] = sim.now;
+    user.reverses = t;
+    p += sprintf(p, "rv %u", t->number);
+    // main.c stops the train first
+    l->bytes[0] = 0;
+    l->bytes[1] = t->number;
+  } else if (roll == 9) {
+    unsigned char id = SWITCH_IDS[user_rand(SWITCH_COUNT)];
+    int curved = user_rand(2);
+    p += sprintf(p, "sw %u %c", id, curved ? 'C' : 'S');
+    l->bytes[0] = curved ? 34 : 33;
+    l->bytes[1] = id;
+    user.after += SOLENOID_MAX_US;
+  } else {
+    unsigned speed = roll == 7 ? 0 : 6 + user_rand(9);
+    p += sprintf(p, "tr %u %u", t->number, speed);
+    l->bytes[0] = speed;
+    l->bytes[1] = t->number;
+  }
+  *p++ = '\r';
+  user.len = p - user.text;
+  user.command = 1;
+  user.at = 0;
+  if (start) {
+    ++user.started;
+    user.started_at = sim.now;
+  }
+  return 1;
+}
+
+static int user_input(char *out) {
+  if ((int)(host.now - user.next) < 0) {
+    return 0;
+  }
+  if (!user.len && !next_line()) {
+    user.next = host.now + user.interval;  // look again later
+    return 0;
+  }
+  *out = user.text[user.at++];
+  if (user.at < user.len) {
+    user.next += 10 * 1000000 / host.baud[0];
+    return 1;
+  }
+  if (user.reverses) {
+    user.reverses->rv_enter = host.now;
+    user.reverses->rv_static = TRAIN_ACCELERATION[user.reverses->speed];
+  }
+  if (user.command && user.count < MAX_LINES) {
+    user.lines[user.count].enter = host.now;
+    ++user.count;
+  }
+  user.next = host.now + user.after;
+  user.len = 0;
+  return 1;
+}
+
+static void command(unsigned char *cmd, unsigned char len, unsigned time) {
+  (void)len;
+  unsigned char b = cmd[0], arg = cmd[1];
+  if (b == 33 || b == 34) {
+    ++sim.received[RX_SWITCH];
+    sim.curved[arg] = b == 34;
+    sim.solenoid = 1;
+    sim.solenoid_on = time;
+  } else {
+    sim_train_t *t = find_train(arg);
+    if ((b & 15) == 15) {
+      ++sim.received[RX_REVERSE];
+      if (t) {
+        sim.moving_reversals += t->velocity > MOVING_MM_S;
+        if (t->rv_enter && time - t->rv_enter <= RV_MATCH_US) {
+          hist_add(&sim.reversal, time - t->rv_enter);
+          sim.reversal_us += time - t->rv_enter;
+          // main.c starts waiting once it has the line, so a learned wait is the only shorter one
+          if (time - t->rv_enter < t->rv_static) {
+            ++sim.learned_waits;
+            sim.learned_us += time - t->rv_enter;
+          } else {
+            ++sim.static_waits;
+            sim.static_us += time - t->rv_enter;
+          }
+        }
+        t->rv_enter = 0;
+        turn_around(t);
+      }
+    } else {
+      ++sim.received[RX_SPEED];
+      if (t) {
+        t->speed = b & 15;
+      }
+    }
+  }
+  // the oldest typed line this completes
+  while (user.matched < user.count && time - user.lines[user.matched].enter > MATCH_US) {
+    ++user.matched;
+  }
+  for (size_t i = user.matched; i < user.count; ++i) {
+    typed_line_t *l = &user.lines[i];
+    if (!l->done && l->bytes[0] == b && l->bytes[1] == arg && (int)(time - l->enter) >= 0 &&
+        time - l->enter <= MATCH_US) {
+      l->done = 1;
+      hist_add(&user.latency, time - l->enter);
+      break;
+    }
+  }
+  while (user.matched < user.count && user.lines[user.matched].done) {
+    ++user.matched;
+  }
+}
+
+/*************** the model for host_rpi.c ***************/
+
+// the us timer wraps every 71 minutes, so the run is timed separately
+static unsigned long long end_us, elapsed_us;
+static unsigned last_now;
+
+int host_input(size_t channel, char *out) {
+  controller_advance();
+  if (channel == 0) {
+    return user_input(out);
+  }
+  if (sim.out_tail == sim.out_head || (int)(sim.out[sim.out_tail % RING].time - host.now) > 0) {
+    return 0;
+  }
+  timed_byte_t *b = &sim.out[sim.out_tail++ % RING];
+  *out = b->byte;
+  sim.read += __builtin_popcount(b->byte & ~sim.read_state[b->ith]);
+  sim.read_state[b->ith] = b->byte;
+  return 1;
+}
+
+void host_next_input(unsigned *at) {
+  if ((int)(user.next - *at) < 0) {
+    *at = user.next;
+  }
+  if (sim.out_tail != sim.out_head && (int)(sim.out[sim.out_tail % RING].time - *at) < 0) {
+    *at = sim.out[sim.out_tail % RING].time;
+  }
+  // requests have to be seen on time to be answered on time
+  if (sim.in_tail != sim.in_head && (int)(sim.in[sim.in_tail % RING].time - *at) < 0) {
+    *at = sim.in[sim.in_tail % RING].time;
+  }
+}
+
+void host_output(size_t channel, unsigned char c, unsigned written, unsigned sent) {
+  (void)written;
+  if (channel == 1) {
+    if (sim.in_head - sim.in_tail == RING) {
+      errx(1, "more than %d bytes in flight to the controller", RING);
+    }
+    timed_byte_t *b = &sim.in[sim.in_head++ % RING];
+    b->time = sent;
+    b->byte = c;
+  }
+}
+
+int host_done(void) {
+  elapsed_us += host.now - last_now;
+  last_now = host.now;
+  return elapsed_us >= end_us;
+}
+
+/*************** setup and report ***************/
+
+static void place_trains(size_t count) {
+  const track_t *tr = sim.track;
+  size_t placed = 0;
+  // sensors spread over the layout, skipping ones at the end of the track
+  for (unsigned i = 0; placed < count && i < SENSOR_COUNT * 8; ++i) {
+    unsigned char node = i * 37 % SENSOR_COUNT;
+    if (tr->edge[node][TRACK_AHEAD] == TRACK_NONE || find_train(placed + 1)) {
+      continue;
+    }
+    int taken = 0;
+    for (size_t j = 0; j < placed; ++j) {
+      taken |= sim.trains[j].node == node;
+    }
+    if (taken) {
+      continue;
+    }
+    sim_train_t *t = &sim.trains[placed++];
+    t->number = placed;
+    t->node = node;
+    t->dir = TRACK_AHEAD;
+    t->accel = ACCEL_MIN_MM_S2 + (ACCEL_MAX_MM_S2 - ACCEL_MIN_MM_S2) * (placed * 7 % 10) / 9.0;
+  }
+  sim.train_count = placed;
+}
+
+static void print_latency(void) {
+  printf("typed lines %zu, reached the controller within %u s %u", user.count, MATCH_US / 1000000,
+         user.latency.total);
+  if (user.latency.total) {
+    printf("; Enter to controller p50 %u us, p90 %u, p99 %u, max %u", hist_percentile(&user.latency, 5000),
+           hist_percentile(&user.latency, 9000), hist_percentile(&user.latency, 9900), user.latency.max);
+  }
+  printf("\n");
+}
+
+int main(int argc, char **argv) {
+  unsigned trains = 24, seconds = 300;
+  char track = 'A';
+  user.interval = 500000;
+  user.seed = 1;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (strcmp(argv[i], "--trains") == 0) {
+      trains = atoi(argv[i + 1]);
+    } else if (strcmp(argv[i], "--seconds") == 0) {
+      seconds = atoi(argv[i + 1]);
+    } else if (strcmp(argv[i], "--track") == 0) {
+      track = argv[i + 1][0];
+    } else if (strcmp(argv[i], "--interval") == 0) {
+      user.interval = atoi(argv[i + 1]) * 1000;
+    } else if (strcmp(argv[i], "--iter-us") == 0) {
+      host.iter_us = atoi(argv[i + 1]);
+      host.iter_us = host.iter_us ? host.iter_us : 1;
+    } else if (strcmp(argv[i], "--seed") == 0) {
+      user.seed = strtoull(argv[i + 1], 0, 10);
+      user.seed = user.seed ? user.seed : 1;
+    } else {
+      errx(2, "usage: sim.out [--trains n] [--seconds n] [--track A] [--interval ms] [--iter-us n] [--seed n]");
+    }
+  }
+  sim.track = track_find(track);
+  if (!sim.track) {
+    errx(1, "no track %c", track);
+  }
+  if (trains > SIM_TRAINS_MAX || trains > TRAIN_MAX) {
+    errx(1, "at most %d trains", SIM_TRAINS_MAX < TRAIN_MAX ? SIM_TRAINS_MAX : TRAIN_MAX);
+  }
+  place_trains(trains);
+  if (sim.train_count < trains) {
+    warnx("only room for %zu trains", sim.train_count);
+  }
+  host.now = sim.now = 0;
+  end_us = seconds * 1000000ull;
+  // a moment for the first frame before typing, and "track" first for the other layout
+  user.next = 200000;
+  if (track != 'A') {
+    user.len = sprintf(user.text, "track %c\r", track);
+    user.after = user.interval;
+  }
+
+  struct timespec start, end;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  host_run();
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  double host_ns = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+
+  printf("%zu trains on track %c for %u s: %llu iterations at %u us each, idle %.1f%%, %.0f host ns/iteration\n",
+         sim.train_count, track, seconds, host.iterations, host.iter_us, 100.0 * host.idle_us / elapsed_us,
+         host.iterations ? host_ns / host.iterations : 0.0);
+  printf("controller received:");
+  for (size_t i = 0; i < sizeof RX_NAMES / sizeof(RX_NAMES[0]); ++i) {
+    printf(" %s %llu%s", RX_NAMES[i], sim.received[i], i + 1 < sizeof RX_NAMES / sizeof(RX_NAMES[0]) ? "," : "\n");
+  }
+  printf("sensor triggers %llu, merged into a set bit %llu, reported %llu, read by main.c %llu\n", sim.triggers,
+         sim.merged, sim.reported, sim.read);
+  printf("turned around at track ends %llu, solenoids left on over %u ms %llu\n", sim.end_turns,
+         SOLENOID_MAX_US / 1000, sim.solenoid_burns);
+  printf("reversals %llu, sent while still moving %llu", sim.received[RX_REVERSE], sim.moving_reversals);
+  if (sim.reversal.total) {
+    printf("; rv to reverse command mean %llu ms, p50 %u, p90 %u, max %u",
+           sim.reversal_us / sim.reversal.total / 1000, hist_percentile(&sim.reversal, 5000) / 1000,
+           hist_percentile(&sim.reversal, 9000) / 1000, sim.reversal.max / 1000);
+  }
+  printf("\nreversal waits learned %llu", sim.learned_waits);
+  if (sim.learned_waits) {
+    printf(" (mean %llu ms)", sim.learned_us / sim.learned_waits / 1000);
+  }
+  printf(", static %llu", sim.static_waits);
+  if (sim.static_waits) {
+    printf(" (mean %llu ms)", sim.static_us / sim.static_waits / 1000);
+  }
+  printf("\n");
+  print_latency();
+  return 0;
+}
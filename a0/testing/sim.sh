@@ -0,0 +1,10 @@
+#/bin/bash
+# usage: sim.sh [--trains n] [--seconds n] [--track A] [--interval ms] [--iter-us n] [--seed n]
+# runs main.c against a simulated track controller and user, see sim.c
+
+gcc -O2 -Wall -Wextra ../tools/trackgen.c -o trackgen.out && ./trackgen.out -p ../tracks/*.txt > track_data.out.c || exit 1
+mkdir -p gen.out && ./trackgen.out -p -h ../tracks/*.txt > gen.out/track_switches.h || exit 1
+# -fno-builtin as in the Makefile: otherwise the memset in util.c is compiled into a call to itself
+gcc -O2 -fno-builtin -Wall -Wextra -I.. -Igen.out sim.c host_rpi.c ../util.c ../command.c ../sensor.c ../track.c \
+  ../velocity.c ../fixed.c ../attrib.c ../train.c ../trace.c ../capture.c ../console.c ../prof.c track_data.out.c -o sim.out || exit 1
+./sim.out "$@"
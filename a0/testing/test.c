@@ -1,7 +1,19 @@
 #include <err.h>
 #include <stdio.h>
 #include <string.h>
+#include "../attrib.h"
+#include "../capture.h"
+#include "../command.h"
+#include "../console.h"
+#include "../fixed.h"
+#include "../prof.h"
+#include "../sensor.h"
+#include "../spsc.h"
+#include "../track.h"
+#include "../trace.h"
+#include "../train.h"
 #include "../util.h"
+#include "../velocity.h"
 
 #define ASSERT(condition)                                           \
 do {                                                                \
@@ -11,6 +23,12 @@ do {                                                                \
 
 #define BUFLEN(v) (sizeof(v) / sizeof(v[0]))
 
+// what capture.c records as the time
+static unsigned fake_now;
+unsigned timer_now(void) {
+  return fake_now;
+}
+
 static void test_clock_t() {
   display_clock_t c;
   display_clock_init(&c);
@@ -84,6 +102,7 @@ static void test_queue_t() {
 
   queue_emplace_literal(&q, "nop");
   // op--lmn
+  ASSERT(queue_size(&q) == 5);
   queue_consume(&q, 4);
   // -p-----
   QLDASSERT("p");
@@ -116,10 +135,18 @@ void test_train_command() {
   ASSERT(c.kind == TRAIN_COMMAND_RV);
   ASSERT(c.cmd.rv.train_num == 3);
 
-  char str4[] = "sw 32 S";
+  char str3a[] = "rv 81";
+  ASSERT(try_parse_train_command(str3a, BUFLEN(str3a) - 1).kind == TRAIN_COMMAND_INVALID);
+  char str3b[] = "tr 99 10";
+  ASSERT(try_parse_train_command(str3b, BUFLEN(str3b) - 1).kind == TRAIN_COMMAND_INVALID);
+  // 0 is no train
+  ASSERT(try_parse_train_command("tr 0 5", 6).kind == TRAIN_COMMAND_INVALID);
+  ASSERT(try_parse_train_command("rv 0", 4).kind == TRAIN_COMMAND_INVALID);
+
+  char str4[] = "sw 12 S";
   c = try_parse_train_command(str4, BUFLEN(str4) - 1);
   ASSERT(c.kind == TRAIN_COMMAND_SW);
-  ASSERT(c.cmd.sw.switch_num == 32);
+  ASSERT(c.cmd.sw.switch_num == 12);
   ASSERT(c.cmd.sw.straight);
 
   char str5[] = " sw 1  C";
@@ -134,13 +161,926 @@ void test_train_command() {
   ASSERT(c.cmd.sw.switch_num == 153);
   ASSERT(c.cmd.sw.straight);
 
+  // no such switch on any layout, or not even a byte
+  char str6a[] = "sw 32 S";
+  ASSERT(try_parse_train_command(str6a, BUFLEN(str6a) - 1).kind == TRAIN_COMMAND_INVALID);
+  char str6b[] = "sw 200 C";
+  ASSERT(try_parse_train_command(str6b, BUFLEN(str6b) - 1).kind == TRAIN_COMMAND_INVALID);
+  char str6c[] = "sw 409 C";
+  ASSERT(try_parse_train_command(str6c, BUFLEN(str6c) - 1).kind == TRAIN_COMMAND_INVALID);
+
+  char str7[] = "route A1  E16";
+  c = try_parse_train_command(str7, BUFLEN(str7) - 1);
+  ASSERT(c.kind == TRAIN_COMMAND_ROUTE);
+  ASSERT(c.cmd.route.from == 0);
+  ASSERT(c.cmd.route.to == 79);
+
+  char str8[] = "route A1 F1";
+  c = try_parse_train_command(str8, BUFLEN(str8) - 1);
+  ASSERT(c.kind == TRAIN_COMMAND_INVALID);
+
+  char str9[] = "route A17 B1";
+  c = try_parse_train_command(str9, BUFLEN(str9) - 1);
+  ASSERT(c.kind == TRAIN_COMMAND_INVALID);
+
+  c = try_parse_train_command("track B", 7);
+  ASSERT(c.kind == TRAIN_COMMAND_TRACK);
+  ASSERT(c.cmd.track.name == 'B');
+
+  c = try_parse_train_command("perf w", 6);
+  ASSERT(c.kind == TRAIN_COMMAND_PERF);
+  ASSERT(c.cmd.perf.windowed);
+  c = try_parse_train_command("perf a", 6);
+  ASSERT(c.kind == TRAIN_COMMAND_PERF);
+  ASSERT(!c.cmd.perf.windowed);
+
+  c = try_parse_train_command("prof r", 6);
+  ASSERT(c.kind == TRAIN_COMMAND_PROF);
+  ASSERT(c.cmd.prof.action == 'r');
+  c = try_parse_train_command("prof x", 6);
+  ASSERT(c.kind == TRAIN_COMMAND_INVALID);
+
+  c = try_parse_train_command("cap d", 5);
+  ASSERT(c.kind == TRAIN_COMMAND_CAPTURE);
+  ASSERT(c.cmd.capture.action == 'd');
+  c = try_parse_train_command("cap x", 5);
+  ASSERT(c.kind == TRAIN_COMMAND_INVALID);
+
+  c = try_parse_train_command("log w", 5);
+  ASSERT(c.kind == TRAIN_COMMAND_LOG);
+  ASSERT(c.cmd.log.level == 'w');
+  c = try_parse_train_command("log s", 5);
+  ASSERT(c.kind == TRAIN_COMMAND_INVALID);
+
+  c = try_parse_train_command("baud 921600", 11);
+  ASSERT(c.kind == TRAIN_COMMAND_BAUD);
+  ASSERT(c.cmd.baud.rate == 921600);
+  c = try_parse_train_command("baud 115200", 11);
+  ASSERT(c.kind == TRAIN_COMMAND_BAUD);
+  ASSERT(c.cmd.baud.rate == 115200);
+  // too slow for a 16 bit divisor, too fast for the clock, and too far from what it can make
+  c = try_parse_train_command("baud 12", 7);
+  ASSERT(c.kind == TRAIN_COMMAND_INVALID);
+  c = try_parse_train_command("baud 1000000", 12);
+  ASSERT(c.kind == TRAIN_COMMAND_INVALID);
+  c = try_parse_train_command("baud 600000", 11);
+  ASSERT(c.kind == TRAIN_COMMAND_INVALID);
+  c = try_parse_train_command("bench", 5);
+  ASSERT(c.kind == TRAIN_COMMAND_BENCH);
+
   c = try_parse_train_command("q", 1);
   ASSERT(c.kind == TRAIN_COMMAND_Q);
+
+  // batches
+  cmd_parser_t p;
+  cmd_parser_init(&p);
+  const char batch[] = "tr 24 10; sw 5 C;sw 6 S ;";
+  for (size_t i = 0; i < BUFLEN(batch) - 1; ++i) {
+    ASSERT(cmd_parser_feed(&p, batch[i]));
+  }
+  ASSERT(cmd_parser_end(&p) == 3);
+  ASSERT(p.cmds[0].kind == TRAIN_COMMAND_TR && p.cmds[0].cmd.tr.train_num == 24 && p.cmds[0].cmd.tr.speed == 10);
+  ASSERT(p.cmds[1].kind == TRAIN_COMMAND_SW && p.cmds[1].cmd.sw.switch_num == 5 && !p.cmds[1].cmd.sw.straight);
+  ASSERT(p.cmds[2].kind == TRAIN_COMMAND_SW && p.cmds[2].cmd.sw.switch_num == 6 && p.cmds[2].cmd.sw.straight);
+
+  cmd_parser_init(&p);
+  ASSERT(cmd_parser_end(&p) == 0);
+
+  // errors show up at the character that caused them, and poison the whole line
+  cmd_parser_init(&p);
+  const char bad[] = "rv 1; route A17";
+  for (size_t i = 0; i < BUFLEN(bad) - 1; ++i) {
+    ASSERT(cmd_parser_feed(&p, bad[i]) == (i < BUFLEN(bad) - 2));
+  }
+  ASSERT(cmd_parser_end(&p) == -1);
+  cmd_parser_init(&p);
+  ASSERT(cmd_parser_feed(&p, 't') && cmd_parser_feed(&p, 'r') && !cmd_parser_feed(&p, 'x'));
+  c = try_parse_train_command("tr 24", 5);
+  ASSERT(c.kind == TRAIN_COMMAND_INVALID);
+  c = try_parse_train_command("q; q", 4);
+  ASSERT(c.kind == TRAIN_COMMAND_INVALID);
+
+  // what a line needs in the train queue
+  c = try_parse_train_command("tr 24 10", 8);
+  ASSERT(cmd_train_bytes(&c) == 2);
+  c = try_parse_train_command("prof r", 6);
+  ASSERT(cmd_train_bytes(&c) == 0);
+  c = try_parse_train_command("trace d", 7);
+  ASSERT(cmd_train_bytes(&c) == 0);
+  c = try_parse_train_command("route A1 E16", 12);
+  ASSERT(cmd_train_bytes(&c) == 0);
+}
+
+static void test_hist_t() {
+  static hist_t h;
+  hist_reset(&h);
+  ASSERT(hist_percentile(&h, 5000) == 0);
+
+  // small values are exact
+  for (unsigned i = 1; i <= 10; ++i) {
+    hist_add(&h, i);
+  }
+  ASSERT(hist_percentile(&h, 5000) == 5);
+  ASSERT(hist_percentile(&h, 9000) == 9);
+  ASSERT(hist_percentile(&h, 10000) == 10);
+  ASSERT(hist_percentile(&h, 0) == 1);
+
+  // large values are within 1/16
+  hist_reset(&h);
+  for (unsigned i = 1; i <= 100000; ++i) {
+    hist_add(&h, i * 10);
+  }
+  unsigned p50 = hist_percentile(&h, 5000), p99 = hist_percentile(&h, 9900), p999 = hist_percentile(&h, 9990);
+  ASSERT(p50 >= 500000 && p50 <= 500000 + 500000 / 16);
+  ASSERT(p99 >= 990000 && p99 <= 990000 + 990000 / 16);
+  ASSERT(p999 >= 999000 && p999 <= 1000000);
+  ASSERT(h.max == 1000000 && h.total == 100000);
+
+  // one spike does not move the median
+  hist_add(&h, 0xFFFFFFFF);
+  ASSERT(hist_percentile(&h, 5000) == p50);
+  ASSERT(hist_percentile(&h, 10000) == 0xFFFFFFFF);
+}
+
+static void test_sensor_log_t() {
+  sensor_log_t log;
+  sensor_log_init(&log, 100);
+  ASSERT(sensor_log_active(&log) == 0);
+  ASSERT(log.last == SENSOR_NONE);
+
+  // A1 and A3 rise; B16 is the last bit of bank B
+  unsigned char triggered[8];
+  ASSERT(sensor_log_feed(&log, 0, (char)0xA0, 10, triggered) == 2);
+  ASSERT(triggered[0] == SENSOR_ID('A', 1) && triggered[1] == SENSOR_ID('A', 3));
+  ASSERT(sensor_log_feed(&log, 3, 0x01, 20, triggered) == 1);
+  ASSERT(triggered[0] == SENSOR_ID('B', 16));
+  ASSERT(SENSOR_ALP(triggered[0]) == 'B' && SENSOR_NUM(triggered[0]) == 16);
+
+  // still held: no new edges
+  ASSERT(sensor_log_feed(&log, 0, (char)0xA0, 30, triggered) == 0);
+  // A1 released then pressed again, A3 still held
+  ASSERT(sensor_log_feed(&log, 0, 0x20, 40, triggered) == 0);
+  ASSERT(sensor_log_feed(&log, 0, (char)0xA0, 50, triggered) == 1);
+
+  ASSERT(sensor_log_active(&log) == 3);
+  ASSERT(log.order[0] == SENSOR_ID('A', 1));
+  ASSERT(log.window_hits[SENSOR_ID('A', 1)] == 2);
+  ASSERT(log.hits[SENSOR_ID('A', 1)] == 2);
+  ASSERT(log.interval[SENSOR_ID('A', 1)] == 40);
+  ASSERT(log.interval[SENSOR_ID('A', 3)] == 0);
+  ASSERT(log.last == SENSOR_ID('A', 1));
+
+  // first A1 and A3 (t=10) fall out of the window
+  sensor_log_expire(&log, 115);
+  ASSERT(sensor_log_active(&log) == 2);
+  ASSERT(log.window_hits[SENSOR_ID('A', 1)] == 1);
+  ASSERT(log.window_hits[SENSOR_ID('A', 3)] == 0);
+  ASSERT(log.hits[SENSOR_ID('A', 3)] == 1);
+
+  sensor_log_expire(&log, 1000);
+  ASSERT(sensor_log_active(&log) == 0);
+
+  // wrapping the ring evicts the oldest events; ranking stays sorted
+  for (unsigned i = 0; i < SENSOR_LOG_SIZE * 3; ++i) {
+    sensor_log_record(&log, i % 7 == 0 ? 5 : i % SENSOR_COUNT, 1000);
+  }
+  unsigned total = 0;
+  for (size_t i = 0; i < SENSOR_COUNT; ++i) {
+    total += log.window_hits[i];
+    ASSERT(log.rank[log.order[i]] == i);
+    ASSERT(i == 0 || log.window_hits[log.order[i - 1]] >= log.window_hits[log.order[i]]);
+  }
+  ASSERT(total == SENSOR_LOG_SIZE);
+  ASSERT(log.order[0] == 5);
+}
+
+static void test_sensor_poll_t() {
+  sensor_poll_t poll;
+  sensor_poll_init(&poll);
+  size_t ith;
+
+  // nothing is hot: dump everything
+  ASSERT((unsigned char)sensor_poll_next(&poll) == SENSOR_REQ_DUMP_ALL);
+  sensor_poll_sent(&poll, 0);
+  for (size_t i = 0; i < SENSOR_BYTES; ++i) {
+    ASSERT(sensor_poll_feed(&poll, &ith, 5) == (i == SENSOR_BYTES - 1));
+    ASSERT(ith == i);
+  }
+  ASSERT(!poll.waiting);
+
+  // one hot bank: read it alone, then one cold bank
+  sensor_poll_hit(&poll, SENSOR_ID('C', 4));
+  ASSERT((unsigned char)sensor_poll_next(&poll) == SENSOR_REQ_BANK(2));
+  sensor_poll_sent(&poll, 10);
+  ASSERT(!sensor_poll_feed(&poll, &ith, 11) && ith == 4);
+  ASSERT(sensor_poll_feed(&poll, &ith, 12) && ith == 5);
+  ASSERT(poll.last_read[2] == 12);
+  ASSERT((unsigned char)sensor_poll_next(&poll) == SENSOR_REQ_BANK(0));
+  sensor_poll_sent(&poll, 13);
+  ASSERT(!sensor_poll_feed(&poll, &ith, 14) && ith == 0);
+  ASSERT(sensor_poll_feed(&poll, &ith, 15) && ith == 1);
+  // the cold bank moves on every cycle
+  ASSERT((unsigned char)sensor_poll_next(&poll) == SENSOR_REQ_BANK(2));
+  sensor_poll_sent(&poll, 16);
+  sensor_poll_feed(&poll, &ith, 17);
+  sensor_poll_feed(&poll, &ith, 18);
+  ASSERT((unsigned char)sensor_poll_next(&poll) == SENSOR_REQ_BANK(1));
+
+  // three hot banks: a full dump is cheaper
+  sensor_poll_reset(&poll);
+  sensor_poll_hit(&poll, SENSOR_ID('A', 1));
+  sensor_poll_hit(&poll, SENSOR_ID('B', 1));
+  sensor_poll_hit(&poll, SENSOR_ID('E', 1));
+  ASSERT((unsigned char)sensor_poll_next(&poll) == SENSOR_REQ_DUMP_ALL);
+
+  // banks cool down after a few cycles
+  sensor_poll_reset(&poll);
+  for (int i = 0; i < SENSOR_POLL_HOT_CYCLES; ++i) {
+    sensor_poll_sent(&poll, 0);
+    sensor_poll_reset(&poll);
+    sensor_poll_next(&poll);
+  }
+  ASSERT((unsigned char)sensor_poll_next(&poll) == SENSOR_REQ_DUMP_ALL);
+
+  // a dump cut off in bank B goes on with single requests from B
+  sensor_poll_sent(&poll, 0);
+  for (int i = 0; i < 3; ++i) {
+    sensor_poll_feed(&poll, &ith, 1);
+  }
+  sensor_poll_resync(&poll);
+  ASSERT(!poll.waiting);
+  for (int bank = 1; bank < SENSOR_BANKS; ++bank) {
+    ASSERT((unsigned char)sensor_poll_next(&poll) == SENSOR_REQ_BANK(bank));
+    sensor_poll_sent(&poll, 2);
+    sensor_poll_feed(&poll, &ith, 3);
+    ASSERT(ith == (size_t)bank * 2);
+    sensor_poll_feed(&poll, &ith, 3);
+  }
+  ASSERT((unsigned char)sensor_poll_next(&poll) == SENSOR_REQ_DUMP_ALL);
+
+  // a lost bank request is retried before the rest of its cycle
+  sensor_poll_reset(&poll);
+  sensor_poll_hit(&poll, SENSOR_ID('D', 1));
+  ASSERT((unsigned char)sensor_poll_next(&poll) == SENSOR_REQ_BANK(3));
+  sensor_poll_sent(&poll, 0);
+  sensor_poll_resync(&poll);
+  ASSERT((unsigned char)sensor_poll_next(&poll) == SENSOR_REQ_BANK(3));
+  sensor_poll_sent(&poll, 0);
+  sensor_poll_feed(&poll, &ith, 1);
+  sensor_poll_feed(&poll, &ith, 1);
+  ASSERT((unsigned char)sensor_poll_next(&poll) != SENSOR_REQ_BANK(3));
+}
+
+static void test_sensor_health_t() {
+  static sensor_health_t h;
+  sensor_health_init(&h);
+  sensor_poll_t poll;
+  sensor_poll_init(&poll);
+  size_t ith;
+
+  // full dumps answered in 54 ms, a byte every 4 ms
+  unsigned now = 0;
+  for (int i = 0; i < SENSOR_HEALTH_SAMPLES; ++i) {
+    ASSERT(sensor_health_ready(&h, now));
+    ASSERT((unsigned char)sensor_poll_next(&poll) == SENSOR_REQ_DUMP_ALL);
+    sensor_poll_sent(&poll, now);
+    ASSERT(h.reply_timeout[1] == SENSOR_HEALTH_REPLY_INITIAL);
+    ASSERT(sensor_health_check(&h, &poll, now + 100000) == SENSOR_HEALTH_OK);
+    now += 14000;
+    for (int j = 0; j < SENSOR_BYTES; ++j) {
+      now += 4000;
+      sensor_health_byte(&h, &poll, now);
+      if (sensor_poll_feed(&poll, &ith, now)) {
+        sensor_health_done(&h, &poll, now);
+      }
+    }
+  }
+  // 4 times the p99
+  ASSERT(h.reply_timeout[1] == 216000);
+  ASSERT(h.gap_timeout == 16000);
+  ASSERT(h.reply_timeout[0] == SENSOR_HEALTH_REPLY_INITIAL);
+
+  // no reply at all
+  ASSERT((unsigned char)sensor_poll_next(&poll) == SENSOR_REQ_DUMP_ALL);
+  sensor_poll_sent(&poll, now);
+  ASSERT(sensor_health_check(&h, &poll, now + 215999) == SENSOR_HEALTH_OK);
+  ASSERT(sensor_health_check(&h, &poll, now += 216000) == SENSOR_HEALTH_LOST);
+  ASSERT(h.failures == 1);
+  sensor_poll_resync(&poll);
+  // the line has to be quiet for a gap timeout first, and stray bytes restart the wait
+  ASSERT(!sensor_health_ready(&h, now + 5000));
+  sensor_health_byte(&h, &poll, now += 5000);
+  ASSERT(!sensor_health_ready(&h, now + 15999));
+  ASSERT(sensor_health_ready(&h, now += 16000));
+
+  // a reply that stops partway is caught by the gap, long before the reply timeout
+  ASSERT((unsigned char)sensor_poll_next(&poll) == SENSOR_REQ_DUMP_ALL);
+  sensor_poll_sent(&poll, now);
+  for (int j = 0; j < 3; ++j) {
+    sensor_health_byte(&h, &poll, now += 4000);
+    sensor_poll_feed(&poll, &ith, now);
+  }
+  ASSERT(sensor_health_check(&h, &poll, now + 15999) == SENSOR_HEALTH_OK);
+  ASSERT(sensor_health_check(&h, &poll, now + 16000) == SENSOR_HEALTH_PARTIAL);
+  ASSERT(h.failures == 2);
+
+  // a complete reply clears the failures
+  sensor_poll_resync(&poll);
+  ASSERT((unsigned char)sensor_poll_next(&poll) == SENSOR_REQ_BANK(1));
+  sensor_poll_sent(&poll, now);
+  while (!sensor_poll_feed(&poll, &ith, now)) {
+    sensor_health_byte(&h, &poll, now);
+  }
+  sensor_health_done(&h, &poll, now);
+  ASSERT(h.failures == 0);
+}
+
+// the sensor first linked from s in the layout, SENSOR_NONE if there is none; tests take their
+// sensor pairs from here, so that they hold for whatever layouts are in tracks/
+static unsigned char linked_sensor(const track_t *t, unsigned char s) {
+  unsigned i = t->sensor_link_begin[s];
+  return i < t->sensor_link_begin[s + 1] ? t->sensor_links[i].sensor : SENSOR_NONE;
+}
+
+// a sensor other than s that s has no link to
+static unsigned char unlinked_sensor(const track_t *t, unsigned char s) {
+  for (unsigned char other = 0; other < SENSOR_COUNT; ++other) {
+    int linked = other == s;
+    for (unsigned i = t->sensor_link_begin[s]; i < t->sensor_link_begin[s + 1]; ++i) {
+      linked |= t->sensor_links[i].sensor == other;
+    }
+    if (!linked) {
+      return other;
+    }
+  }
+  return SENSOR_NONE;
+}
+
+static void test_track_t() {
+  const track_t *a = track_find('A');
+  ASSERT(a);
+  ASSERT(track_find('Z') == 0);
+  // every sensor link has its mirror image: A1 -> X means reverse(X) -> A2
+  for (const track_t *t = TRACKS; t < TRACKS + TRACK_COUNT; ++t) {
+    for (unsigned char s = 0; s < SENSOR_COUNT; ++s) {
+      for (unsigned i = t->sensor_link_begin[s]; i < t->sensor_link_begin[s + 1]; ++i) {
+        const track_sensor_link_t *l = &t->sensor_links[i];
+        ASSERT(track_sensor_distance(t, l->sensor ^ 1, s ^ 1) == l->dist);
+      }
+    }
+  }
+  unsigned char a1 = SENSOR_ID('A', 1);
+  ASSERT(linked_sensor(a, a1) != SENSOR_NONE && unlinked_sensor(a, a1) != SENSOR_NONE);
+  ASSERT(track_sensor_distance(a, a1, linked_sensor(a, a1)) > 0);
+  ASSERT(track_sensor_distance(a, a1, unlinked_sensor(a, a1)) == 0);
+}
+
+static void test_switch_index() {
+  for (size_t i = 0; i < SWITCH_COUNT; ++i) {
+    ASSERT(SWITCH_INDEX[SWITCH_IDS[i]] == i);
+    ASSERT(i == 0 || SWITCH_IDS[i - 1] < SWITCH_IDS[i]);
+  }
+  size_t valid = 0;
+  for (size_t id = 0; id < 256; ++id) {
+    valid += SWITCH_INDEX[id] != TRACK_NONE;
+  }
+  ASSERT(valid == SWITCH_COUNT);
+  ASSERT(SWITCH_INDEX[0] == TRACK_NONE && SWITCH_INDEX[19] == TRACK_NONE);
+  // every switch of every layout has an index
+  for (size_t i = 0; i < TRACK_COUNT; ++i) {
+    for (size_t n = 0; n < TRACKS[i].node_count; ++n) {
+      if (TRACKS[i].node_type[n] == TRACK_NODE_BRANCH) {
+        ASSERT(SWITCH_INDEX[TRACKS[i].node_num[n]] != TRACK_NONE);
+      }
+    }
+  }
+}
+
+static void test_track_route() {
+  for (const track_t *t = TRACKS; t < TRACKS + TRACK_COUNT; ++t) {
+    size_t n = t->node_count;
+    for (unsigned char from = 0; from < n; ++from) {
+      for (unsigned char to = 0; to < n; ++to) {
+        track_switch_t sw[64];
+        unsigned dist;
+        int count = track_route(t, from, to, sw, BUFLEN(sw), &dist);
+        if (count < 0) {
+          continue;
+        }
+        // follow the switch settings and check we end up where we want, as far as promised
+        unsigned walked = 0;
+        int used = 0;
+        unsigned char node = from;
+        for (size_t steps = 0; node != to; ++steps) {
+          ASSERT(steps < n);
+          unsigned char dir = TRACK_AHEAD;
+          if (t->node_type[node] == TRACK_NODE_BRANCH) {
+            ASSERT(used < count && sw[used].id == t->node_num[node]);
+            dir = sw[used++].curved;
+          }
+          ASSERT(t->edge[node][dir] != TRACK_NONE);
+          walked += t->edge_dist[node][dir];
+          node = t->edge[node][dir];
+        }
+        ASSERT(used == count);
+        ASSERT(walked == dist);
+        // a path that does not fit is refused rather than cut short
+        if (count) {
+          ASSERT(track_route(t, from, to, sw, count - 1, 0) == -1);
+        }
+      }
+    }
+  }
+
+  const track_t *a = track_find('A');
+  unsigned dist;
+  ASSERT(track_route(a, 0, 0, 0, 0, &dist) == 0 && dist == 0);
+  // exits lead nowhere
+  for (unsigned char node = 0; node < a->node_count; ++node) {
+    if (a->node_type[node] == TRACK_NODE_EXIT) {
+      ASSERT(track_route(a, node, 0, 0, 0, 0) == -1);
+    }
+  }
+}
+
+static void test_fixed() {
+  q16_t q;
+  q32_t w;
+  ASSERT(q16_round(q16_from_int(-7)) == -7);
+  ASSERT(q16_round(Q16_ONE / 2) == 1 && q16_round(-Q16_ONE / 2) == 0);
+
+  // products and quotients against doubles, within half an ulp
+  static const double VALUES[] = {0, 1, -1, 0.5, 3.14159, -2.71828, 100.25, -1234.5, 0.0001, 181.0};
+  for (size_t i = 0; i < BUFLEN(VALUES); ++i) {
+    for (size_t j = 0; j < BUFLEN(VALUES); ++j) {
+      q16_t a = (q16_t)(VALUES[i] * 65536), b = (q16_t)(VALUES[j] * 65536);
+      double exact = (double)a * b / 65536;
+      int fits = exact > Q16_MIN && exact < Q16_MAX;
+      ASSERT(q16_mul(a, b, &q) == fits);
+      ASSERT(fits ? q >= exact - 0.5 && q <= exact + 0.5 : q == (exact > 0 ? Q16_MAX : Q16_MIN));
+      if (b) {
+        exact = (double)a / b * 65536;
+        fits = exact > Q16_MIN && exact < Q16_MAX;
+        ASSERT(q16_div(a, b, &q) == fits);
+        ASSERT(fits ? q >= exact - 0.5 && q <= exact + 0.5 : q == (exact > 0 ? Q16_MAX : Q16_MIN));
+        // doubles only have 53 bits, so allow for their error too
+        exact = (double)a / b * 4294967296.0;
+        fits = exact > -9.2e18 && exact < 9.2e18;
+        double slack = 1 + (exact < 0 ? -exact : exact) / (1ull << 52);
+        ASSERT(q32_div(q32_from_q16(a), q32_from_q16(b), &w) == fits);
+        ASSERT(!fits || (w >= exact - slack && w <= exact + slack));
+      }
+    }
+  }
+  ASSERT(q32_mul(Q32_ONE * 3 / 2, -Q32_ONE * 5, &w) && w == -Q32_ONE * 15 / 2);
+  ASSERT(q16_ratio(1000000, 3, &q) == 0 && q == Q16_MAX);
+  ASSERT(q16_ratio(2 * 1000000ull * 1000, 1000000000, &q) && q == 2 * Q16_ONE);
+  // big operands still divide exactly
+  ASSERT(q16_ratio(3ll << 60, 1ll << 61, &q) && q == Q16_ONE * 3 / 2);
+  ASSERT(q16_ratio(-(3ll << 60), 1ll << 61, &q) && q == -Q16_ONE * 3 / 2);
+  ASSERT(q32_div(INT64_MAX, Q32_ONE * 4, &w) && w == INT64_MAX / 4 + 1);
+
+  // overflows saturate and are reported
+  ASSERT(!q16_mul(q16_from_int(300), q16_from_int(300), &q) && q == Q16_MAX);
+  ASSERT(!q16_mul(q16_from_int(-300), q16_from_int(300), &q) && q == Q16_MIN);
+  ASSERT(!q16_div(Q16_ONE, 0, &q) && q == Q16_MAX);
+  ASSERT(!q16_div(-Q16_ONE, 0, &q) && q == Q16_MIN);
+  ASSERT(!q16_div(q16_from_int(1000), Q16_ONE / 100, &q) && q == Q16_MAX);
+  ASSERT(!q32_mul(Q32_ONE << 20, Q32_ONE << 20, &w) && w == INT64_MAX);
+  ASSERT(!q32_div(Q32_ONE << 30, 1, &w) && w == INT64_MAX);
+  ASSERT(!q16_from_q32(Q32_ONE << 16, &q) && q == Q16_MAX);
+  ASSERT(q16_from_q32(-Q32_ONE * 3, &q) && q == q16_from_int(-3));
+
+  // the reciprocal table is exact for all divisors and the extremes of x
+  static const uint32_t XS[] = {0, 1, 254, 255, 256, 65535, 1000003, 0x7FFFFFFF, 0xFFFFFFFE, 0xFFFFFFFF};
+  for (unsigned d = 1; d <= FIXED_RECIP_MAX; ++d) {
+    for (size_t i = 0; i < BUFLEN(XS); ++i) {
+      ASSERT(div_small(XS[i], d) == XS[i] / d);
+    }
+  }
+
+  // the mean is exact for a constant sample, the ema gets within 2^shift ulps of it
+  q16_t avg = 0;
+  for (unsigned n = 1; n <= 8; ++n) {
+    avg = q16_mean(avg, q16_from_int(n * 2), n);
+  }
+  ASSERT(avg >= q16_from_int(9) - 8 && avg <= q16_from_int(9));
+  ASSERT(q16_mean(Q16_MIN, Q16_MAX, 2) == -1);
+  for (int i = 0; i < 200; ++i) {
+    avg = q16_ema(avg, q16_from_int(-50), 3);
+  }
+  ASSERT(avg >= q16_from_int(-50) - 8 && avg <= q16_from_int(-50));
+
+  for (uint64_t x = 0; x < 100000; ++x) {
+    uint64_t r = isqrt64(x);
+    ASSERT(r * r <= x && (r + 1) * (r + 1) > x);
+  }
+  ASSERT(isqrt64(UINT64_MAX) == 0xFFFFFFFF);
+  ASSERT(isqrt64(0xFFFFFFFE00000001ull) == 0xFFFFFFFF && isqrt64(0xFFFFFFFE00000000ull) == 0xFFFFFFFE);
+  ASSERT(q16_sqrt(q16_from_int(2)) == 92681);  // 1.41421 * 2^16
+  ASSERT(q16_sqrt(Q16_ONE / 4) == Q16_ONE / 2);
+  ASSERT(q16_sqrt(-Q16_ONE) == 0);
+}
+
+static void test_velocity_t() {
+  static velocity_t v;
+  velocity_init(&v);
+  const track_t *a = track_find('A');
+  unsigned char from = SENSOR_ID('A', 1), to = linked_sensor(a, from);
+  unsigned dist = track_sensor_distance(a, from, to);
+
+  velocity_set_speed(&v, 24, 10, 0, 1000);
+  // still accelerating
+  ASSERT(velocity_sensor(&v, a, 24, to, 500) == 0);
+  ASSERT(velocity_sensor(&v, a, 24, from ^ 1, 600) == 0);
+  velocity_reverse(&v, 24);
+  ASSERT(velocity_sensor(&v, a, 24, from, 2000) == 0);
+  // dist mm in half a second
+  ASSERT(velocity_sensor(&v, a, 24, to, 502000) == dist * 2);
+  ASSERT(velocity_get(&v, 24, 10) == dist * 2);
+  ASSERT(velocity_get(&v, 24, 26) == dist * 2);
+  ASSERT(velocity_get(&v, 24, 9) == 0);
+  // not adjacent
+  ASSERT(velocity_sensor(&v, a, 24, unlinked_sensor(a, to), 600000) == 0);
+
+  // smoothing converges on the new value
+  for (unsigned i = 0, t = 1000000; i < 100; ++i, t += 2000000) {
+    velocity_sensor(&v, a, 24, from, t);
+    velocity_sensor(&v, a, 24, to, t + 1000000);
+  }
+  ASSERT(velocity_get(&v, 24, 10) >= dist - 1 && velocity_get(&v, 24, 10) <= dist + 1);
+  // outliers are dropped once there are enough samples
+  velocity_sensor(&v, a, 24, from, 0);
+  ASSERT(velocity_sensor(&v, a, 24, to, 100000) == 0);
+
+  // stops: measured at dist mm/s from `from` to `to`, told to stop on the way to `next`, and
+  // reaching it 1 s later having lost 1/4 of dist mm: it took 2 s to stop
+  unsigned char next = linked_sensor(a, to);
+  unsigned dist2 = track_sensor_distance(a, to, next);
+  unsigned at_stop = (dist2 - dist * 3 / 4) * 1000000ull / dist;
+  velocity_init(&v);
+  for (unsigned i = 0, t = 0; i < 3; ++i, t += 10000000) {
+    ASSERT(velocity_stop_time(&v, 24, 10) == 0);
+    velocity_set_speed(&v, 24, 10, t, 0);
+    velocity_sensor(&v, a, 24, from, t + 1000000);
+    ASSERT(velocity_sensor(&v, a, 24, to, t + 2000000) == dist);
+    velocity_set_speed(&v, 24, 0, t + 2000000 + at_stop, 1000);
+    velocity_sensor(&v, a, 24, next, t + 3000000 + at_stop);
+  }
+  unsigned stop = velocity_stop_time(&v, 24, 10);
+  ASSERT(stop > 1998000 && stop < 2002000);
+  ASSERT(velocity_stop_time(&v, 24, 26) == stop && velocity_stop_time(&v, 24, 9) == 0);
+  // only the first sensor after the stop counts
+  velocity_sensor(&v, a, 24, to, 40000000);
+  ASSERT(velocity_stop_time(&v, 24, 10) == stop);
+  // twice as fast at speed 12, so twice as long to stop, by the deceleration learned at 10
+  velocity_set_speed(&v, 24, 12, 40000000, 0);
+  for (unsigned i = 0, t = 41000000; i < 3; ++i, t += 2000000) {
+    velocity_sensor(&v, a, 24, from, t);
+    velocity_sensor(&v, a, 24, to, t + 500000);
+  }
+  ASSERT(velocity_stop_time(&v, 24, 12) > 3996000 && velocity_stop_time(&v, 24, 12) < 4004000);
+  // a train that stops in 2 s is reversed after 2.8 s instead of the static 5.5 s, one that has
+  // learned nothing after the static time, and a long stop does not wait longer than that
+  unsigned rv = velocity_reverse_wait(&v, 24, 10, 5500000);
+  ASSERT(rv > 2797000 && rv < 2803000);
+  ASSERT(velocity_reverse_wait(&v, 25, 10, 5500000) == 5500000);
+  ASSERT(velocity_reverse_wait(&v, 24, 12, 4000000) == 4000000);
+  // a deceleration next to nothing saturates rather than wrapping to a short stop
+  q16_t decel = v.decel[24];
+  v.decel[24] = 1;
+  ASSERT(velocity_stop_time(&v, 24, 12) == ~0u);
+  v.decel[24] = decel;
+
+  // no velocity measured at that speed, going too far to be stopping, or only a few mm short of
+  // where it would have been (as much as polling the sensors is off by): nothing learned
+  velocity_set_speed(&v, 24, 9, 49000000, 2000000);
+  velocity_sensor(&v, a, 24, from, 50000000);
+  velocity_sensor(&v, a, 24, to, 50500000);
+  velocity_set_speed(&v, 24, 0, 50600000, 1000);
+  velocity_sensor(&v, a, 24, next, 51000000);
+  ASSERT(v.stop_samples[24][9] == 0 && velocity_stop_time(&v, 24, 9) == 0);
+  velocity_set_speed(&v, 24, 10, 59000000, 0);
+  velocity_sensor(&v, a, 24, from, 60000000);
+  velocity_sensor(&v, a, 24, to, 61000000);
+  velocity_set_speed(&v, 24, 0, 61000000 + at_stop, 1000);
+  velocity_sensor(&v, a, 24, next, 61500000 + at_stop);
+  ASSERT(v.stop_samples[24][10] == 3);
+  velocity_set_speed(&v, 24, 10, 69000000, 0);
+  velocity_sensor(&v, a, 24, from, 70000000);
+  velocity_sensor(&v, a, 24, to, 71000000);
+  velocity_set_speed(&v, 24, 0, 71000000 + (dist2 - 281) * 1000000ull / dist, 1000);
+  velocity_sensor(&v, a, 24, next, 71510000 + (dist2 - 281) * 1000000ull / dist);
+  ASSERT(v.stop_samples[24][10] == 3);
+}
+
+static void test_train_table_t() {
+  static train_table_t t;
+  train_table_init(&t);
+  ASSERT(!train_find(&t, 24) && !train_find(&t, 0));
+
+  train_state_t *a = train_get(&t, 24);
+  train_state_t *b = train_get(&t, 80);
+  ASSERT(a == train_find(&t, 24) && b == train_get(&t, 80));
+  ASSERT(t.active_count == 2 && t.active[0] == 24 && t.active[1] == 80);
+  ASSERT(a->column == 0 && b->column == 1 && a->last_sensor == SENSOR_NONE);
+  // new trains need drawing, once each
+  ASSERT(t.journal_count == 2);
+  train_touch(&t, 24);
+  ASSERT(t.journal_count == 2);
+
+  train_journal_clear(&t);
+  ASSERT(t.journal_count == 0 && !a->dirty);
+  // a train whose column is taken by another is not active
+  ASSERT(!train_find(&t, 58));
+  train_touch(&t, 80);
+  ASSERT(t.journal_count == 1 && t.journal[0] == 80);
+  train_touch_all(&t);
+  ASSERT(t.journal_count == 2 && t.journal[1] == 24);
+}
+
+static unsigned frame_word(const char *p) {
+  const unsigned char *u = (const unsigned char *)p;
+  return u[0] | u[1] << 8 | u[2] << 16 | (unsigned)u[3] << 24;
+}
+
+static void test_spsc_t() {
+  static spsc_t r;
+  spsc_init(&r);
+  char out;
+  size_t len;
+  ASSERT(!spsc_pop(&r, &out));
+  ASSERT(spsc_push(&r, "abc", 3) == 3);
+  ASSERT(spsc_room(&r) == SPSC_SIZE - 3);
+  ASSERT(spsc_pop(&r, &out) && out == 'a');
+  const char *front = spsc_front(&r, &len);
+  ASSERT(len == 2 && memcmp(front, "bc", 2) == 0);
+  spsc_consume(&r, 2);
+  ASSERT(spsc_room(&r) == SPSC_SIZE);
+
+  // fills up, and the readable run stops at the end of the buffer
+  static char big[SPSC_SIZE + 10];
+  for (size_t i = 0; i < sizeof big; ++i) {
+    big[i] = i;
+  }
+  ASSERT(spsc_push(&r, big, sizeof big) == SPSC_SIZE);
+  ASSERT(spsc_push(&r, "x", 1) == 0);
+  front = spsc_front(&r, &len);
+  ASSERT(len == SPSC_SIZE - 3 && front[0] == big[0]);
+  spsc_consume(&r, len);
+  front = spsc_front(&r, &len);
+  ASSERT(len == 3 && front[0] == big[SPSC_SIZE - 3]);
+  spsc_consume(&r, 3);
+  ASSERT(!spsc_pop(&r, &out));
+}
+
+static void test_trace_t() {
+  static char frame[TRACE_FRAME_BYTES(TRACE_SIZE)];
+  trace_init();
+  trace_event(TRACE_SPI, 0, 0x0102);  // not recorded by default
+  trace_event(TRACE_TRAIN_TX, 133, 0);
+  trace_event(TRACE_SENSOR_RX, 3, 0x80);
+  ASSERT(trace.head == 2);
+
+  trace_dump_begin(54000000);
+  trace_event(TRACE_TRAIN_TX, 1, 0);  // paused
+  // read in odd sized pieces
+  size_t len = 0, n;
+  while ((n = trace_dump_read(len, frame + len, 5))) {
+    len += n;
+  }
+  trace_dump_end(1u << TRACE_TRAIN_TX);
+  ASSERT(len == TRACE_FRAME_BYTES(2));
+  ASSERT(memcmp(frame, "TRC1", 4) == 0);
+  ASSERT(frame_word(frame + 4) == 54000000 && frame_word(frame + 8) == 2 && frame_word(frame + 12) == 0);
+  ASSERT(frame[TRACE_HEADER_BYTES + 4] == TRACE_TRAIN_TX && (unsigned char)frame[TRACE_HEADER_BYTES + 5] == 133);
+  ASSERT(frame[TRACE_HEADER_BYTES + 12] == TRACE_SENSOR_RX && frame[TRACE_HEADER_BYTES + 14] == (char)0x80);
+  unsigned sum = 0;
+  for (size_t i = TRACE_HEADER_BYTES; i < len - 4; i += 4) {
+    sum += frame_word(frame + i);
+  }
+  ASSERT(sum == frame_word(frame + len - 4));
+
+  // wrapping keeps the newest records, oldest first
+  for (unsigned i = 0; i < TRACE_SIZE + 10; ++i) {
+    trace_event(TRACE_TRAIN_TX, i, 0);
+  }
+  trace_dump_begin(1);
+  trace_dump_read(0, frame, sizeof frame);
+  ASSERT(frame_word(frame + 8) == TRACE_SIZE && frame_word(frame + 12) == 12);
+  ASSERT((unsigned char)frame[TRACE_HEADER_BYTES + 5] == 10);
+}
+
+static void test_capture_t() {
+  capture_start();
+  fake_now = 1000;
+  capture_bytes(CAPTURE_KIND(0, CAPTURE_IN), "t", 1);
+  fake_now = 1200;
+  capture_bytes(CAPTURE_KIND(0, CAPTURE_IN), "r", 1);  // joins the record before
+  capture_bytes(CAPTURE_KIND(0, CAPTURE_OUT), "\033[2J", 4);  // only counted
+  capture_bytes(CAPTURE_KIND(1, CAPTURE_OUT), "\x0a\x18", 2);
+  fake_now = 5000;
+  capture_bytes(CAPTURE_KIND(0, CAPTURE_IN), "\r", 1);  // too late to join
+  ASSERT(capture.len == 4 * CAPTURE_HEADER_BYTES + 2 + 2 + 1);
+
+  static char frame[64];
+  capture_dump_begin();
+  capture_bytes(CAPTURE_KIND(0, CAPTURE_IN), "x", 1);  // stopped
+  size_t len = 0, n;
+  while ((n = capture_dump_read(len, frame + len, 5))) {
+    len += n;
+  }
+  ASSERT(len == 8 + 4 * CAPTURE_HEADER_BYTES + 5 + 4);
+  ASSERT(memcmp(frame, "CAP1", 4) == 0 && frame_word(frame + 4) == len - 12);
+  const char *r = frame + 8;
+  ASSERT(frame_word(r) == 1000 && r[4] == CAPTURE_KIND(0, CAPTURE_IN) && r[5] == 2 && memcmp(r + 6, "tr", 2) == 0);
+  r += CAPTURE_HEADER_BYTES + 2;
+  ASSERT(frame_word(r) == 1200 && r[4] == CAPTURE_KIND(0, CAPTURE_OUT) && r[5] == 4);
+  r += CAPTURE_HEADER_BYTES;
+  ASSERT(r[4] == CAPTURE_KIND(1, CAPTURE_OUT) && r[5] == 2 && r[7] == 0x18);
+  r += CAPTURE_HEADER_BYTES + 2;
+  ASSERT(frame_word(r) == 5000 && r[5] == 1 && r[6] == '\r');
+  unsigned sum = 0;
+  for (size_t i = 8; i < len - 4; ++i) {
+    sum += (unsigned char)frame[i];
+  }
+  ASSERT(sum == frame_word(frame + len - 4));
+
+  // long writes are split, and a full buffer stops recording
+  static char big[CAPTURE_SIZE / 4];
+  capture_start();
+  capture_bytes(CAPTURE_KIND(1, CAPTURE_OUT), big, 600);
+  ASSERT(capture.len == 3 * CAPTURE_HEADER_BYTES + 600);
+  for (int i = 0; i < 5; ++i) {
+    capture_bytes(CAPTURE_KIND(1, CAPTURE_IN), big, sizeof big);
+  }
+  ASSERT(capture.full && !capture.on && capture.len <= CAPTURE_SIZE);
+}
+
+static int line_is(const console_line_t *line, const char *text) {
+  return line->len == strlen(text) && memcmp(line->text, text, line->len) == 0;
+}
+
+static void test_console_t() {
+  char out[CONSOLE_COLS];
+  console_entry_t e = {25, CONSOLE_WARN, "a %u, b %d %% %z", 42, -7};
+  size_t len = console_format(&e, 10, out);
+  ASSERT(len == strlen("2.5 W a 42, b -7 % z") && memcmp(out, "2.5 W a 42, b -7 % z", len) == 0);
+  e.fmt = "%x%c";
+  e.a = 0x2ab;
+  e.b = 'q';
+  len = console_format(&e, 10, out);
+  ASSERT(len == strlen("2.5 W 2abq") && memcmp(out, "2.5 W 2abq", len) == 0);
+  // cut at the width of a line
+  e.fmt = "0123456789012345678901234567890123456789012345678901234567890123456789%u";
+  ASSERT(console_format(&e, 0, out) == CONSOLE_COLS);
+  // past the 32 bit wrap of a 54 MHz counter
+  e.time = 54000000ull * 1000;
+  e.fmt = "late";
+  len = console_format(&e, 54000000, out);
+  ASSERT(len == strlen("1000.0 W late") && memcmp(out, "1000.0 W late", len) == 0);
+
+  console_init(CONSOLE_INFO);
+  console_log(CONSOLE_DEBUG, "hidden", 0, 0);
+  ASSERT(console.head == 0);
+  console_log(CONSOLE_INFO, "one", 0, 0);
+  console_log(CONSOLE_ERROR, "two %u", 2, 0);
+  console_update(0);
+  ASSERT(console.dirty == (1u << CONSOLE_ROWS) - 1);
+  ASSERT(line_is(&console.lines[CONSOLE_ROWS - 2], "0.0 I one"));
+  ASSERT(line_is(&console.lines[CONSOLE_ROWS - 1], "0.0 E two 2"));
+  ASSERT(console.lines[0].len == 0 && console.dropped == 0);
+
+  // lines that scroll out before being shown are dropped
+  for (unsigned i = 0; i < CONSOLE_ROWS - 1; ++i) {
+    console_log(CONSOLE_INFO, "%u", i, 0);
+  }
+  console_update(0);
+  ASSERT(console.dropped == 1);
+  ASSERT(line_is(&console.lines[0], "0.0 E two 2"));
+  for (size_t i = 0; i < CONSOLE_ROWS; ++i) {
+    console.lines[i].shown = 1;
+  }
+  console_log(CONSOLE_INFO, "next", 0, 0);
+  console_update(0);
+  ASSERT(console.dropped == 1);
+
+  // a burst: only the last lines are formatted, and the ring keeps only CONSOLE_SIZE
+  for (unsigned i = 0; i < CONSOLE_SIZE + 10; ++i) {
+    console_log(CONSOLE_INFO, "%u", i, 0);
+  }
+  console_update(0);
+  // and "next" scrolled out unshown
+  ASSERT(console.dropped == 2 + CONSOLE_SIZE + 10 - CONSOLE_ROWS);
+  ASSERT(line_is(&console.lines[CONSOLE_ROWS - 1], "0.0 I 73"));
+  ASSERT(console.taken == console.head);
+}
+
+static void test_prof_t() {
+  prof_init();
+  prof_begin(PROF_LOOP);
+  prof_begin(PROF_INPUT);
+  prof_end(PROF_INPUT);
+  prof.phases[PROF_LOOP].begin_cycles = prof.phases[PROF_INPUT].begin_cycles = 42;
+  prof.phases[PROF_INPUT].max_cycles = 7;
+  prof.phases[PROF_INPUT].events[0] = 3;
+
+  // prof r in the middle of the loop: totals go, the loop that is still open keeps its start
+  prof_reset();
+  ASSERT(prof.phases[PROF_INPUT].calls == 0 && prof.phases[PROF_INPUT].max_cycles == 0);
+  ASSERT(prof.phases[PROF_INPUT].events[0] == 0);
+  ASSERT(prof.phases[PROF_LOOP].begin_cycles == 42 && prof.phases[PROF_INPUT].begin_cycles == 42);
+}
+
+static void test_attrib_t() {
+  static attrib_t at;
+  static velocity_t v;
+  attrib_init(&at);
+  velocity_init(&v);
+  const track_t *a = track_find('A');
+  attrib_set_speed(&at, 24, 10);
+  attrib_set_speed(&at, 58, 8);
+
+  // two moving trains nobody has located yet
+  ASSERT(attrib_sensor(&at, a, &v, SENSOR_ID('A', 1), 0) == 0);
+  ASSERT(at.spurious == 1 && at.last_spurious == SENSOR_ID('A', 1));
+  attrib_set_speed(&at, 58, 0);
+  ASSERT(attrib_sensor(&at, a, &v, SENSOR_ID('A', 1), 1000) == 24);
+
+  attrib_train_t *t = attrib_find(&at, 24);
+  ASSERT(t && t->last_sensor == SENSOR_ID('A', 1) && t->predicted_len > 0);
+  for (size_t i = 0; i < t->predicted_len; ++i) {
+    ASSERT(at.expect[t->predicted[i]] & (1u << (t - at.slots)));
+  }
+  unsigned char next = t->predicted[0];
+  ASSERT(attrib_sensor(&at, a, &v, next, 500000) == 24);
+  ASSERT(t->last_sensor == next);
+
+  // the other train is located by a sensor 24 does not expect
+  attrib_set_speed(&at, 58, 8);
+  unsigned char far = 0;
+  while (at.expect[far]) {
+    ++far;
+  }
+  ASSERT(attrib_sensor(&at, a, &v, far, 600000) == 58);
+  ASSERT(attrib_find(&at, 58)->last_sensor == far);
+
+  // after reversing, the train passes the same sensor from the other side
+  attrib_reverse(&at, a, &v, 24);
+  ASSERT(t->last_sensor == (next ^ 1) && t->predicted[0] == (next ^ 1));
+  ASSERT(attrib_sensor(&at, a, &v, next ^ 1, 700000) == 24);
+
+  attrib_unlocate(&at);
+  ASSERT(t->last_sensor == SENSOR_NONE && !at.expect[next ^ 1]);
+  ASSERT(!at.dropped);
+
+  // 17 moving trains: the last one finds no slot, until one of the others stops
+  attrib_init(&at);
+  for (unsigned char train = 1; train <= ATTRIB_SLOTS + 1; ++train) {
+    attrib_set_speed(&at, train, 8);
+  }
+  ASSERT(!attrib_find(&at, ATTRIB_SLOTS + 1) && at.untracked == 1);
+  for (unsigned char train = 1; train <= ATTRIB_SLOTS; ++train) {
+    ASSERT(attrib_find(&at, train));
+  }
+  attrib_set_speed(&at, 5, 0);
+  attrib_set_speed(&at, ATTRIB_SLOTS + 1, 8);
+  ASSERT(attrib_find(&at, ATTRIB_SLOTS + 1) && !attrib_find(&at, 5) && at.untracked == 1);
+  attrib_set_speed(&at, 5, 8);
+  ASSERT(!attrib_find(&at, 5) && at.untracked == 2);
+
+  // the widest fan-out: every switch unknown, from any sensor of any layout, including the sensor
+  // itself after a reversal
+  for (const track_t *track = TRACKS; track < TRACKS + TRACK_COUNT; ++track) {
+    for (unsigned char sensor = 0; sensor < SENSOR_COUNT; ++sensor) {
+      attrib_init(&at);
+      attrib_set_speed(&at, 24, 10);
+      attrib_find(&at, 24)->last_sensor = sensor ^ 1;
+      attrib_reverse(&at, track, &v, 24);
+      ASSERT(!at.dropped);
+    }
+  }
 }
 
 int main() {
   test_clock_t();
   test_queue_t();
   test_train_command();
+  test_hist_t();
+  test_sensor_log_t();
+  test_sensor_poll_t();
+  test_sensor_health_t();
+  test_track_t();
+  test_switch_index();
+  test_track_route();
+  test_fixed();
+  test_velocity_t();
+  test_train_table_t();
+  test_spsc_t();
+  test_trace_t();
+  test_capture_t();
+  test_console_t();
+  test_prof_t();
+  test_attrib_t();
   puts("Tests passed.");
 }
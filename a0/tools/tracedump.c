@@ -0,0 +1,94 @@
+// Decodes a trace dump (see trace.h) into a timeline.
+//
+// usage: tracedump [capture]
+//
+// The capture is whatever was read from the terminal UART around a "trace d" command, e.g. with
+// `cat /dev/ttyUSB0 > capture`; everything before the frame is skipped.
+
+#include <err.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static const char *QUEUE_NAMES[] = {"train", "screen"};
+static const char *TIMER_NAMES[] = {"redraw", "reverse", "resume", "solenoid off"};
+
+static unsigned get_word(const unsigned char *p) {
+  return p[0] | p[1] << 8 | p[2] << 16 | (unsigned)p[3] << 24;
+}
+
+int main(int argc, char **argv) {
+  FILE *in = argc > 1 ? fopen(argv[1], "rb") : stdin;
+  if (!in) {
+    err(1, "%s", argv[1]);
+  }
+  static unsigned char data[1 << 20];
+  size_t len = fread(data, 1, sizeof data, in);
+
+  size_t at = 0;
+  while (at + 16 <= len && get_word(data + at) != 0x31435254) {  // "TRC1"
+    ++at;
+  }
+  if (at + 16 > len) {
+    errx(1, "no trace frame found");
+  }
+  unsigned freq = get_word(data + at + 4), count = get_word(data + at + 8), lost = get_word(data + at + 12);
+  const unsigned char *records = data + at + 16;
+  if (at + 16 + (size_t)count * 8 + 4 > len) {
+    errx(1, "frame is cut short: %u records announced", count);
+  }
+  unsigned sum = 0;
+  for (unsigned i = 0; i < count * 2; ++i) {
+    sum += get_word(records + i * 4);
+  }
+  if (sum != get_word(records + count * 8)) {
+    warnx("checksum mismatch, the frame is corrupted");
+  }
+  if (!freq) {
+    errx(1, "timer frequency is 0");
+  }
+
+  printf("%u records, %u older ones overwritten, timer at %u Hz\n", count, lost, freq);
+  printf("%12s %10s  event\n", "time (us)", "delta");
+  unsigned prev = count ? get_word(records) : 0;
+  unsigned long long since_first = 0;
+  for (unsigned i = 0; i < count; ++i) {
+    const unsigned char *r = records + i * 8;
+    unsigned time = get_word(r);
+    unsigned id = r[4], a = r[5], b = r[6] | r[7] << 8;
+    // times are the low 32 bits of the counter, which wrap every 80 s; the difference between
+    // consecutive records survives a wrap, so the timeline adds those up
+    since_first += time - prev;
+    printf("%12.1f %10.1f  ", (double)since_first * 1e6 / freq, (double)(time - prev) * 1e6 / freq);
+    prev = time;
+    switch (id) {
+    case 0:
+      printf("spi channel %u, %u bytes out, %u in\n", a, b >> 8, b & 0xFF);
+      break;
+    case 1:
+      printf("train tx %u\n", a);
+      break;
+    case 2:
+      printf("sensor rx byte %u = 0x%02x\n", a, b);
+      break;
+    case 3:
+      printf("queue drop: %s, %u bytes\n", a < 2 ? QUEUE_NAMES[a] : "?", b);
+      break;
+    case 4:
+      printf("timer %s%s", a < 4 ? TIMER_NAMES[a] : "?", b ? "" : "\n");
+      if (b) {
+        printf(", train %u\n", b);
+      }
+      break;
+    case 5:
+      printf("feedback %s after %u reply bytes\n", a ? "cut off" : "timeout", b);
+      break;
+    case 6:
+      printf("command kind %u, argument %u\n", a, b);
+      break;
+    default:
+      printf("unknown event %u (%u, %u)\n", id, a, b);
+      break;
+    }
+  }
+  return 0;
+}
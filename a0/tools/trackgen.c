@@ -0,0 +1,503 @@
+// Compiles track descriptions (tracks/*.txt) into constant tables for the kernel.
+//
+// usage: trackgen [-p] tracks/tracka.txt tracks/trackb.txt > track_data.c
+//        trackgen [-p] -h tracks/tracka.txt tracks/trackb.txt > track_switches.h
+//
+// A file with a line starting "# PLACEHOLDER" does not describe the real layout, and is refused
+// unless -p is given, so that no image for the real tracks is built from it by accident.
+//
+// Nodes are numbered so that sensors keep their dense sensor id (A1 is 0, E16 is 79), and every
+// node sits next to its reverse (A1/A2, BRn/MRn, ENn/EXn), so that reverse(n) == n ^ 1.
+
+#include <ctype.h>
+#include <err.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SENSOR_COUNT 80
+#define MAX_SWITCHES 128
+#define MAX_EXITS 32
+#define MAX_NODES (SENSOR_COUNT + 2 * MAX_SWITCHES + 2 * MAX_EXITS)
+// node indices and the "no node" marker have to fit in a byte
+#define MAX_TRACK_NODES 255
+#define NONE 0xFF
+#define MAX_LINKS 8
+
+enum { NODE_NONE, NODE_SENSOR, NODE_BRANCH, NODE_MERGE, NODE_ENTER, NODE_EXIT };
+enum { DIR_AHEAD = 0, DIR_STRAIGHT = 0, DIR_CURVED = 1 };
+
+typedef struct {
+  int type;
+  int num;  // sensor id, switch id, or exit number
+  char name[8];
+  int edge[2];  // destination node per direction, -1 if none
+  int dist[2];
+} node_t;
+
+typedef struct {
+  char letter;
+  const char *path;
+  node_t nodes[MAX_NODES];
+  int node_count;
+  int switch_ids[MAX_SWITCHES];
+  int switch_count;
+  int exit_nums[MAX_EXITS];
+  int exit_count;
+  int placeholder;
+} track_t;
+
+static int parse_num(const char *s) {
+  if (!*s) {
+    return -1;
+  }
+  int n = 0;
+  for (; *s; ++s) {
+    if (!isdigit((unsigned char)*s)) {
+      return -1;
+    }
+    n = n * 10 + (*s - '0');
+  }
+  return n;
+}
+
+// returns the node type and number of a node name, NODE_NONE if it is not one
+static int parse_name(const char *name, int *num) {
+  if (name[0] >= 'A' && name[0] <= 'E' && isdigit((unsigned char)name[1])) {
+    int n = parse_num(name + 1);
+    if (n < 1 || n > 16) {
+      return NODE_NONE;
+    }
+    *num = (name[0] - 'A') * 16 + n - 1;
+    return NODE_SENSOR;
+  }
+  static const struct { const char *prefix; int type; } prefixes[] = {
+    {"BR", NODE_BRANCH}, {"MR", NODE_MERGE}, {"EN", NODE_ENTER}, {"EX", NODE_EXIT},
+  };
+  for (size_t i = 0; i < sizeof prefixes / sizeof prefixes[0]; ++i) {
+    if (strncmp(name, prefixes[i].prefix, 2) == 0) {
+      *num = parse_num(name + 2);
+      return *num > 0 && *num < 256 ? prefixes[i].type : NODE_NONE;
+    }
+  }
+  return NODE_NONE;
+}
+
+static void add_unique(int *list, int *count, int max, int value) {
+  for (int i = 0; i < *count; ++i) {
+    if (list[i] == value) {
+      return;
+    }
+  }
+  if (*count == max) {
+    errx(1, "too many switches or exits");
+  }
+  list[(*count)++] = value;
+}
+
+static int cmp_int(const void *a, const void *b) {
+  return *(const int *)a - *(const int *)b;
+}
+
+static int index_of(const int *list, int count, int value) {
+  for (int i = 0; i < count; ++i) {
+    if (list[i] == value) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+static int node_index(track_t *t, int type, int num) {
+  switch (type) {
+  case NODE_SENSOR:
+    return num;
+  case NODE_BRANCH:
+  case NODE_MERGE:
+    return SENSOR_COUNT + 2 * index_of(t->switch_ids, t->switch_count, num) + (type == NODE_MERGE);
+  default:
+    return SENSOR_COUNT + 2 * t->switch_count + 2 * index_of(t->exit_nums, t->exit_count, num) + (type == NODE_EXIT);
+  }
+}
+
+static int is_dir(const char *tok) {
+  return strcmp(tok, "S") == 0 || strcmp(tok, "C") == 0;
+}
+
+typedef struct {
+  int from_type, from_num, from_dir;
+  int to_type, to_num, to_dir;
+  int dist;
+  int line;
+} segment_t;
+
+static int read_segments(track_t *t, segment_t *segs, int max) {
+  FILE *f = fopen(t->path, "r");
+  if (!f) {
+    err(1, "%s", t->path);
+  }
+  char line[256];
+  int count = 0;
+  for (int lineno = 1; fgets(line, sizeof line, f); ++lineno) {
+    t->placeholder |= strncmp(line, "# PLACEHOLDER", 13) == 0;
+    char *hash = strchr(line, '#');
+    if (hash) {
+      *hash = '\0';
+    }
+    char *tok[6];
+    int ntok = 0;
+    for (char *s = strtok(line, " \t\r\n"); s; s = strtok(NULL, " \t\r\n")) {
+      if (ntok == 6) {
+        errx(1, "%s:%d: too many fields", t->path, lineno);
+      }
+      tok[ntok++] = s;
+    }
+    if (!ntok) {
+      continue;
+    }
+    if (count == max) {
+      errx(1, "%s: too many segments", t->path);
+    }
+    segment_t *seg = &segs[count++];
+    int i = 0;
+    seg->line = lineno;
+    seg->from_type = parse_name(tok[i++], &seg->from_num);
+    seg->from_dir = (i < ntok && is_dir(tok[i])) ? tok[i++][0] == 'C' : -1;
+    seg->to_type = i < ntok ? parse_name(tok[i++], &seg->to_num) : NODE_NONE;
+    seg->to_dir = (i < ntok && is_dir(tok[i])) ? tok[i++][0] == 'C' : -1;
+    seg->dist = i < ntok ? parse_num(tok[i++]) : -1;
+    if (seg->from_type == NODE_NONE || seg->to_type == NODE_NONE || seg->dist <= 0 || i != ntok
+        || seg->from_type == NODE_EXIT || seg->to_type == NODE_ENTER
+        || (seg->from_type == NODE_BRANCH) != (seg->from_dir >= 0)
+        || (seg->to_type == NODE_MERGE) != (seg->to_dir >= 0)) {
+      errx(1, "%s:%d: expected <from> [S|C] <to> [S|C] <mm>", t->path, lineno);
+    }
+  }
+  fclose(f);
+  return count;
+}
+
+static const char *type_prefix(int type) {
+  static const char *prefixes[] = {"", "", "BR", "MR", "EN", "EX"};
+  return prefixes[type];
+}
+
+static void set_edge(track_t *t, int from, int dir, int to, int dist, int line) {
+  node_t *n = &t->nodes[from];
+  if (n->edge[dir] >= 0) {
+    errx(1, "%s:%d: %s already leads to %s", t->path, line, n->name, t->nodes[n->edge[dir]].name);
+  }
+  n->edge[dir] = to;
+  n->dist[dir] = dist;
+}
+
+static void load_track(track_t *t) {
+  static segment_t segs[MAX_NODES];
+  int count = read_segments(t, segs, MAX_NODES);
+
+  for (int i = 0; i < count; ++i) {
+    segment_t *seg = &segs[i];
+    if (seg->from_type == NODE_BRANCH || seg->from_type == NODE_MERGE) {
+      add_unique(t->switch_ids, &t->switch_count, MAX_SWITCHES, seg->from_num);
+    } else if (seg->from_type == NODE_ENTER) {
+      add_unique(t->exit_nums, &t->exit_count, MAX_EXITS, seg->from_num);
+    }
+    if (seg->to_type == NODE_BRANCH || seg->to_type == NODE_MERGE) {
+      add_unique(t->switch_ids, &t->switch_count, MAX_SWITCHES, seg->to_num);
+    } else if (seg->to_type == NODE_EXIT) {
+      add_unique(t->exit_nums, &t->exit_count, MAX_EXITS, seg->to_num);
+    }
+  }
+  qsort(t->switch_ids, t->switch_count, sizeof(int), cmp_int);
+  qsort(t->exit_nums, t->exit_count, sizeof(int), cmp_int);
+
+  t->node_count = SENSOR_COUNT + 2 * t->switch_count + 2 * t->exit_count;
+  if (t->node_count > MAX_TRACK_NODES) {
+    errx(1, "%s: too many nodes", t->path);
+  }
+  for (int i = 0; i < t->node_count; ++i) {
+    node_t *n = &t->nodes[i];
+    n->edge[0] = n->edge[1] = -1;
+    if (i < SENSOR_COUNT) {
+      n->type = NODE_SENSOR;
+      n->num = i;
+      snprintf(n->name, sizeof n->name, "%c%d", 'A' + i / 16, i % 16 + 1);
+    } else if (i < SENSOR_COUNT + 2 * t->switch_count) {
+      n->type = (i - SENSOR_COUNT) % 2 ? NODE_MERGE : NODE_BRANCH;
+      n->num = t->switch_ids[(i - SENSOR_COUNT) / 2];
+    } else {
+      int j = i - SENSOR_COUNT - 2 * t->switch_count;
+      n->type = j % 2 ? NODE_EXIT : NODE_ENTER;
+      n->num = t->exit_nums[j / 2];
+    }
+    if (n->type != NODE_SENSOR) {
+      snprintf(n->name, sizeof n->name, "%s%d", type_prefix(n->type), n->num);
+    }
+  }
+
+  for (int i = 0; i < count; ++i) {
+    segment_t *seg = &segs[i];
+    int from = node_index(t, seg->from_type, seg->from_num);
+    int to = node_index(t, seg->to_type, seg->to_num);
+    set_edge(t, from, seg->from_dir < 0 ? DIR_AHEAD : seg->from_dir, to, seg->dist, seg->line);
+    // the same piece of track travelled the other way; a merge entered from one side is the
+    // branch set to that side
+    set_edge(t, to ^ 1, seg->to_dir < 0 ? DIR_AHEAD : seg->to_dir, from ^ 1, seg->dist, seg->line);
+  }
+
+  for (int i = 0; i < t->node_count; ++i) {
+    node_t *n = &t->nodes[i];
+    int expect = n->type == NODE_BRANCH ? 2 : n->type == NODE_EXIT ? 0 : 1;
+    int have = (n->edge[0] >= 0) + (n->edge[1] >= 0);
+    if (have != expect) {
+      errx(1, "%s: %s has %d outgoing segments, expected %d", t->path, n->name, have, expect);
+    }
+  }
+}
+
+typedef struct {
+  int sensor, dist;
+} link_t;
+
+// sensors reachable from node without passing another sensor
+static void collect_links(track_t *t, int node, int dist, int depth, link_t *links, int *count) {
+  if (depth > t->node_count) {
+    errx(1, "%s: a loop of track has no sensor on it", t->path);
+  }
+  node_t *n = &t->nodes[node];
+  for (int dir = 0; dir < 2; ++dir) {
+    if (n->edge[dir] < 0) {
+      continue;
+    }
+    int next = n->edge[dir], next_dist = dist + n->dist[dir];
+    if (t->nodes[next].type == NODE_SENSOR) {
+      if (*count == MAX_LINKS) {
+        errx(1, "%s: too many sensors follow %s", t->path, t->nodes[node].name);
+      }
+      links[*count].sensor = next;
+      links[(*count)++].dist = next_dist;
+    } else {
+      collect_links(t, next, next_dist, depth + 1, links, count);
+    }
+  }
+}
+
+// shortest distances from src, and the direction to leave src in to get to each node that way
+static void shortest_paths(track_t *t, int src, int *dist, int *first_dir) {
+  static int done[MAX_NODES];
+  for (int i = 0; i < t->node_count; ++i) {
+    dist[i] = -1;
+    first_dir[i] = NONE;
+    done[i] = 0;
+  }
+  dist[src] = 0;
+  for (;;) {
+    int best = -1;
+    for (int i = 0; i < t->node_count; ++i) {
+      if (!done[i] && dist[i] >= 0 && (best < 0 || dist[i] < dist[best])) {
+        best = i;
+      }
+    }
+    if (best < 0) {
+      break;
+    }
+    done[best] = 1;
+    node_t *n = &t->nodes[best];
+    for (int dir = 0; dir < 2; ++dir) {
+      int next = n->edge[dir];
+      if (next < 0) {
+        continue;
+      }
+      int d = dist[best] + n->dist[dir];
+      if (dist[next] < 0 || d < dist[next]) {
+        dist[next] = d;
+        first_dir[next] = best == src ? dir : first_dir[best];
+      }
+    }
+  }
+  // routes end where they start
+  first_dir[src] = NONE;
+}
+
+static const char *type_enum(int type) {
+  static const char *names[] = {
+    "", "TRACK_NODE_SENSOR", "TRACK_NODE_BRANCH", "TRACK_NODE_MERGE", "TRACK_NODE_ENTER", "TRACK_NODE_EXIT",
+  };
+  return names[type];
+}
+
+static void emit_track(track_t *t) {
+  char c = t->letter;
+  printf("\n// %s\n", t->path);
+
+  link_t links[SENSOR_COUNT][MAX_LINKS];
+  int link_count[SENSOR_COUNT] = {0};
+  for (int s = 0; s < SENSOR_COUNT; ++s) {
+    collect_links(t, s, 0, 0, links[s], &link_count[s]);
+  }
+
+  printf("static const unsigned short TRACK%c_SENSOR_LINK_BEGIN[%d] = {", c, SENSOR_COUNT + 1);
+  for (int s = 0, total = 0; s <= SENSOR_COUNT; ++s) {
+    printf("%s%d,", s % 16 ? " " : "\n  ", total);
+    total += s < SENSOR_COUNT ? link_count[s] : 0;
+  }
+  printf("\n};\n\n");
+
+  printf("static const track_sensor_link_t TRACK%c_SENSOR_LINKS[] = {", c);
+  for (int s = 0, k = 0; s < SENSOR_COUNT; ++s) {
+    for (int i = 0; i < link_count[s]; ++i, ++k) {
+      printf("%s{%d, %d},", k % 8 ? " " : "\n  ", links[s][i].sensor, links[s][i].dist);
+    }
+  }
+  printf("\n};\n\n");
+
+  int n = t->node_count;
+  printf("static const unsigned char TRACK%c_NODE_TYPE[%d] = {", c, n);
+  for (int i = 0; i < n; ++i) {
+    printf("%s%s,", i % 4 ? " " : "\n  ", type_enum(t->nodes[i].type));
+  }
+  printf("\n};\n\n");
+
+  printf("static const unsigned char TRACK%c_NODE_NUM[%d] = {", c, n);
+  for (int i = 0; i < n; ++i) {
+    printf("%s%d,", i % 16 ? " " : "\n  ", t->nodes[i].num);
+  }
+  printf("\n};\n\n");
+
+  printf("static const unsigned char TRACK%c_EDGE[%d][2] = {", c, n);
+  for (int i = 0; i < n; ++i) {
+    node_t *node = &t->nodes[i];
+    printf("%s{%d, %d},", i % 8 ? " " : "\n  ", node->edge[0] < 0 ? NONE : node->edge[0],
+           node->edge[1] < 0 ? NONE : node->edge[1]);
+  }
+  printf("\n};\n\n");
+
+  printf("static const unsigned short TRACK%c_EDGE_DIST[%d][2] = {", c, n);
+  for (int i = 0; i < n; ++i) {
+    node_t *node = &t->nodes[i];
+    printf("%s{%d, %d},", i % 8 ? " " : "\n  ", node->edge[0] < 0 ? 0 : node->dist[0],
+           node->edge[1] < 0 ? 0 : node->dist[1]);
+  }
+  printf("\n};\n\n");
+
+  // row i, column j: how to leave i to get to j, and how far j is from i
+  static int dist[MAX_TRACK_NODES][MAX_TRACK_NODES], first_dir[MAX_TRACK_NODES][MAX_TRACK_NODES];
+  for (int i = 0; i < n; ++i) {
+    shortest_paths(t, i, dist[i], first_dir[i]);
+    for (int j = 0; j < n; ++j) {
+      if (dist[i][j] > 0xFFFE) {
+        errx(1, "%s: %s is too far from %s", t->path, t->nodes[j].name, t->nodes[i].name);
+      }
+    }
+  }
+  printf("static const unsigned char TRACK%c_NEXT_DIR[%d * %d] = {", c, n, n);
+  for (int i = 0; i < n; ++i) {
+    printf("\n  // %s", t->nodes[i].name);
+    for (int j = 0; j < n; ++j) {
+      printf("%s%d,", j % 32 ? " " : "\n  ", first_dir[i][j]);
+    }
+  }
+  printf("\n};\n\n");
+
+  printf("static const unsigned short TRACK%c_DIST[%d * %d] = {", c, n, n);
+  for (int i = 0; i < n; ++i) {
+    printf("\n  // %s", t->nodes[i].name);
+    for (int j = 0; j < n; ++j) {
+      printf("%s%d,", j % 16 ? " " : "\n  ", dist[i][j] < 0 ? 0xFFFF : dist[i][j]);
+    }
+  }
+  printf("\n};\n");
+}
+
+// switch ids of all layouts, so that switch state does not depend on which layout is in use
+static int all_switches(track_t *tracks, int count, int *ids) {
+  int n = 0;
+  for (int i = 0; i < count; ++i) {
+    for (int j = 0; j < tracks[i].switch_count; ++j) {
+      int id = tracks[i].switch_ids[j];
+      // the id is sent as one command byte, and the dense index must not collide with NONE
+      if (id < 1 || id > 255) {
+        errx(1, "%s: switch %d cannot be addressed", tracks[i].path, id);
+      }
+      add_unique(ids, &n, NONE, id);
+    }
+  }
+  qsort(ids, n, sizeof(int), cmp_int);
+  return n;
+}
+
+static void emit_switches(const int *ids, int n) {
+  int index[256];
+  memset(index, 0xFF, sizeof index);
+  for (int i = 0; i < n; ++i) {
+    index[ids[i]] = i;
+  }
+  printf("\nconst unsigned char SWITCH_INDEX[256] = {");
+  for (int i = 0; i < 256; ++i) {
+    printf("%s%d,", i % 16 ? " " : "\n  ", index[i] < 0 ? NONE : index[i]);
+  }
+  printf("\n};\n\nconst unsigned char SWITCH_IDS[SWITCH_COUNT] = {");
+  for (int i = 0; i < n; ++i) {
+    printf("%s%d,", i % 16 ? " " : "\n  ", ids[i]);
+  }
+  printf("\n};\n");
+}
+
+int main(int argc, char **argv) {
+  int header = 0, placeholders = 0, first = 1;
+  for (; first < argc && argv[first][0] == '-'; ++first) {
+    if (strcmp(argv[first], "-h") == 0) {
+      header = 1;
+    } else if (strcmp(argv[first], "-p") == 0) {
+      placeholders = 1;
+    } else {
+      break;
+    }
+  }
+  if (first == argc) {
+    errx(1, "usage: %s [-p] [-h] track.txt...", argv[0]);
+  }
+  static track_t tracks[8];
+  int count = argc - first;
+  if (count > 8) {
+    errx(1, "too many tracks");
+  }
+  for (int i = 0; i < count; ++i) {
+    track_t *t = &tracks[i];
+    t->path = argv[first + i];
+    // tracks/tracka.txt is track A
+    const char *dot = strrchr(t->path, '.');
+    if (!dot || dot == t->path || !isalpha((unsigned char)dot[-1])) {
+      errx(1, "%s: cannot tell track letter from file name", t->path);
+    }
+    t->letter = toupper((unsigned char)dot[-1]);
+    load_track(t);
+    if (t->placeholder && !placeholders) {
+      errx(1, "%s: placeholder, not the real layout; replace it, or pass -p to use it anyway", t->path);
+    }
+  }
+  static int switch_ids[NONE];
+  int switch_count = all_switches(tracks, count, switch_ids);
+
+  if (header) {
+    printf("// generated by tools/trackgen.c, do not edit\n\n#pragma once\n\n");
+    printf("// distinct switch ids over all layouts\n#define SWITCH_COUNT %d\n", switch_count);
+    return 0;
+  }
+
+  printf("// generated by tools/trackgen.c, do not edit\n\n#include \"track.h\"\n");
+  emit_switches(switch_ids, switch_count);
+  for (int i = 0; i < count; ++i) {
+    emit_track(&tracks[i]);
+  }
+  printf("\nconst track_t TRACKS[] = {\n");
+  for (int i = 0; i < count; ++i) {
+    char c = tracks[i].letter;
+    printf("  {\n    '%c', %d,\n", c, tracks[i].node_count);
+    printf("    TRACK%c_NODE_TYPE, TRACK%c_NODE_NUM, TRACK%c_EDGE, TRACK%c_EDGE_DIST,\n", c, c, c, c);
+    printf("    TRACK%c_NEXT_DIR, TRACK%c_DIST,\n", c, c);
+    printf("    TRACK%c_SENSOR_LINK_BEGIN, TRACK%c_SENSOR_LINKS,\n  },\n", c, c);
+  }
+  printf("};\n\nconst size_t TRACK_COUNT = %d;\n", count);
+  return 0;
+}
@@ -0,0 +1,65 @@
+#include "trace.h"
+#include "util.h"
+
+#define ASSERT(x)  // TODO
+
+trace_t trace;
+
+void trace_init(void) {
+  memset(&trace, 0, sizeof trace);
+  trace.mask = ((1u << TRACE_EVENTS) - 1) & ~(1u << TRACE_SPI);
+}
+
+static unsigned record_word(size_t i, size_t word) {
+  const unsigned char *p = (const unsigned char *)&trace.records[(trace.dump_first + i) % TRACE_SIZE];
+  p += word * 4;
+  return p[0] | p[1] << 8 | p[2] << 16 | (unsigned)p[3] << 24;
+}
+
+void trace_dump_begin(unsigned freq) {
+  trace.mask = 0;
+  trace.dump_count = trace.head < TRACE_SIZE ? trace.head : TRACE_SIZE;
+  trace.dump_first = trace.head - trace.dump_count;
+  trace.dump_freq = freq;
+  trace.dump_sum = 0;
+  for (size_t i = 0; i < trace.dump_count; ++i) {
+    trace.dump_sum += record_word(i, 0) + record_word(i, 1);
+  }
+}
+
+// little endian, whatever the host is
+static void put_word(char *out, unsigned v) {
+  out[0] = v;
+  out[1] = v >> 8;
+  out[2] = v >> 16;
+  out[3] = v >> 24;
+}
+
+static char frame_byte(size_t pos) {
+  char word[4];
+  size_t records_end = TRACE_HEADER_BYTES + trace.dump_count * sizeof(trace_record_t);
+  if (pos < TRACE_HEADER_BYTES) {
+    unsigned header[] = {0x31435254, trace.dump_freq, trace.dump_count, trace.dump_first};  // "TRC1"
+    put_word(word, header[pos / 4]);
+  } else if (pos < records_end) {
+    size_t offset = pos - TRACE_HEADER_BYTES;
+    put_word(word, record_word(offset / sizeof(trace_record_t), offset % sizeof(trace_record_t) / 4));
+  } else {
+    put_word(word, trace.dump_sum);
+  }
+  return word[pos % 4];
+}
+
+size_t trace_dump_read(size_t pos, char *out, size_t max) {
+  ASSERT(out);
+  size_t end = TRACE_FRAME_BYTES(trace.dump_count);
+  size_t n = 0;
+  for (; pos < end && n < max; ++pos, ++n) {
+    out[n] = frame_byte(pos);
+  }
+  return n;
+}
+
+void trace_dump_end(unsigned mask) {
+  trace.mask = mask;
+}
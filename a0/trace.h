@@ -0,0 +1,87 @@
+#pragma once
+
+#include <stddef.h>
+
+#define TRACE_SIZE 2048  // records; must be a power of two
+
+enum {
+  TRACE_SPI,  // a: spi channel, b: bytes sent << 8 | bytes received
+  TRACE_TRAIN_TX,  // a: byte sent to the track controller
+  TRACE_SENSOR_RX,  // a: byte index in the dump (0-9), b: the byte
+  TRACE_QUEUE_DROP,  // a: TRACE_QUEUE_*, b: bytes dropped
+  TRACE_TIMER,  // a: TRACE_TIMER_*, b: train or 0
+  TRACE_FEEDBACK_TIMEOUT,  // a: 1 if the reply stopped partway, b: bytes of it that did arrive
+  TRACE_COMMAND,  // a: command kind, b: its first argument
+  TRACE_EVENTS,
+};
+
+enum { TRACE_QUEUE_TRAIN, TRACE_QUEUE_SCREEN };
+enum { TRACE_TIMER_REDRAW, TRACE_TIMER_REVERSE, TRACE_TIMER_RESUME, TRACE_TIMER_SOLENOID };
+
+typedef struct {
+  unsigned time;  // low bits of the generic timer (CNTPCT_EL0)
+  unsigned char id, a;
+  unsigned short b;
+} trace_record_t;
+
+/**
+ * Fixed-size ring of binary trace records, overwritten oldest first.
+ *
+ * There is a single writer (the main loop and the drivers it calls), so recording is a counter
+ * read, one 8 byte store and an increment. mask selects which event ids are recorded; clearing it
+ * pauses tracing, e.g. while the ring is being dumped.
+ *
+ * A dump is a frame of little endian words: "TRC1", the counter frequency, the record count and
+ * the number of records lost to wrapping, then the records oldest first, then the sum of all
+ * record words. tools/tracedump.c turns it into a timeline.
+ */
+typedef struct {
+  trace_record_t records[TRACE_SIZE];
+  unsigned head;  // total records written
+  unsigned mask;  // bit per event id
+  // state of the dump in progress
+  unsigned dump_first, dump_count, dump_sum, dump_freq;
+} trace_t;
+
+extern trace_t trace;
+
+#define TRACE_HEADER_BYTES 16
+#define TRACE_FRAME_BYTES(count) (TRACE_HEADER_BYTES + (count) * sizeof(trace_record_t) + 4)
+
+// the generic timer; trace records keep only its low 32 bits, which wrap every 80 s at 54 MHz
+static inline unsigned long long trace_clock64(void) {
+#ifdef __aarch64__
+  unsigned long long v;
+  asm volatile("mrs %0, cntpct_el0" : "=r"(v));
+  return v;
+#else
+  return 0;
+#endif
+}
+
+static inline unsigned trace_clock(void) {
+  return trace_clock64();
+}
+
+static inline void trace_event(unsigned char id, unsigned char a, unsigned short b) {
+  if (trace.mask & (1u << id)) {
+    trace_record_t *r = &trace.records[trace.head++ % TRACE_SIZE];
+    r->time = trace_clock();
+    r->id = id;
+    r->a = a;
+    r->b = b;
+  }
+}
+
+// clears the ring and records every event but TRACE_SPI, which is the most frequent by far
+void trace_init(void);
+
+// pauses tracing and snapshots the ring for trace_dump_read; freq is the timer frequency in Hz
+void trace_dump_begin(unsigned freq);
+
+// copies up to max bytes of the dump frame, starting at byte pos, to out; returns how many
+// were copied, 0 at the end of the frame
+size_t trace_dump_read(size_t pos, char *out, size_t max);
+
+// resumes tracing with the given mask
+void trace_dump_end(unsigned mask);
@@ -0,0 +1,49 @@
+#include "track.h"
+
+#define ASSERT(x)  // TODO
+
+const track_t *track_find(char name) {
+  for (size_t i = 0; i < TRACK_COUNT; ++i) {
+    if (TRACKS[i].name == name) {
+      return &TRACKS[i];
+    }
+  }
+  return 0;
+}
+
+unsigned track_sensor_distance(const track_t *track, unsigned char from, unsigned char to) {
+  ASSERT(track);
+  for (unsigned i = track->sensor_link_begin[from]; i < track->sensor_link_begin[from + 1]; ++i) {
+    if (track->sensor_links[i].sensor == to) {
+      return track->sensor_links[i].dist;
+    }
+  }
+  return 0;
+}
+
+int track_route(const track_t *track, unsigned char from, unsigned char to, track_switch_t *switches, size_t max,
+                unsigned *dist) {
+  ASSERT(track);
+  ASSERT(from < track->node_count && to < track->node_count);
+  size_t n = track->node_count;
+  if (from != to && track->next_dir[from * n + to] == TRACK_NONE) {
+    return -1;
+  }
+  if (dist) {
+    *dist = from == to ? 0 : track->dist[from * n + to];
+  }
+  size_t count = 0;
+  for (unsigned char node = from; node != to;) {
+    unsigned char dir = track->next_dir[node * n + to];
+    if (track->node_type[node] == TRACK_NODE_BRANCH) {
+      if (count == max) {
+        return -1;  // setting only some of the switches would send the train elsewhere
+      }
+      switches[count].id = track->node_num[node];
+      switches[count].curved = dir;
+      ++count;
+    }
+    node = track->edge[node][dir];
+  }
+  return count;
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <stddef.h>
+#include "track_switches.h"  // generated, defines SWITCH_COUNT
+
+enum {
+  TRACK_NODE_SENSOR,
+  TRACK_NODE_BRANCH,
+  TRACK_NODE_MERGE,
+  TRACK_NODE_ENTER,
+  TRACK_NODE_EXIT,
+};
+
+// directions out of a node; only branches have a curved one
+enum { TRACK_AHEAD = 0, TRACK_STRAIGHT = 0, TRACK_CURVED = 1 };
+
+#define TRACK_NONE 0xFF
+
+typedef struct {
+  unsigned char sensor;
+  unsigned short dist;  // mm
+} track_sensor_link_t;
+
+typedef struct {
+  unsigned char id;
+  unsigned char curved;
+} track_switch_t;
+
+/**
+ * Constant tables compiled from the descriptions in tracks/ by tools/trackgen.c.
+ *
+ * Nodes 0-79 are the sensors, by sensor id. Every node is next to its reverse, so the reverse of
+ * node n is n ^ 1 (A1/A2, BRn/MRn, ENn/EXn). node_num is the sensor id, switch id or exit number.
+ *
+ * next_dir and dist are node_count x node_count, row major: next_dir[i * node_count + j] is the
+ * direction to leave i in to be on the shortest path to j (TRACK_NONE if j cannot be reached or
+ * i == j), dist the length of that path in mm.
+ *
+ * The sensors that can be reached from sensor s without passing another sensor (under any switch
+ * setting) are sensor_links[sensor_link_begin[s]] up to sensor_links[sensor_link_begin[s + 1]].
+ */
+typedef struct {
+  char name;
+  unsigned char node_count;
+  const unsigned char *node_type;
+  const unsigned char *node_num;
+  const unsigned char (*edge)[2];  // destination per direction, TRACK_NONE if none
+  const unsigned short (*edge_dist)[2];
+  const unsigned char *next_dir;
+  const unsigned short *dist;
+  const unsigned short *sensor_link_begin;
+  const track_sensor_link_t *sensor_links;
+} track_t;
+
+// switches are kept in dense arrays of SWITCH_COUNT, covering the switches of every layout:
+// SWITCH_INDEX maps a switch id to its index (TRACK_NONE if no layout has it) and SWITCH_IDS back
+extern const unsigned char SWITCH_INDEX[256];
+extern const unsigned char SWITCH_IDS[SWITCH_COUNT];
+
+extern const track_t TRACKS[];
+extern const size_t TRACK_COUNT;
+
+// returns the track with the given name, or null
+const track_t *track_find(char name);
+
+// distance in mm from one sensor to the next one, 0 if the train cannot get there without passing
+// another sensor first
+unsigned track_sensor_distance(const track_t *, unsigned char from, unsigned char to);
+
+// walks the shortest path between two nodes and writes the switch settings it needs in the order
+// they are passed; returns how many switches the path needs, or -1 if there is no path or it needs
+// more than max. if dist is not null, the length of the path is written there
+int track_route(const track_t *, unsigned char from, unsigned char to, track_switch_t *switches, size_t max,
+                unsigned *dist);
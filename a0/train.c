@@ -0,0 +1,55 @@
+#include "train.h"
+#include "sensor.h"
+#include "util.h"
+
+#define ASSERT(x)  // TODO
+
+void train_table_init(train_table_t *t) {
+  ASSERT(t);
+  memset(t, 0, sizeof *t);
+}
+
+train_state_t *train_find(train_table_t *t, unsigned char number) {
+  ASSERT(t);
+  ASSERT(number <= TRAIN_MAX);
+  train_state_t *s = &t->trains[number];
+  return s->column < t->active_count && t->active[s->column] == number ? s : 0;
+}
+
+train_state_t *train_get(train_table_t *t, unsigned char number) {
+  ASSERT(t);
+  ASSERT(number <= TRAIN_MAX);
+  train_state_t *s = train_find(t, number);
+  if (!s) {
+    s = &t->trains[number];
+    s->column = t->active_count;
+    s->last_sensor = SENSOR_NONE;
+    t->active[t->active_count++] = number;
+    train_touch(t, number);
+  }
+  return s;
+}
+
+void train_touch(train_table_t *t, unsigned char number) {
+  ASSERT(t);
+  train_state_t *s = &t->trains[number];
+  if (!s->dirty) {
+    s->dirty = 1;
+    t->journal[t->journal_count++] = number;
+  }
+}
+
+void train_touch_all(train_table_t *t) {
+  ASSERT(t);
+  for (size_t i = 0; i < t->active_count; ++i) {
+    train_touch(t, t->active[i]);
+  }
+}
+
+void train_journal_clear(train_table_t *t) {
+  ASSERT(t);
+  for (size_t i = 0; i < t->journal_count; ++i) {
+    t->trains[t->journal[i]].dirty = 0;
+  }
+  t->journal_count = 0;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stddef.h>
+
+#define TRAIN_MAX 80  // highest train number
+
+typedef struct {
+  unsigned char speed;  // last speed sent, with the lights bit
+  unsigned char reversed;  // direction, relative to the one the train started in
+  // 0 if not reversing, 1 while slowing down before the reverse command, 2 after it was sent
+  unsigned char reversing;
+  unsigned char resume_speed;  // speed to go back to once reversed
+  unsigned reverse_from;  // when the current reversal step started
+  unsigned reverse_wait;  // how long the train is given to stop before the reverse command
+  unsigned last_cmd_time;
+  unsigned char last_sensor;  // last sensor attributed to the train, SENSOR_NONE if none
+  unsigned char column;  // position in the active list
+  unsigned char dirty;  // in the journal
+} train_state_t;
+
+/**
+ * Per-train state, indexed directly by train number.
+ *
+ * active lists the trains that were ever given a command, in that order; it is what gets drawn,
+ * one column per train. Every change goes through train_touch, which adds the train to the
+ * journal once; the renderer redraws the journaled trains and clears it, so a frame costs the
+ * number of changes rather than the number of trains.
+ */
+typedef struct {
+  train_state_t trains[TRAIN_MAX + 1];
+  unsigned char active[TRAIN_MAX + 1];
+  size_t active_count;
+  unsigned char journal[TRAIN_MAX + 1];
+  size_t journal_count;
+  size_t reversing_count;  // trains with a reversal in progress
+} train_table_t;
+
+void train_table_init(train_table_t *);
+
+// state of a train, adding it to the active list if it is new
+train_state_t *train_get(train_table_t *, unsigned char number);
+
+// state of a train, or null if it never got a command
+train_state_t *train_find(train_table_t *, unsigned char number);
+
+// records that the train changed and has to be redrawn
+void train_touch(train_table_t *, unsigned char number);
+
+// puts every active train in the journal, e.g. when the screen has to be redrawn from scratch
+void train_touch_all(train_table_t *);
+
+// empties the journal
+void train_journal_clear(train_table_t *);
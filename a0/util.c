@@ -1,9 +1,10 @@
 #include "util.h"
+#include "section.h"
 
 #define ASSERT(x)  // TODO
 
 // source: https://stackoverflow.com/a/32213487
-int utoa(unsigned value, char *ptr) {
+HOT int utoa(unsigned value, char *ptr) {
   ASSERT(ptr);
   int count = 0, temp;
   if (value == 0) {
@@ -19,12 +20,12 @@ int utoa(unsigned value, char *ptr) {
   return count;
 }
 
-void display_clock_init(display_clock_t *cl) {
+COLD void display_clock_init(display_clock_t *cl) {
   ASSERT(cl);
   cl->min = cl->sec = cl->tenth = 0;
 }
 
-void display_clock_advance(display_clock_t *cl) {
+HOT void display_clock_advance(display_clock_t *cl) {
   ASSERT(cl);
   int carry_min = 0, carry_sec = 0;
   cl->tenth += 1;
@@ -48,7 +49,7 @@ void display_clock_advance(display_clock_t *cl) {
   }
 }
 
-int display_clock_sprint(display_clock_t *cl, char *buf) {
+HOT int display_clock_sprint(display_clock_t *cl, char *buf) {
   ASSERT(cl);
   ASSERT(buf);
   // mmm:ss:m0
@@ -65,21 +66,39 @@ int display_clock_sprint(display_clock_t *cl, char *buf) {
   return 9;
 }
 
+#ifdef SIMD
+// 16 bytes a register; the accesses may be unaligned, which only normal memory allows, so SIMD
+// builds need the mmu on
+typedef unsigned char bytes16_t __attribute__((vector_size(16), aligned(1), may_alias));
+#endif
+
 // define our own memset to avoid SIMD instructions emitted from the compiler
-void *memset(void *s, int c, size_t n) {
-  for (char* it = (char*)s; n > 0; --n) *it++ = c;
+HOT void *memset(void *s, int c, size_t n) {
+  char *it = (char *)s;
+#ifdef SIMD
+  bytes16_t v = (bytes16_t){0} + (unsigned char)c;
+  for (; n >= 16; n -= 16, it += 16) {
+    *(bytes16_t *)it = v;
+  }
+#endif
+  for (; n > 0; --n) *it++ = c;
   return s;
 }
 
 // define our own memcpy to avoid SIMD instructions emitted from the compiler
-void* memcpy(void* restrict dest, const void* restrict src, size_t n) {
+HOT void* memcpy(void* restrict dest, const void* restrict src, size_t n) {
     char* sit = (char*)src;
     char* cdest = (char*)dest;
+#ifdef SIMD
+    for (; n >= 16; n -= 16, sit += 16, cdest += 16) {
+      *(bytes16_t *)cdest = *(const bytes16_t *)sit;
+    }
+#endif
     for (size_t i = 0; i < n; ++i) *(cdest++) = *(sit++);
     return dest;
 }
 
-void queue_init(queue_t *q, char *data, size_t capacity) {
+COLD void queue_init(queue_t *q, char *data, size_t capacity) {
   ASSERT(q);
   ASSERT(data);
   ASSERT(capacity);
@@ -89,21 +108,24 @@ void queue_init(queue_t *q, char *data, size_t capacity) {
   q->end = 0;
 }
 
-void queue_emplace(queue_t *q, const char *src, size_t len) {
+HOT void queue_emplace(queue_t *q, const char *src, size_t len) {
   ASSERT(q);
   ASSERT(src);
-  size_t i = 0;
+  size_t i = 0, run;
   if (q->begin <= q->end) {
     size_t end = q->begin == 0 ? q->capacity - 1 : q->capacity;
-    while (i < len && q->end < end) {
-      q->data[q->end++] = src[i++];
-    }
+    run = len < end - q->end ? len : end - q->end;
+    memcpy(q->data + q->end, src, run);
+    q->end += run;
+    i = run;
     if (q->end == q->capacity) {
       q->end = 0;
 from_left:
-      while (i < len && q->end < q->begin - 1) {
-        q->data[q->end++] = src[i++];
-      }
+      // begin is past end here, so at least 1
+      run = len - i < q->begin - 1 - q->end ? len - i : q->begin - 1 - q->end;
+      memcpy(q->data + q->end, src + i, run);
+      q->end += run;
+      i += run;
       // we just silently reject new inputs if buffer cannot hold them
       ASSERT(i >= len);
     }
@@ -112,7 +134,7 @@ from_left:
   }
 }
 
-void queue_consume(queue_t *q, size_t len) {
+HOT void queue_consume(queue_t *q, size_t len) {
   ASSERT(q);
   size_t end = q->begin <= q->end ? q->end : q->capacity;
   size_t right_size = end - q->begin;
@@ -124,7 +146,7 @@ void queue_consume(queue_t *q, size_t len) {
   }
 }
 
-char *queue_longest_data(queue_t *q, size_t *len) {
+HOT char *queue_longest_data(queue_t *q, size_t *len) {
   ASSERT(q);
   if (len) {
     size_t end = q->begin <= q->end ? q->end : q->capacity;
@@ -133,95 +155,62 @@ char *queue_longest_data(queue_t *q, size_t *len) {
   return q->data + q->begin;
 }
 
-static int isnum(char c) {
-  return c >= '0' && c <= '9';
+HOT size_t queue_size(queue_t *q) {
+  ASSERT(q);
+  return q->begin <= q->end ? q->end - q->begin : q->capacity - q->begin + q->end;
 }
 
-static int match_two_digits(char *buf, size_t *i, size_t len, unsigned char *out, int three_ok) {
-  ASSERT(buf);
-  ASSERT(out);
-  if (!len) {
-    return 0;
+static const unsigned HIST_SUB_COUNT = 1u << HIST_SUB_BITS;
+
+HOT static size_t hist_bucket(unsigned value) {
+  if (value < HIST_SUB_COUNT) {
+    return value;
   }
-  if (three_ok && len-*i >= 3 && isnum(buf[*i]) && isnum(buf[*i+1]) && isnum(buf[*i+2])) {
-    *out = (buf[*i] - '0') * 100 + (buf[*i+1] - '0') * 10 + (buf[*i+2] - '0');
-    *i += 3;
-    return 1;
-  } else if (isnum(buf[*i]) && (len-*i == 1 || !isnum(buf[*i+1]))) {
-    *out = buf[*i] - '0';
-    ++*i;
-    return 1;
-  } else if (isnum(buf[*i]) && isnum(buf[*i+1])) {
-    *out = (buf[*i] - '0') * 10 + (buf[*i+1] - '0');
-    *i += 2;
-    return 1;
+  unsigned shift = 31 - __builtin_clz(value) - HIST_SUB_BITS;
+  return ((shift + 1) << HIST_SUB_BITS) + (value >> shift) - HIST_SUB_COUNT;
+}
+
+// largest value that falls into the bucket
+HOT static unsigned hist_bucket_top(size_t bucket) {
+  if (bucket < HIST_SUB_COUNT) {
+    return bucket;
   }
-  return 0;
+  unsigned shift = (bucket >> HIST_SUB_BITS) - 1;
+  unsigned mantissa = (bucket & (HIST_SUB_COUNT - 1)) + HIST_SUB_COUNT;
+  return ((mantissa + 1) << shift) - 1;  // wraps to the largest unsigned for the last bucket
+}
+
+void hist_reset(hist_t *h) {
+  ASSERT(h);
+  memset(h, 0, sizeof *h);
 }
 
-static void eat_whitespace(char *buf, size_t *i, size_t len) {
-  while (*i < len && (buf[*i] == ' ' || buf[*i] == '\t')) {
-    ++*i;
+HOT void hist_add(hist_t *h, unsigned value) {
+  ASSERT(h);
+  ++h->counts[hist_bucket(value)];
+  ++h->total;
+  if (value > h->max) {
+    h->max = value;
   }
 }
 
-static int match_start(char *buf, size_t *i, size_t buflen, char *target, size_t target_len) {
-  if (buflen - *i < target_len) {
+HOT unsigned hist_percentile(hist_t *h, unsigned per10000) {
+  ASSERT(h);
+  if (!h->total) {
     return 0;
   }
-  for (size_t j = *i, k = 0; k < target_len; ++j, ++k) {
-    if (buf[j] != target[k]) {
-      return 0;
-    }
+  // rank of the sample we are looking for, rounded up
+  unsigned long long rank = ((unsigned long long)h->total * per10000 + 9999) / 10000;
+  if (rank == 0) {
+    rank = 1;
   }
-  *i += target_len;
-  return 1;
-}
-
-train_command_t try_parse_train_command(char *buf, size_t len) {
-  ASSERT(buf);
-  train_command_t c;
-  c.kind = TRAIN_COMMAND_INVALID;
-  size_t i = 0;
-  unsigned char num;
-  eat_whitespace(buf, &i, len);
-  if (match_start(buf, &i, len, "tr", 2)) {
-    eat_whitespace(buf, &i, len);
-    if (!match_two_digits(buf, &i, len, &num, 0)) {
-      return c;
-    }
-    c.cmd.tr.train_num = num;
-    eat_whitespace(buf, &i, len);
-    if (!match_two_digits(buf, &i, len, &num, 0) || !((num <= 14) || (num >= 16 && num <= 30))) {
-      return c;
-    }
-    c.cmd.tr.speed = num;
-    c.kind = TRAIN_COMMAND_TR;
-
-  } else if (match_start(buf, &i, len, "rv", 2)) {
-    eat_whitespace(buf, &i, len);
-    if (!match_two_digits(buf, &i, len, &num, 0)) {
-      return c;
-    }
-    c.cmd.rv.train_num = num;
-    c.kind = TRAIN_COMMAND_RV;
-
-  } else if (match_start(buf, &i, len, "sw", 2)) {
-    eat_whitespace(buf, &i, len);
-    if (!match_two_digits(buf, &i, len, &num, 1)) {
-      return c;
-    }
-    c.cmd.sw.switch_num = num;
-    eat_whitespace(buf, &i, len);
-    if (match_start(buf, &i, len, "S", 1)) {
-      c.cmd.sw.straight = 1;
-      c.kind = TRAIN_COMMAND_SW;
-    } else if (match_start(buf, &i, len, "C", 1)) {
-      c.cmd.sw.straight = 0;
-      c.kind = TRAIN_COMMAND_SW;
+  unsigned long long seen = 0;
+  for (size_t i = 0; i < HIST_BUCKETS; ++i) {
+    seen += h->counts[i];
+    if (seen >= rank) {
+      unsigned top = hist_bucket_top(i);
+      return top < h->max ? top : h->max;
     }
-  } else if (match_start(buf, &i, len, "q", 1)) {
-      c.kind = TRAIN_COMMAND_Q;
   }
-  return c;
+  return h->max;
 }
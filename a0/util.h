@@ -60,22 +60,27 @@ void queue_emplace(queue_t *, const char *, size_t);
 void queue_consume(queue_t *, size_t);
 // gets longest contigent range of data
 char *queue_longest_data(queue_t *, size_t *);
+// number of bytes stored
+size_t queue_size(queue_t *);
 
 #define queue_emplace_literal(q, s) queue_emplace(q, s, sizeof s / sizeof(s[0]) - 1)
 
+/**
+ * Log-linear histogram, in the style of HdrHistogram. Values below 2^HIST_SUB_BITS get a bucket
+ * each; above that, every power of two is split into 2^HIST_SUB_BITS buckets, so any value is
+ * known to within 1/2^HIST_SUB_BITS of itself. Adding a sample is a clz and an increment.
+ */
+#define HIST_SUB_BITS 4
+#define HIST_BUCKETS ((32 - HIST_SUB_BITS + 1) << HIST_SUB_BITS)
+
 typedef struct {
-  enum {
-    TRAIN_COMMAND_TR,
-    TRAIN_COMMAND_RV,
-    TRAIN_COMMAND_SW,
-    TRAIN_COMMAND_Q,
-    TRAIN_COMMAND_INVALID,
-  } kind;
-  union {
-    struct { unsigned char train_num, speed; } tr;
-    struct { unsigned char train_num; } rv;
-    struct { unsigned char switch_num, straight; } sw;
-  } cmd;
-} train_command_t;
+  unsigned counts[HIST_BUCKETS];
+  unsigned total;
+  unsigned max;
+} hist_t;
 
-train_command_t try_parse_train_command(char *, size_t);
+void hist_reset(hist_t *);
+void hist_add(hist_t *, unsigned value);
+// smallest value that at least the given fraction (in 1/10000) of samples is not above, up to the
+// precision of the buckets; 0 if there are no samples
+unsigned hist_percentile(hist_t *, unsigned per10000);
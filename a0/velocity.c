@@ -0,0 +1,166 @@
+#include "velocity.h"
+#include "sensor.h"
+#include "util.h"
+
+#define ASSERT(x)  // TODO
+
+static const unsigned long long TICKS_PER_SEC = 1000000;
+static const unsigned EMA_SHIFT = 3;  // weight of a new sample is 1/8, once there are 8
+static const unsigned char TRUSTED_SAMPLES = 3;
+static const unsigned STOP_FRAC_BITS = 12;  // stop times are Q4.12 seconds
+// a stop that cost less distance than this is lost in when the sensors happen to be polled
+static const unsigned STOP_MIN_LOST_UM = 40000;
+static const unsigned REVERSE_MARGIN = 300000;  // us added to a learned stop time before reversing
+
+void velocity_init(velocity_t *v) {
+  ASSERT(v);
+  memset(v, 0, sizeof *v);
+  for (size_t i = 0; i < TRAIN_NUMBERS; ++i) {
+    v->trains[i].last_sensor = SENSOR_NONE;
+  }
+}
+
+// adds a sample to a smoothed estimate; returns 0 if it is too far off a trusted one to count
+static int smooth(q16_t *avg, unsigned char *samples, q16_t sample) {
+  if (*samples >= TRUSTED_SAMPLES && (sample > (int64_t)*avg * 2 || sample < *avg / 2)) {
+    return 0;
+  } else if (*samples < 1u << EMA_SHIFT) {
+    // a plain mean until the average weighs samples no less than the ema will
+    *avg = q16_mean(*avg, sample, *samples + 1);
+  } else {
+    *avg = q16_ema(*avg, sample, EMA_SHIFT);
+  }
+  if (*samples < 255) {
+    ++*samples;
+  }
+  return 1;
+}
+
+void velocity_set_speed(velocity_t *v, unsigned char train, unsigned char speed, unsigned now, unsigned settle) {
+  ASSERT(v);
+  ASSERT(train < TRAIN_NUMBERS);
+  velocity_train_t *t = &v->trains[train];
+  t->stop_from = 0;
+  if (speed % 16 == 0 && t->speed && t->last_velocity) {
+    t->stop_from = t->speed;
+    t->stop_sensor = t->last_sensor;
+    t->stop_sensor_time = t->last_time;
+    t->stop_time = now;
+    t->stop_velocity = t->last_velocity;
+  }
+  t->speed = speed % 16;
+  t->steady_from = now + settle;
+  t->last_velocity = 0;
+}
+
+void velocity_reverse(velocity_t *v, unsigned char train) {
+  ASSERT(v);
+  ASSERT(train < TRAIN_NUMBERS);
+  v->trains[train].last_sensor = SENSOR_NONE;
+  v->trains[train].last_velocity = 0;
+  v->trains[train].stop_from = 0;
+}
+
+static void add_stop_sample(velocity_t *v, unsigned char train, unsigned char speed, unsigned velocity,
+                            uint64_t stop_us) {
+  q16_t sample, decel;
+  if (!q16_ratio(stop_us, TICKS_PER_SEC, &sample) || sample >= (q16_t)0x10000 << (16 - STOP_FRAC_BITS) ||
+      !q16_ratio(velocity * TICKS_PER_SEC, stop_us, &decel)) {
+    return;  // over 16 s, not a stop
+  }
+  q16_t avg = (q16_t)v->stop[train][speed] << (16 - STOP_FRAC_BITS);
+  if (smooth(&avg, &v->stop_samples[train][speed], sample)) {
+    v->stop[train][speed] = (avg + (1 << (15 - STOP_FRAC_BITS))) >> (16 - STOP_FRAC_BITS);
+  }
+  smooth(&v->decel[train], &v->decel_samples[train], decel);
+}
+
+// the first sensor a stopping train triggers
+static void learn_stop(velocity_t *v, const track_t *track, unsigned char train, unsigned char sensor, unsigned now) {
+  velocity_train_t *t = &v->trains[train];
+  unsigned char from = t->stop_from;
+  t->stop_from = 0;
+  unsigned dist = track_sensor_distance(track, t->stop_sensor, sensor);
+  unsigned since = now - t->stop_time;
+  if (!dist || !since) {
+    return;
+  }
+  // in um: how far past stop_sensor the train was told to stop, how far it went since, and how far
+  // it would have gone at full speed
+  uint64_t before = (uint64_t)t->stop_velocity * (t->stop_time - t->stop_sensor_time) / 1000;
+  if (before >= dist * 1000ull) {
+    return;
+  }
+  uint64_t went = dist * 1000ull - before;
+  uint64_t coast = (uint64_t)t->stop_velocity * since / 1000;
+  // constant deceleration a: went = coast - a since^2 / 2, and the train stops at velocity / a;
+  // while it still moves, went is at least half of coast
+  if (went + STOP_MIN_LOST_UM > coast || went * 2 < coast) {
+    return;
+  }
+  add_stop_sample(v, train, from, t->stop_velocity, coast * since / (2 * (coast - went)));
+}
+
+unsigned velocity_sensor(velocity_t *v, const track_t *track, unsigned char train, unsigned char sensor, unsigned now) {
+  ASSERT(v);
+  ASSERT(track);
+  ASSERT(train < TRAIN_NUMBERS);
+  velocity_train_t *t = &v->trains[train];
+  if (t->stop_from) {
+    learn_stop(v, track, train, sensor, now);
+  }
+  unsigned char from = t->last_sensor;
+  unsigned from_time = t->last_time;
+  t->last_sensor = sensor;
+  t->last_time = now;
+  t->last_velocity = 0;
+
+  if (from == SENSOR_NONE || !t->speed || (int)(from_time - t->steady_from) < 0 || now == from_time) {
+    return 0;
+  }
+  unsigned dist = track_sensor_distance(track, from, sensor);
+  if (!dist) {
+    return 0;  // missed a sensor, or not the train we think it is
+  }
+
+  q16_t sample;
+  if (!q16_ratio(dist * TICKS_PER_SEC, now - from_time, &sample)) {
+    return 0;  // faster than anything on the track
+  }
+  if (!smooth(&v->ema[train][t->speed], &v->samples[train][t->speed], sample)) {
+    return 0;  // most likely a misattributed trigger
+  }
+  t->last_velocity = q16_round(sample);
+  return t->last_velocity;
+}
+
+unsigned velocity_get(velocity_t *v, unsigned char train, unsigned char speed) {
+  ASSERT(v);
+  ASSERT(train < TRAIN_NUMBERS);
+  return q16_round(v->ema[train][speed % 16]);
+}
+
+unsigned velocity_stop_time(velocity_t *v, unsigned char train, unsigned char speed) {
+  ASSERT(v);
+  ASSERT(train < TRAIN_NUMBERS);
+  if (v->stop_samples[train][speed % 16] >= TRUSTED_SAMPLES) {
+    return (uint64_t)v->stop[train][speed % 16] * TICKS_PER_SEC >> STOP_FRAC_BITS;
+  }
+  // not stopped from this speed often enough yet: as fast as it slows down from the others
+  if (v->decel_samples[train] < TRUSTED_SAMPLES || v->samples[train][speed % 16] < TRUSTED_SAMPLES ||
+      v->decel[train] <= 0) {
+    return 0;
+  }
+  uint64_t us = ((uint64_t)velocity_get(v, train, speed) * TICKS_PER_SEC << 16) / v->decel[train];
+  return us > ~0u ? ~0u : us;  // a barely learned deceleration can make it absurd
+}
+
+unsigned velocity_reverse_wait(velocity_t *v, unsigned char train, unsigned char speed, unsigned fallback) {
+  ASSERT(v);
+  unsigned learned = velocity_stop_time(v, train, speed);
+  if (!learned) {
+    return fallback;
+  }
+  uint64_t wait = (uint64_t)learned + learned / 4 + REVERSE_MARGIN;
+  return wait < fallback ? wait : fallback;
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "fixed.h"
+#include "track.h"
+#include "train.h"
+
+#define TRAIN_NUMBERS (TRAIN_MAX + 1)  // indexed by train number
+#define TRAIN_SPEED_LEVELS 16  // 15 is reverse, and never a speed
+
+typedef struct {
+  unsigned char last_sensor;  // SENSOR_NONE if the position is unknown
+  unsigned char speed;  // 0-14, without the lights bit
+  unsigned last_time;  // when last_sensor was triggered
+  unsigned steady_from;  // intervals starting before this were (partly) spent accelerating
+  unsigned last_velocity;  // mm/s over the interval up to last_sensor, 0 if it was not measured
+  // while stopping: the speed it was told to stop from (0 if not stopping), when, and where it was
+  // last seen going at that speed
+  unsigned char stop_from;
+  unsigned char stop_sensor;
+  unsigned stop_time, stop_sensor_time;
+  unsigned stop_velocity;  // mm/s
+} velocity_train_t;
+
+/**
+ * Online velocity estimates, per train and per speed level.
+ *
+ * All times are system timer ticks (us). Estimates are kept in Q16.16 mm/s, so that the smoothing
+ * does not lose precision to integer division: the mean of the first few samples, then an
+ * exponential moving average.
+ *
+ * Stop times are learned the same way, per train and per speed stopped from. When a train is told
+ * to stop right after its velocity was measured between two sensors, the first sensor it still
+ * triggers gives how far it went in how long since; assuming constant deceleration, that fixes
+ * when it came to rest.
+ * They are kept in Q4.12 seconds, 2 bytes each. Each sample also goes into a deceleration per
+ * train, which stands in for the speeds it has not been stopped from often enough yet.
+ */
+typedef struct {
+  velocity_train_t trains[TRAIN_NUMBERS];
+  q16_t ema[TRAIN_NUMBERS][TRAIN_SPEED_LEVELS];
+  unsigned char samples[TRAIN_NUMBERS][TRAIN_SPEED_LEVELS];
+  unsigned short stop[TRAIN_NUMBERS][TRAIN_SPEED_LEVELS];
+  unsigned char stop_samples[TRAIN_NUMBERS][TRAIN_SPEED_LEVELS];
+  q16_t decel[TRAIN_NUMBERS];  // mm/s^2
+  unsigned char decel_samples[TRAIN_NUMBERS];
+} velocity_t;
+
+void velocity_init(velocity_t *);
+
+// the train was told to change speed; settle is how long it takes to get there
+void velocity_set_speed(velocity_t *, unsigned char train, unsigned char speed, unsigned now, unsigned settle);
+
+// the train turned around, so the last sensor says nothing about the next one
+void velocity_reverse(velocity_t *, unsigned char train);
+
+// the train triggered a sensor; learns its stop time if it is stopping, and returns the velocity
+// measured since its last sensor in mm/s, or 0 if there was nothing to measure
+unsigned velocity_sensor(velocity_t *, const track_t *, unsigned char train, unsigned char sensor, unsigned now);
+
+// smoothed velocity in mm/s, 0 if unknown
+unsigned velocity_get(velocity_t *, unsigned char train, unsigned char speed);
+
+// learned time to stop from the speed in us, 0 until there are enough samples, saturates at ~0u
+unsigned velocity_stop_time(velocity_t *, unsigned char train, unsigned char speed);
+
+// how long to let the train slow down from the speed before reversing it, in us: the learned stop
+// time with a quarter and 0.3 s on top, but no more than fallback, the static worst case, which is
+// also what it is until a stop time is learned
+unsigned velocity_reverse_wait(velocity_t *, unsigned char train, unsigned char speed, unsigned fallback);